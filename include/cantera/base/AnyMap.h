@@ -322,6 +322,14 @@ private:
 
     mutable Comparer m_equals;
 
+    //! Append a binary representation of this value to *out*. See
+    //! AnyMap::setFileCacheDirectory()
+    void writeBinary(string& out) const;
+
+    //! Read a value written by writeBinary() from *data*, starting at *pos*
+    void readBinary(const string& data, size_t& pos);
+
+    friend class AnyMap;
     friend YAML::Emitter& YAML::operator<<(YAML::Emitter& out, const AnyValue& rhs);
 };
 
@@ -437,9 +445,35 @@ public:
     static AnyMap fromYamlFile(const string& name,
                                const string& parent_name="");
 
+    //! Get a shared, read-only reference to the parsed contents of a YAML file.
+    /*!
+     *  The file is located as for fromYamlFile(), and the returned tree is stored
+     *  in the input file cache, so repeated loads of the same file neither parse
+     *  nor copy it. Reading some values from an AnyMap converts them in place
+     *  (for example, integers read as floating point values). Such conversions
+     *  persist in the shared tree, but do not affect the copies returned by
+     *  fromYamlFile(). As these conversions modify the tree without
+     *  synchronization, even reading values from the shared tree is not safe if it
+     *  is accessed by several threads at the same time. Functions that may be
+     *  called concurrently, such as newSolution(), therefore use fromYamlFile().
+     *  @since New in %Cantera 3.1.
+     */
+    static shared_ptr<const AnyMap> sharedYamlFile(const string& name,
+                                                   const string& parent_name="");
+
     //! Create an AnyMap from a string containing a YAML document
     static AnyMap fromYamlString(const string& yaml);
 
+    //! Convert the AnyMap to a YAML string.
+    //!
+    //! If the metadata value `binary-threshold` (see setMetadata()) is set to a
+    //! positive integer, vectors of `double` or `long int` values with at least this
+    //! many elements are written as base64-encoded blocks of little-endian binary
+    //! data, tagged with `!binary-float64` or `!binary-int64`. Matrices with at least
+    //! this many elements are written as sequences of such blocks, one per row. These
+    //! representations are converted back to vectors and matrices when reading YAML,
+    //! and avoid both the cost of formatting and parsing values and any loss of
+    //! precision.
     string toYamlString() const;
 
     //! Get the value of the item stored in `key`.
@@ -696,18 +730,76 @@ public:
     //! Remove the specified file from the input cache if it is present
     static void clearCachedFile(const string& filename);
 
+    //! Set the directory used for the on-disk cache of parsed input files.
+    /*!
+     * When this directory is set, fromYamlFile() stores each parsed input file
+     * in this directory using a compact binary representation, and reads it from
+     * there instead of parsing the YAML file again when the same file is
+     * loaded by a later process. Cache entries are identified by a hash of the
+     * file contents and the %Cantera version, so modified input files are
+     * parsed again, and a cache directory can be shared by multiple processes.
+     * Numbers are stored with fixed widths and byte order, so cache files can
+     * also be shared between platforms. Cache entries which cannot be read are
+     * ignored. An empty string disables the on-disk cache.
+     *
+     * The initial value is taken from the environment variable
+     * `CANTERA_YAML_CACHE`. If it is not set, the on-disk cache is disabled.
+     *
+     * @since New in %Cantera 3.1.
+     */
+    static void setFileCacheDirectory(const string& path);
+
+    //! Get the directory used for the on-disk cache of parsed input files. See
+    //! setFileCacheDirectory().
+    //! @since New in %Cantera 3.1.
+    static string fileCacheDirectory();
+
 private:
+    //! Append a binary representation of this map to *out*, used for the on-disk
+    //! cache of parsed input files
+    void writeBinary(string& out) const;
+
+    //! Read a map written by writeBinary() from *data*, starting at *pos*
+    void readBinary(const string& data, size_t& pos);
+
+    //! Try to read the parsed contents of the input file with the given hash
+    //! from the on-disk cache. Returns `false` if there is no usable entry.
+    static bool loadFileCache(const string& hash, AnyMap& target);
+
+    //! Write the parsed contents of the input file with the given hash to the
+    //! on-disk cache. Failures are ignored.
+    static void saveFileCache(const string& hash, const AnyMap& source);
+
     //! The stored data
     std::unordered_map<string, AnyValue> m_data;
 
     //! The default units that are used to convert stored values
     shared_ptr<UnitSystem> m_units;
 
+    //! An entry in the cache of parsed input files
+    struct CachedFile {
+        //! Parsed contents of the file. Not modified after being added to the
+        //! cache, and copied by fromYamlFile().
+        shared_ptr<const AnyMap> tree;
+        //! Copy of #tree returned by sharedYamlFile(), where values read by the
+        //! callers may be converted in place
+        shared_ptr<const AnyMap> shared;
+        //! Last-modified time of the file, used to enable change detection
+        std::filesystem::file_time_type mtime;
+    };
+
+    //! Find, parse and cache the YAML file *name*, or return the existing entry
+    //! from #s_cache. See fromYamlFile().
+    static CachedFile cachedYamlFile(const string& name, const string& parent_name);
+
     //! Cache for previously-parsed input (YAML) files. The key is the full path
-    //! to the file, and the second element of the value is the last-modified
-    //! time for the file, which is used to enable change detection.
-    static std::unordered_map<string,
-                              pair<AnyMap, std::filesystem::file_time_type>> s_cache;
+    //! to the file. Cached entries are replaced rather than updated if the file
+    //! changes, so that they can be used without holding a lock on the cache.
+    static std::unordered_map<string, CachedFile> s_cache;
+
+    //! Directory for the on-disk cache of parsed input files. See
+    //! setFileCacheDirectory().
+    static string s_fileCacheDir;
 
     //! Information about fields that should appear first when outputting to
     //! YAML. Keys in this map are matched to `__type__` keys in AnyMap
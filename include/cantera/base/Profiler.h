@@ -0,0 +1,143 @@
+/**
+ * @file Profiler.h
+ *    Built-in instrumentation of performance-critical code sections
+ *    (see @ref Cantera::Profiler).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_PROFILER_H
+#define CT_PROFILER_H
+
+#include "ct_defs.h"
+#include <atomic>
+#include <chrono>
+
+namespace Cantera
+{
+
+class AnyMap;
+
+//! Collection of timing data for instrumented code sections ("zones").
+/*!
+ * Performance-critical functions within %Cantera, for example
+ * BulkKinetics::updateROP, MultiSpeciesThermo::update, the update methods of
+ * GasTransport, ReactorNet::eval, MultiJac::eval and the callback functions used by
+ * CVODES, are instrumented using the #CT_PROFILE_ZONE macro. Instrumentation is
+ * only compiled in if %Cantera is built with the SCons option `profiling=y`, and
+ * data are only collected after profiling is enabled at run time:
+ *
+ * @code
+ * Profiler::enable();
+ * net.advance(1.0);
+ * Profiler::enable(false);
+ * std::cout << Profiler::report().toYamlString();
+ * @endcode
+ *
+ * For each zone, the number of calls and the cumulative wall clock time spent
+ * within the zone are recorded using a monotonic clock with nanosecond resolution.
+ * Times are inclusive, that is, time spent in nested zones is also attributed to
+ * the enclosing zone. Counters are kept separately for each thread, so that
+ * recording does not require any synchronization between threads; report()
+ * aggregates counters of all threads, including threads that have already exited.
+ *
+ * If profiling is disabled at run time, the overhead of an instrumented zone is a
+ * single relaxed atomic load.
+ *
+ * @ingroup globalUtilFuncs
+ * @since New in %Cantera 3.1.
+ */
+class Profiler
+{
+public:
+    Profiler() = delete;
+
+    //! Enable or disable collection of timing data
+    static void enable(bool on=true) {
+        s_enabled.store(on, std::memory_order_relaxed);
+    }
+
+    //! Return `true` if timing data are being collected
+    static bool enabled() {
+        return s_enabled.load(std::memory_order_relaxed);
+    }
+
+    //! Get the index of the zone with the given name, registering a new zone if
+    //! necessary. Zones that are registered with the same name share their counters.
+    //! If #maxZones zones are already registered, `npos` is returned and calls of
+    //! the new zone are not recorded. This function does not throw, as zones may be
+    //! entered within callback functions invoked by C libraries.
+    static size_t zoneIndex(const string& name) noexcept;
+
+    //! Add a call taking *nanoseconds* to the counters of the current thread for
+    //! the zone with index *zone*. Calls are ignored if *zone* is `npos`.
+    static void record(size_t zone, uint64_t nanoseconds);
+
+    //! Return a summary of timing data.
+    //! The returned AnyMap contains one entry for each zone that has been entered,
+    //! holding the number of `calls`, the cumulative `time` in seconds, the
+    //! `mean-time` per call in seconds, and the number of `threads` that entered
+    //! the zone.
+    static AnyMap report();
+
+    //! Reset counters of all threads
+    static void reset();
+
+    //! Maximum number of distinct zones
+    static constexpr size_t maxZones = 128;
+
+private:
+    static std::atomic<bool> s_enabled;
+};
+
+//! Scope guard measuring the time spent within a zone.
+//! Usually created by the #CT_PROFILE_ZONE macro.
+//! @ingroup globalUtilFuncs
+//! @since New in %Cantera 3.1.
+class ProfileZone
+{
+public:
+    //! Start timing the zone with index *zone*; see Profiler::zoneIndex
+    explicit ProfileZone(size_t zone) : m_zone(zone) {
+        if (zone != npos && Profiler::enabled()) {
+            m_active = true;
+            m_start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~ProfileZone() {
+        if (m_active) {
+            auto elapsed = std::chrono::steady_clock::now() - m_start;
+            Profiler::record(m_zone,
+                std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        }
+    }
+
+    ProfileZone(const ProfileZone&) = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+
+private:
+    size_t m_zone; //!< Index of the zone
+    bool m_active = false; //!< `true` if the zone is being timed
+    std::chrono::steady_clock::time_point m_start; //!< Time the zone was entered
+};
+
+}
+
+#define CT_PROFILE_CONCAT_(a, b) a##b
+#define CT_PROFILE_CONCAT(a, b) CT_PROFILE_CONCAT_(a, b)
+
+#if CT_ENABLE_PROFILING
+//! Measure the time spent in the remainder of the enclosing scope, attributed to the
+//! zone *name*; see Cantera::Profiler.
+#define CT_PROFILE_ZONE(name) \
+    static const size_t CT_PROFILE_CONCAT(ct_profile_id_, __LINE__) = \
+        ::Cantera::Profiler::zoneIndex(name); \
+    ::Cantera::ProfileZone CT_PROFILE_CONCAT(ct_profile_zone_, __LINE__)( \
+        CT_PROFILE_CONCAT(ct_profile_id_, __LINE__))
+#else
+#define CT_PROFILE_ZONE(name)
+#endif
+
+#endif
@@ -14,6 +14,7 @@ namespace Cantera
 
 class Solution;
 class ThermoPhase;
+class Storage;
 
 //! A container class holding arrays of state information.
 /*!
@@ -31,6 +32,43 @@ class ThermoPhase;
  */
 class SolutionArray
 {
+public:
+    //! Non-owning view of one state component of all entries of a SolutionArray.
+    /*!
+     * The states of all SolutionArray entries are stored back-to-back in a single
+     * buffer. A view provides in-place access to one component of these states (for
+     * example, the temperature or the mass fraction of a species) without copying;
+     * consecutive values are separated by a constant stride. The view is invalidated
+     * if the SolutionArray is resized.
+     * @since New in %Cantera 3.1.
+     */
+    class ComponentView
+    {
+    public:
+        ComponentView(double* data, size_t stride, const vector<int>& indices)
+            : m_data(data), m_stride(stride), m_indices(&indices) {}
+
+        //! Number of entries
+        size_t size() const {
+            return m_indices->size();
+        }
+
+        //! Value of the component for entry *k*
+        double& operator[](size_t k) {
+            return m_data[(*m_indices)[k] * m_stride];
+        }
+
+        //! Value of the component for entry *k*
+        double operator[](size_t k) const {
+            return m_data[(*m_indices)[k] * m_stride];
+        }
+
+    private:
+        double* m_data; //!< Location of the component for the first stored entry
+        size_t m_stride; //!< Distance between values of consecutive stored entries
+        const vector<int>* m_indices; //!< Locations of the active entries
+    };
+
 private:
     SolutionArray(const shared_ptr<Solution>& sol,
                   int size,
@@ -166,6 +204,79 @@ public:
     //! Normalize mass/mole fractions
     void normalize();
 
+    /**
+     *  Equilibrate all entries of the SolutionArray, holding the property pair *XY*
+     *  fixed at the values of the respective entries.
+     *
+     *  Entries are divided into contiguous blocks, which are solved concurrently on
+     *  *nThreads* threads using one copy of the phase per thread. Within each block,
+     *  the element potential solver continues from the solution of the preceding
+     *  entry (see ThermoPhase::equilibrate), so entries should be ordered such that
+     *  neighboring entries have similar equilibrium states, as is the case for
+     *  structured grids of initial states.
+     *
+     *  Entries for which the solver fails keep their initial state. Failures are
+     *  reported in the returned vector rather than by throwing an exception.
+     *
+     *  @param XY  Property pair to hold constant; see ThermoPhase::equilibrate
+     *  @param solver, rtol, max_steps, max_iter, estimate_equil  Solver options;
+     *      see ThermoPhase::equilibrate
+     *  @param nThreads  Number of threads. The default is to use a single thread;
+     *      if zero, the number of concurrent threads supported by the hardware is
+     *      used.
+     *  @returns  Vector of length size(), holding an empty string for entries that
+     *      were equilibrated successfully and the error message otherwise
+     *  @since New in %Cantera 3.1.
+     */
+    vector<string> equilibrate(const string& XY, const string& solver="auto",
+                               double rtol=1e-9, int max_steps=50000,
+                               int max_iter=100, int estimate_equil=0,
+                               size_t nThreads=1);
+
+    /**
+     *  Retrieve a view of a state component, which provides access to the values
+     *  stored for all entries without copying.
+     *
+     *  @param name  Name of a property defining the native state (see
+     *      Phase::nativeState) or name of a species
+     *  @since New in %Cantera 3.1.
+     */
+    ComponentView componentView(const string& name);
+
+    /**
+     *  Evaluate a property for all entries of the SolutionArray.
+     *
+     *  Supported properties are:
+     *  - scalar thermodynamic properties: `T`, `P`, `density`, `density_mole`,
+     *    `mean_molecular_weight`, `enthalpy_mass`, `enthalpy_mole`,
+     *    `int_energy_mass`, `int_energy_mole`, `entropy_mass`, `entropy_mole`,
+     *    `gibbs_mass`, `gibbs_mole`, `cp_mass`, `cp_mole`, `cv_mass`, `cv_mole`
+     *    and `sound_speed`
+     *  - species properties: `X`, `Y`, `concentrations`,
+     *    `partial_molar_enthalpies`, `partial_molar_entropies`,
+     *    `partial_molar_int_energies`, `partial_molar_cp`, `partial_molar_volumes`
+     *    and `chemical_potentials`
+     *  - kinetic properties, if the associated Solution has a Kinetics object:
+     *    `creation_rates`, `destruction_rates`, `net_production_rates` (one value
+     *    for each species of the kinetics manager), `forward_rates_of_progress`,
+     *    `reverse_rates_of_progress`, `net_rates_of_progress` (one value for each
+     *    reaction) and `heat_release_rate`
+     *
+     *  The state of each entry is restored directly from the stored data, without
+     *  updating the buffered location. Entries are divided into contiguous blocks,
+     *  which are evaluated concurrently on *nThreads* threads using one copy of the
+     *  Solution per thread, as in equilibrate(). Properties of phases with adjacent
+     *  phases are always evaluated on a single thread.
+     *
+     *  @param name  Name of property
+     *  @param nThreads  Number of threads, as for equilibrate()
+     *  @returns  Vector holding the values of the property for all entries in turn,
+     *      with one value per entry for scalar properties, and one value per species
+     *      or reaction otherwise
+     *  @since New in %Cantera 3.1.
+     */
+    vector<double> getProperty(const string& name, size_t nThreads=1);
+
     /**
      *  Add auxiliary component to SolutionArray. Initialization requires a subsequent
      *  call of setComponent().
@@ -240,6 +351,28 @@ public:
     void writeEntry(const string& fname, const string& name, const string& sub,
                     bool overwrite=false, int compression=0);
 
+    /**
+     *  Append SolutionArray data to a HDF container file.
+     *
+     *  On the first call for a given group, metadata are written and extendible
+     *  datasets are created; subsequent calls append the current entries to these
+     *  datasets, which requires that components of the SolutionArray are unchanged.
+     *  As only new data are written, long time histories can be saved incrementally
+     *  by alternately adding entries (see append()) and calling this method, followed
+     *  by `resize(0)` to keep the memory footprint bounded.
+     *
+     *  @param fname  Name of HDF container file
+     *  @param name  Identifier of group holding header information
+     *  @param sub  Name identifier of subgroup holding SolutionArray data
+     *  @param compression  Compression level; optional (default=0); only used when
+     *      datasets are created
+     *  @param chunkSize  Number of entries per HDF chunk; optional (default=1024);
+     *      only used when datasets are created
+     *  @since New in %Cantera 3.1.
+     */
+    void appendEntry(const string& fname, const string& name, const string& sub,
+                     int compression=0, size_t chunkSize=1024);
+
     /**
      *  Write SolutionArray data to AnyMap. Used by YAML serialization.
      *
@@ -284,10 +417,15 @@ public:
      *  @param basis  Output mass (`"Y"`/`"mass"`) or mole (`"X"`/`"mole"`) fractions;
      *      if not specified (default=`""`), the native basis of the underlying
      *      ThermoPhase manager is used - see Phase::nativeState (CSV only)
+     *  @param binary  Store numeric arrays with at least #s_binaryThreshold elements
+     *      as base64-encoded binary blocks (see AnyMap::toYamlString); optional
+     *      (default=`false`; YAML only)
+     *
+     *  @since Changed in %Cantera 3.1: added the @p binary argument.
      */
     void save(const string& fname, const string& name="", const string& sub="",
               const string& desc="", bool overwrite=false, int compression=0,
-              const string& basis="");
+              const string& basis="", bool binary=false);
 
     /**
      *  Read header information from a HDF container file.
@@ -314,6 +452,28 @@ public:
      */
     void readEntry(const string& fname, const string& name, const string& sub);
 
+    /**
+     *  Restore a subset of SolutionArray data from a HDF container file.
+     *
+     *  Only the selected entries and auxiliary components are read, using partial
+     *  reads of the stored datasets, so that memory use and the cost of reading
+     *  scale with the size of the selection rather than with the size of the stored
+     *  data. State information is always restored for the selected entries. Metadata
+     *  are restored as in readEntry(), that is, without information on the selection.
+     *
+     *  @param fname  Name of HDF container file
+     *  @param name  Identifier of group holding header information
+     *  @param sub  Name identifier of subgroup holding SolutionArray data
+     *  @param start  Index of first entry to be restored
+     *  @param count  Number of entries to be restored; if npos, all entries starting
+     *      at *start* are restored
+     *  @param extra  Names of auxiliary components to be restored; if empty, all
+     *      auxiliary components are restored
+     *  @since New in %Cantera 3.1.
+     */
+    void readEntry(const string& fname, const string& name, const string& sub,
+                   size_t start, size_t count=npos, const vector<string>& extra={});
+
     /**
      *  Restore SolutionArray data from AnyMap. Used by YAML serialization.
      *
@@ -338,6 +498,34 @@ public:
      */
     AnyMap restore(const string& fname, const string& name, const string& sub="");
 
+    /**
+     *  Restore a subset of SolutionArray data and header information from a
+     *  container file.
+     *
+     *  Selected entries and auxiliary components are read from HDF files as
+     *  described for the corresponding readEntry() method. YAML files are parsed
+     *  in full, so that a selection does not reduce the cost of reading; they only
+     *  support restoring all entries and components.
+     *
+     *  @param fname  Name of container file (YAML or HDF)
+     *  @param name  Identifier of location within the container file
+     *  @param sub  Name identifier for the subgroup holding the SolutionArray data
+     *  @param start  Index of first entry to be restored
+     *  @param count  Number of entries to be restored; if npos, all entries starting
+     *      at *start* are restored
+     *  @param extra  Names of auxiliary components to be restored; if empty, all
+     *      auxiliary components are restored
+     *  @return  AnyMap containing header information
+     *  @since New in %Cantera 3.1.
+     */
+    AnyMap restore(const string& fname, const string& name, const string& sub,
+                   size_t start, size_t count=npos, const vector<string>& extra={});
+
+    //! Minimum number of elements of numeric arrays written as binary blocks to
+    //! YAML output; see save()
+    //! @since New in %Cantera 3.1.
+    static constexpr long int s_binaryThreshold = 16;
+
 protected:
     //! Service function used to resize SolutionArray
     void _resize(size_t size);
@@ -377,6 +565,11 @@ protected:
     //! Retrieve set containing list of properties defining state
     set<string> _stateProperties(const string& mode, bool alias=false);
 
+    //! Write state and auxiliary data to group *path* of HDF container *file*,
+    //! either as new datasets (if *offset* is `npos`) or to extendible datasets
+    //! starting at row *offset*.
+    void _writeData(Storage& file, const string& path, size_t offset=npos);
+
     shared_ptr<Solution> m_sol; //!< Solution object associated with state data
     size_t m_size; //!< Number of entries in SolutionArray
     size_t m_dataSize; //!< Total size of unsliced data
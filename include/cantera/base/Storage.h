@@ -49,6 +49,23 @@ public:
     //! sizes, which involves considerable overhead for metadata).
     void setCompressionLevel(int level);
 
+    //! Set the number of rows per chunk (default=1024)
+    //!
+    //! Chunking is used for compressed matrix-type data and for all data written
+    //! by appendData().
+    //! @since New in %Cantera 3.1.
+    void setChunkSize(size_t rows);
+
+    //! Restrict reading of datasets to a range of rows
+    //!
+    //! Subsequent calls to readData() only read rows *start* to *start + count - 1*
+    //! of a dataset (using partial reads of the HDF file), where the number of rows
+    //! expected by readData() refers to the length of the range.
+    //! @param start  first row to be read
+    //! @param count  number of rows to be read; if npos, the restriction is removed
+    //! @since New in %Cantera 3.1.
+    void setRowRange(size_t start, size_t count);
+
     //! Check whether location `id` represents a group
     bool hasGroup(const string& id) const;
 
@@ -84,7 +101,9 @@ public:
     //! Write attributes to a specified location
     //! @param id  storage location within file
     //! @param meta  AnyMap containing attributes
-    void writeAttributes(const string& id, const AnyMap& meta);
+    //! @param overwrite  if true, replace existing attributes (default=false; new in
+    //!     %Cantera 3.1)
+    void writeAttributes(const string& id, const AnyMap& meta, bool overwrite=false);
 
     //! Read dataset from a specified location
     //! @param id  storage location within file
@@ -109,6 +128,24 @@ public:
     //!     `vector<vector<string>>`
     void writeData(const string& id, const string& name, const AnyValue& data);
 
+    //! Append rows to a dataset at a specified location
+    //!
+    //! If the dataset does not exist, an extendible dataset is created, which is
+    //! chunked along its first dimension (see setChunkSize()) and compressed using
+    //! the current compression level. Only the new rows are written, so data can be
+    //! stored incrementally at a cost that does not depend on the size of the
+    //! existing dataset.
+    //! @param id  storage location within file
+    //! @param name  name of vector/matrix entry
+    //! @param data  vector or matrix containing data; the number of columns needs to
+    //!     match existing data. Implemented for the same types as writeData().
+    //! @param offset  row at which the new data are written; the dataset is resized
+    //!     to end with the new data, which discards any existing rows after
+    //!     *offset*. If omitted (`npos`), data are appended after the last row.
+    //! @since New in %Cantera 3.1.
+    void appendData(const string& id, const string& name, const AnyValue& data,
+                    size_t offset=npos);
+
 private:
 #if CT_USE_HDF5
     //! ensure that HDF group is readable
@@ -120,6 +157,9 @@ private:
     unique_ptr<HighFive::File> m_file; //!< HDF container file
     bool m_write; //!< HDF access mode
     int m_compressionLevel=0; //!< HDF compression level
+    size_t m_chunkSize=1024; //!< Number of rows per HDF chunk
+    size_t m_rowStart=0; //!< First row read by readData()
+    size_t m_rowCount=npos; //!< Number of rows read by readData() (npos: all)
 #endif
 };
 
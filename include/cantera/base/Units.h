@@ -43,6 +43,9 @@ public:
     //! @param units        A string representation of the units. See UnitSystem
     //!                     for a description of the formatting options.
     //! @param force_unity  ensure that conversion factor is equal to one
+    //!
+    //! Parsed unit strings are stored in a global, thread-safe cache, so
+    //! constructing Units from a previously used string only requires a lookup.
     explicit Units(const string& units, bool force_unity=false);
 
     //! Returns `true` if the specified Units are dimensionally consistent
@@ -74,6 +77,10 @@ private:
     //! Scale the unit by the factor `k`
     void scale(double k) { m_factor *= k; }
 
+    //! Throw an exception if *force_unity* is set and the conversion factor is
+    //! not equal to one. *name* is the unit string used in the error message.
+    void checkUnity(const string& name, bool force_unity) const;
+
     double m_factor = 1.0; //!< conversion factor to %Cantera base units
     double m_mass_dim = 0.0;
     double m_length_dim = 0.0;
@@ -47,6 +47,12 @@ public:
      * Continuation flag. Set true if the calculation should be initialized from
      * the last calculation. Otherwise, the calculation will be started from
      * scratch and the initial composition and element potentials estimated.
+     *
+     * When this flag is set and the last calculation using the same ChemEquil
+     * object and phase converged, the element potentials (and the temperature,
+     * if it is not held fixed) of that solution are used as the initial guess.
+     * If the calculation fails to converge from this initial guess, it is
+     * repeated from scratch.
      */
     bool contin = false;
 };
@@ -120,6 +126,13 @@ public:
     int equilibrate(ThermoPhase& s, const char* XY, vector<double>& elMoles,
                     int loglevel = 0);
 
+    //! Returns `true` if the next calculation with EquilOpt::contin set will be
+    //! initialized from the solution of the last calculation.
+    //! @since New in %Cantera 3.1.
+    bool hasStartSolution() const {
+        return m_startSolnValid;
+    }
+
     /**
      * Options controlling how the calculation is carried out.
      * @see EquilOpt
@@ -133,7 +146,7 @@ protected:
      * input from the equilibrate function. Currently, this means that the 2
      * ThermoPhases have to have consist of the same species and elements.
      */
-    ThermoPhase* m_phase;
+    ThermoPhase* m_phase = nullptr;
 
     //! number of atoms of element m in species k.
     double nAtoms(size_t k, size_t m) const {
@@ -146,6 +159,12 @@ protected:
      */
     void initialize(ThermoPhase& s);
 
+    //! Solve the equilibrium problem for equilibrate(), either starting from
+    //! estimates of the composition and element potentials or, if *warmStart* is
+    //! `true`, from the solution of the last calculation.
+    int solveEquilibrium(ThermoPhase& s, const char* XY,
+                         vector<double>& elMoles, int loglevel, bool warmStart);
+
     /**
      * Set mixture to an equilibrium state consistent with specified element
      * potentials and temperature.
@@ -281,8 +300,22 @@ protected:
     //! species. Equal to -1 if there is no such element id.
     size_t m_eloc = npos;
 
+    //! Solution of the last successful calculation: the dimensionless element
+    //! potentials followed by log(T). Used as the initial guess when
+    //! EquilOpt::contin is set. Length #m_mm + 1.
     vector<double> m_startSoln;
 
+    //! `true` if #m_startSoln contains the solution of the last calculation
+    bool m_startSolnValid = false;
+
+    //! Values of #m_nComponents and #m_orderVectorElements for the solution
+    //! stored in #m_startSoln
+    size_t m_startNComponents = 0;
+    vector<size_t> m_startOrderElements;
+
+    //! Elements present in the system for the solution stored in #m_startSoln
+    vector<bool> m_startElementPresent;
+
     vector<double> m_grt;
     vector<double> m_mu_RT;
 
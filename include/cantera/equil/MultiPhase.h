@@ -11,11 +11,13 @@
 #define CT_MULTIPHASE_H
 
 #include "cantera/numerics/DenseMatrix.h"
+#include "cantera/base/AnyMap.h"
 
 namespace Cantera
 {
 
 class ThermoPhase;
+class vcs_MultiPhaseEquil;
 
 //! A class for multiphase mixtures. The mixture can contain any
 //! number of phases of any type.
@@ -356,12 +358,21 @@ public:
      *      log_level=0 suppresses diagnostics, and increasingly-verbose
      *      messages are written as loglevel increases.
      *
+     *  The 'vcs' solver is kept between calls, so that its internal data
+     *  structures can be reused when the mixture is equilibrated repeatedly.
+     *
      * @ingroup equilGroup
      */
     void equilibrate(const string& XY, const string& solver="auto",
                      double rtol=1e-9, int max_steps=50000, int max_iter=100,
                      int estimate_equil=0, int log_level=0);
 
+    //! Get statistics of the 'vcs' solver used by equilibrate(), accumulated
+    //! since the solver was created. See vcs_MultiPhaseEquil::solverStats().
+    //! Returns an empty map if the 'vcs' solver has not been used.
+    //! @since New in %Cantera 3.1.
+    AnyMap solverStats() const;
+
     //! Set the temperature [K].
     /*!
      * @param T   value of the temperature (Kelvin)
@@ -629,6 +640,10 @@ private:
     //! True if the init() routine has been called, and the MultiPhase frozen
     bool m_init = false;
 
+    //! VCS solver used by equilibrate(), which is kept so that its work arrays
+    //! can be reused. Discarded if the solver fails.
+    shared_ptr<vcs_MultiPhaseEquil> m_vcsEquil;
+
     //! Global ID of the element corresponding to the electronic charge. If
     //! there is none, then this is equal to -1
     size_t m_eloc = npos;
@@ -11,6 +11,7 @@
 
 #include "MultiPhase.h"
 #include "vcs_solve.h"
+#include "cantera/base/AnyMap.h"
 
 namespace Cantera
 {
@@ -25,6 +26,12 @@ namespace Cantera
  * argument, and the return parameters are contained in underlying ThermoPhase
  * objects.
  *
+ * The same object can be used to solve a sequence of equilibrium problems for
+ * the same MultiPhase object, for example for different temperatures, pressures
+ * or element abundances. Each call to one of the equilibrate methods starts from
+ * the current state of the MultiPhase object, while the internal data structures
+ * and work arrays of the solver are reused.
+ *
  * @ingroup equilGroup
  */
 class vcs_MultiPhaseEquil
@@ -53,11 +60,34 @@ public:
 
     virtual ~vcs_MultiPhaseEquil() {}
 
-    //! return the number of iterations
+    //! Number of iterations of the VCS algorithm taken by the most recent call to
+    //! one of the equilibrate methods
     int iterations() const {
         return m_iter;
     }
 
+    //! MultiPhase object equilibrated by this solver
+    //! @since New in %Cantera 3.1.
+    MultiPhase* mixture() const {
+        return m_mix;
+    }
+
+    //! Get statistics accumulated over all calls to the equilibrate methods.
+    /*!
+     * The returned map contains the number of solves (`solves`), the number of
+     * fixed T and P solves (`TP_solves`), the total number of iterations
+     * (`iterations`), the number of optimizations of the component basis
+     * (`basis_optimizations`), the number of calls to the initial estimate
+     * routine (`initial_estimates`) and the number of phase stability tests
+     * (`phase_stability_tests`), together with the elapsed wall-clock time in
+     * seconds spent in the fixed T and P solver (`TP_time`), in basis
+     * optimizations (`basis_optimization_time`), in the initial estimate routine
+     * (`initial_estimate_time`) and in phase stability tests
+     * (`phase_stability_time`).
+     * @since New in %Cantera 3.1.
+     */
+    AnyMap solverStats() const;
+
     //! Equilibrate the solution using the current element abundances
     //! stored in the MultiPhase object
     /*!
@@ -224,6 +254,9 @@ public:
     void reportCSV(const string& reportFile);
 
 protected:
+    //! Load the problem from the MultiPhase object at the start of a solve
+    void prepareSolve();
+
     //! Vector that takes into account of the current sorting of the species
     /*!
      * The index of m_order is the original k value of the species in the
@@ -259,7 +292,13 @@ protected:
     DenseMatrix m_N;
 
     //! Iteration Count
-    int m_iter;
+    int m_iter = 0;
+
+    //! Number of calls to the equilibrate methods from outside of this class
+    int m_nSolves = 0;
+
+    //! Nesting depth of the equilibrate methods currently being evaluated
+    int m_solveDepth = 0;
 
     //! Vector of indices for species that are included in the calculation. This
     //! is used to exclude pure-phase species with invalid thermo data
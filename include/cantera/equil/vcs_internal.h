@@ -70,6 +70,12 @@ public:
 
     //! Time spent in the vcs suite of programs
     double T_Time_vcs;
+
+    //! Total number of phase stability tests
+    int T_Calls_phaseStability;
+
+    //! Total time spent in phase stability tests
+    double T_Time_phaseStability;
 };
 
 //! Definition of the function pointer for the root finder
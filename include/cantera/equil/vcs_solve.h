@@ -742,6 +742,18 @@ public:
     //! Fully specify the problem to be solved
     void vcs_prob_specifyFully();
 
+    //! Reload the species mole numbers and the required element abundances
+    //! from the MultiPhase object.
+    /*!
+     * This allows the same VCS_SOLVE object, including its work arrays, to be
+     * used to solve a sequence of problems for the same set of phases with
+     * different initial compositions. The original ordering of the species and
+     * elements is restored, so that the solution does not depend on the
+     * problems solved previously.
+     * @since New in %Cantera 3.1.
+     */
+    void vcs_prob_reload();
+
 private:
     //! Zero out the concentration of a species.
     /*!
@@ -75,6 +75,11 @@ shared_ptr<Kinetics> newKinetics(const vector<shared_ptr<ThermoPhase>>& phases,
 /**
  * Add reactions to a Kinetics object.
  *
+ * The Reaction objects for each section of reactions are created first, which
+ * can be done concurrently (see setReactionSetupThreads()), and then added to
+ * the Kinetics object in the order in which they are defined. Errors are
+ * reported in the same order.
+ *
  * @param kin        The Kinetics object to be initialized
  * @param phaseNode  Phase entry for the phase where the reactions occur. This
  *     phase definition is used to determine the source of the reactions added
@@ -85,6 +90,23 @@ shared_ptr<Kinetics> newKinetics(const vector<shared_ptr<ThermoPhase>>& phases,
 void addReactions(Kinetics& kin, const AnyMap& phaseNode,
                   const AnyMap& rootNode=AnyMap());
 
+//! Set the maximum number of threads used by addReactions() to create Reaction
+//! objects.
+/*!
+ * By default, only the calling thread is used. If zero, the number of concurrent
+ * threads supported by the hardware is used. Each thread creates at least 200
+ * reactions, so smaller mechanisms are set up by the calling thread only.
+ * Reactions from input files which load extensions are always created by the
+ * calling thread.
+ *
+ * Warnings issued while creating reactions are passed to the Logger from the
+ * thread creating the reaction, so this option should only be used with
+ * loggers that can be called from any thread.
+ *
+ * @since New in %Cantera 3.1.
+ */
+void setReactionSetupThreads(size_t nThreads);
+
 //! @}
 
 }
@@ -39,6 +39,12 @@ public:
     void reinitialize(double t0, FuncEval& func) override;
     void integrate(double tout) override;
     double step(double tout) override;
+    double currentTime() const override {
+        return m_time;
+    }
+    bool rootDirectionsSupported() const override {
+        return true;
+    }
     double& solution(size_t k) override;
     double* solution() override;
     double* derivative(double tout, int n) override;
@@ -89,6 +95,10 @@ protected:
 private:
     void sensInit(double t0, FuncEval& func);
 
+    //! Update the solution time and #m_rootInfo after CVODES stopped at a zero
+    //! crossing of one of the root functions at time *troot*.
+    void handleRoot(double troot);
+
     //! Check whether a CVODES method indicated an error. If so, throw an exception
     //! containing the method name and the error code stashed by the cvodes_err() function.
     void checkError(long flag, const string& ctMethod, const string& cvodesMethod) const;
@@ -0,0 +1,179 @@
+/**
+ *  @file ExtrapolationIntegrator.h
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_EXTRAPOLATIONINTEGRATOR_H
+#define CT_EXTRAPOLATIONINTEGRATOR_H
+
+#include "cantera/numerics/Integrator.h"
+#include "cantera/numerics/eigen_dense.h"
+
+namespace Cantera
+{
+
+/**
+ * A lightweight, linearly implicit extrapolation integrator for small stiff ODE
+ * systems.
+ *
+ * Each step of size @f$ h @f$ is computed with the linearly implicit Euler method
+ * @f[
+ *     (I - h_j J) (y_{i+1} - y_i) = h_j f(t_i, y_i)
+ * @f]
+ * using @f$ n_j = j @f$ substeps of size @f$ h_j = h / n_j @f$ for
+ * @f$ j = 1, \ldots, k @f$, followed by Aitken-Neville extrapolation of the results
+ * to order @f$ k @f$ (see Hairer and Wanner, *Solving Ordinary Differential
+ * Equations II*, Section IV.9). The Jacobian @f$ J @f$ is evaluated once per step,
+ * using FuncEval::getJacobian if available or finite differences otherwise. Since
+ * the method retains its order for any fixed matrix @f$ J @f$, approximate
+ * Jacobians only affect stability, not accuracy. The local error is estimated from
+ * the difference between the two highest-order extrapolated solutions, and the step
+ * size is adapted to keep the weighted RMS norm of this estimate below one.
+ *
+ * The extrapolation order is fixed and set with setMaxOrder() (default 6). All work
+ * arrays are allocated by initialize(), so reinitialize() and the integration
+ * itself do not allocate memory. The method avoids the setup cost of
+ * CVodesIntegrator and is intended for problems with a few tens of equations, for
+ * example the chemistry substeps of an operator-split CFD calculation. Sensitivity
+ * analysis and iterative linear solvers are not supported.
+ *
+ * Zero crossings of the root functions defined by FuncEval::evalRootFunctions are
+ * checked after each step and located using the Illinois algorithm on a cubic
+ * Hermite interpolant of the solution. The integration stops at the crossing and
+ * continues from the interpolated state.
+ *
+ * @since New in %Cantera 3.1.
+ * @ingroup odeGroup
+ */
+class ExtrapolationIntegrator : public Integrator
+{
+public:
+    ExtrapolationIntegrator() = default;
+
+    void setTolerances(double reltol, size_t n, double* abstol) override;
+    void setTolerances(double reltol, double abstol) override;
+    void setSensitivityTolerances(double reltol, double abstol) override {}
+    void setLinearSolverType(const string& linSolverType) override;
+    string linearSolverType() const override {
+        return "DENSE";
+    }
+    void setPreconditioner(shared_ptr<PreconditionerBase> preconditioner) override;
+    void initialize(double t0, FuncEval& func) override;
+    void reinitialize(double t0, FuncEval& func) override;
+    void integrate(double tout) override;
+    double step(double tout) override;
+    double currentTime() const override {
+        return m_t;
+    }
+    double& solution(size_t k) override;
+    double* solution() override;
+    double* derivative(double tout, int n) override;
+    int lastOrder() const override;
+    int nEquations() const override {
+        return static_cast<int>(m_neq);
+    }
+    int nEvals() const override {
+        return m_nEvals;
+    }
+    int maxOrder() const override {
+        return m_order;
+    }
+    void setMaxOrder(int n) override;
+
+    //! The method type is fixed; this method has no effect.
+    void setMethod(MethodType t) override {}
+
+    void setMaxStepSize(double hmax) override;
+    void setMinStepSize(double hmin) override;
+    void setMaxErrTestFails(int n) override;
+    void setMaxSteps(int nmax) override;
+    int maxSteps() override {
+        return m_maxSteps;
+    }
+    int nSensParams() override {
+        return 0;
+    }
+    AnyMap solverStats() const override;
+
+protected:
+    //! Take one successful step towards *tout*, without stepping past it if
+    //! *clip* is `true`. Steps are retried with a reduced step size until the error
+    //! test is passed.
+    void takeStep(double tout, bool clip);
+
+    //! Attempt a single extrapolation step of size *h* from the current state,
+    //! storing the result in #m_ynew.
+    //! @returns the weighted RMS norm of the error estimate, or a negative value if
+    //!     the right-hand side could not be evaluated.
+    double attemptStep(double h);
+
+    //! Evaluate the right-hand side at (*t*, *y*), storing the result in *ydot*.
+    //! @returns `false` after a recoverable error.
+    bool evalRHS(double t, double* y, double* ydot);
+
+    //! Update #m_jac at the current state, for a step of size *h*.
+    void evalJacobian(double h);
+
+    //! Weighted RMS norm of *v*, using error weights based on the current state.
+    double weightedNorm(const Eigen::VectorXd& v) const;
+
+    //! Estimate the size of the initial step.
+    double initialStepSize(double tout);
+
+    //! Check for zero crossings of the root functions during the step which
+    //! started at *t0* and ended at the current time. If any are found, locate the
+    //! earliest one and set the current time and state to the crossing.
+    void findRoots(double t0);
+
+    //! Evaluate the cubic Hermite interpolant of the solution between *t0* and the
+    //! current time at time *t*, storing the result in #m_ysub.
+    void interpolate(double t0, double t);
+
+    FuncEval* m_func = nullptr;
+    size_t m_neq = 0;
+    int m_order = 6; //!< Number of extrapolation stages
+    double m_t = 0.0; //!< Current time, corresponding to #m_y
+    double m_h = 0.0; //!< Step size to be used for the next step
+
+    double m_reltol = 1e-9;
+    double m_abstols = 1e-15;
+    vector<double> m_abstol; //!< Absolute tolerances for each component
+    double m_hmax = 0.0; //!< Maximum step size; 0 means unlimited
+    double m_hmin = 0.0; //!< Minimum step size
+    int m_maxSteps = 20000;
+    int m_maxErrTestFails = 7;
+
+    Eigen::VectorXd m_y; //!< Current state
+    Eigen::VectorXd m_ynew; //!< Candidate state at the end of a step
+    Eigen::VectorXd m_f0; //!< Right-hand side at the start of the step
+    Eigen::VectorXd m_f; //!< Right-hand side work array
+    Eigen::VectorXd m_ysub; //!< State during the substeps
+    Eigen::VectorXd m_dy; //!< Substep increment
+    Eigen::VectorXd m_err; //!< Error estimate
+    Eigen::VectorXd m_dky; //!< Derivative output
+    Eigen::MatrixXd m_table; //!< Extrapolation table (one column per stage)
+    Eigen::MatrixXd m_jac; //!< Jacobian at the start of the step
+    Eigen::MatrixXd m_iter; //!< Iteration matrix @f$ I - h_j J @f$
+    Eigen::PartialPivLU<Eigen::MatrixXd> m_lu;
+
+    size_t m_nRoots = 0; //!< Number of root functions
+    Eigen::VectorXd m_yold; //!< State at the start of the last step
+    Eigen::VectorXd m_fnew; //!< Right-hand side at the end of the last step
+    Eigen::VectorXd m_gPrev; //!< Root functions at the start of the step
+    Eigen::VectorXd m_gLo; //!< Root functions at the lower end of the bracket
+    Eigen::VectorXd m_gHi; //!< Root functions at the upper end of the bracket
+    Eigen::VectorXd m_gMid; //!< Root functions at the trial point
+
+    // Solver statistics
+    int m_nSteps = 0;
+    int m_nEvals = 0;
+    int m_nJacEvals = 0;
+    int m_nErrTestFails = 0;
+    int m_nLinSetups = 0;
+};
+
+}
+
+#endif
@@ -137,6 +137,65 @@ public:
      */
     int preconditioner_solve_nothrow(double* rhs, double* output);
 
+    //! Returns `true` if getJacobian() provides the Jacobian of the right-hand side
+    //! function, in which case integrators may use it instead of approximating the
+    //! Jacobian by finite differences.
+    //! @since New in %Cantera 3.1.
+    virtual bool hasJacobian() const {
+        return false;
+    }
+
+    /**
+     * Evaluate the Jacobian of the right-hand-side ODE function with respect to the
+     * state vector, @f$ J_{ij} = \partial \dot{y}_i / \partial y_j @f$.
+     * @param[in] t time.
+     * @param[in] y solution vector, length neq()
+     * @param[out] jac Jacobian matrix in column-major order, length neq() * neq()
+     * @since New in %Cantera 3.1.
+     */
+    virtual void getJacobian(double t, double* y, double* jac) {
+        throw NotImplementedError("FuncEval::getJacobian");
+    }
+
+    //! Number of root functions whose zero crossings are located by the
+    //! integrator.
+    //! @since New in %Cantera 3.1.
+    virtual size_t nRootFunctions() const {
+        return 0;
+    }
+
+    /**
+     * Evaluate the root functions, whose zero crossings are located by the
+     * integrator and reported through Integrator::rootInfo().
+     * @param[in] t time.
+     * @param[in] y solution vector, length neq()
+     * @param[out] gout values of the root functions, length nRootFunctions()
+     * @since New in %Cantera 3.1.
+     */
+    virtual void evalRootFunctions(double t, double* y, double* gout) {
+        throw NotImplementedError("FuncEval::evalRootFunctions");
+    }
+
+    //! Fill in *dirs* with the direction of the zero crossings to be located for
+    //! each root function: +1 for increasing, -1 for decreasing, and 0 for both
+    //! directions (the default). Integrators that do not support this (see
+    //! Integrator::rootDirectionsSupported) report crossings in both directions.
+    //! @param[out] dirs  root directions, length nRootFunctions()
+    //! @since New in %Cantera 3.1.
+    virtual void getRootDirections(int* dirs) const {
+        for (size_t i = 0; i < nRootFunctions(); i++) {
+            dirs[i] = 0;
+        }
+    }
+
+    //! Evaluate the root functions using return code to indicate status.
+    /*!
+     * Errors are handled as in evalNoThrow().
+     *  @returns 0 for a successful evaluation; -1 after an error.
+     *  @since New in %Cantera 3.1.
+     */
+    int evalRootFunctionsNoThrow(double t, double* y, double* gout);
+
     //! Fill in the vector *y* with the current state of the system.
     //! Used for getting the initial state for ODE systems.
     virtual void getState(double* y) {
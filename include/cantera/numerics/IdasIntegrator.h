@@ -39,6 +39,9 @@ public:
     void reinitialize(double t0, FuncEval& func) override;
     void integrate(double tout) override;
     double step(double tout) override;
+    double currentTime() const override {
+        return m_time;
+    }
     double& solution(size_t k) override;
     double* solution() override;
     int nEquations() const override {
@@ -166,6 +166,34 @@ public:
         return 0.0;
     }
 
+    //! The time corresponding to the current solution. This is the time reached by
+    //! the last call to integrate() or step(), which precedes the output time if
+    //! the integration was stopped by a root function (see rootInfo()).
+    //! @since New in %Cantera 3.1.
+    virtual double currentTime() const {
+        warn("currentTime");
+        return 0.0;
+    }
+
+    //! Information on the root functions defined by FuncEval::evalRootFunctions
+    //! at the end of the last call to integrate() or step(). Integrators that
+    //! support root finding stop at the first zero crossing of any root function.
+    //! In that case, the returned vector has one entry per root function, which is
+    //! +1 for each function that crossed zero while increasing, -1 for each
+    //! function that crossed zero while decreasing, and 0 otherwise. If no zero
+    //! crossing was found, the returned vector is empty.
+    //! @since New in %Cantera 3.1.
+    const vector<int>& rootInfo() const {
+        return m_rootInfo;
+    }
+
+    //! Returns `true` if the integrator only locates zero crossings in the
+    //! directions given by FuncEval::getRootDirections().
+    //! @since New in %Cantera 3.1.
+    virtual bool rootDirectionsSupported() const {
+        return false;
+    }
+
     //! The current value of the solution of equation k.
     virtual double& solution(size_t k) {
         warn("solution");
@@ -299,6 +327,8 @@ protected:
     shared_ptr<PreconditionerBase> m_preconditioner;
     //! Type of preconditioning used in applyOptions
     PreconditionerSide m_prec_side = PreconditionerSide::NO_PRECONDITION;
+    //! Root function information returned by rootInfo()
+    vector<int> m_rootInfo;
     // methods for DAE solvers
 
 private:
@@ -312,7 +342,7 @@ private:
 // defined in Integrators.cpp
 
 //! Create new Integrator object
-//! @param itype Integration mode; either @c CVODE or @c IDA
+//! @param itype Integration mode; one of @c CVODE, @c IDA or @c Extrapolation
 //! @ingroup odeGroup
 Integrator* newIntegrator(const string& itype);
 
@@ -139,9 +139,12 @@ public:
      * @param basis  Output mass ("Y"/"mass") or mole ("X"/"mole") fractions;
      *      if not specified (default=""), the native basis of the underlying
      *      ThermoPhase manager is used - @see nativeState (CSV only)
+     * @param binary  Store large numeric arrays as base64-encoded binary blocks;
+     *      optional (default=false; YAML only); see SolutionArray::save
      */
     void save(const string& fname, const string& name, const string& desc,
-              bool overwrite=false, int compression=0, const string& basis="");
+              bool overwrite=false, int compression=0, const string& basis="",
+              bool binary=false);
 
     /**
      * Save the residual of the current solution to a container file.
@@ -1771,87 +1771,13 @@ private:
     //! derivative of gfunc(x), so I renamed it. Vector index is counterIJ
     mutable vector<double> m_h2func_IJ;
 
-    //! Intermediate variable called BMX in Pitzer's paper. This is the basic
-    //! cation - anion interaction. Vector index is counterIJ
-    mutable vector<double> m_BMX_IJ;
+    //! E-theta, the electrostatic unsymmetrical mixing term for a pair of ions
+    //! with charges of the same sign. Vector index is counterIJ
+    mutable vector<double> m_Etheta_IJ;
 
-    //! Derivative of BMX_IJ wrt T. Vector index is counterIJ
-    mutable vector<double> m_BMX_IJ_L;
-
-    //! Derivative of BMX_IJ wrt TT. Vector index is counterIJ
-    mutable vector<double> m_BMX_IJ_LL;
-
-    //! Derivative of BMX_IJ wrt P. Vector index is counterIJ
-    mutable vector<double> m_BMX_IJ_P;
-
-    //! Intermediate variable called BprimeMX in Pitzer's paper. Vector index is
-    //! counterIJ
-    mutable vector<double> m_BprimeMX_IJ;
-
-    //! Derivative of BprimeMX wrt T. Vector index is counterIJ
-    mutable vector<double> m_BprimeMX_IJ_L;
-
-    //! Derivative of BprimeMX wrt TT. Vector index is counterIJ
-    mutable vector<double> m_BprimeMX_IJ_LL;
-
-    //! Derivative of BprimeMX wrt P. Vector index is counterIJ
-    mutable vector<double> m_BprimeMX_IJ_P;
-
-    //! Intermediate variable called BphiMX in Pitzer's paper. Vector index is
-    //! counterIJ
-    mutable vector<double> m_BphiMX_IJ;
-
-    //! Derivative of BphiMX_IJ wrt T. Vector index is counterIJ
-    mutable vector<double> m_BphiMX_IJ_L;
-
-    //! Derivative of BphiMX_IJ wrt TT. Vector index is counterIJ
-    mutable vector<double> m_BphiMX_IJ_LL;
-
-    //! Derivative of BphiMX_IJ wrt P. Vector index is counterIJ
-    mutable vector<double> m_BphiMX_IJ_P;
-
-    //! Intermediate variable called Phi in Pitzer's paper. Vector index is
-    //! counterIJ
-    mutable vector<double> m_Phi_IJ;
-
-    //! Derivative of m_Phi_IJ wrt T. Vector index is counterIJ
-    mutable vector<double> m_Phi_IJ_L;
-
-    //! Derivative of m_Phi_IJ wrt TT. Vector index is counterIJ
-    mutable vector<double> m_Phi_IJ_LL;
-
-    //! Derivative of m_Phi_IJ wrt P. Vector index is counterIJ
-    mutable vector<double> m_Phi_IJ_P;
-
-    //! Intermediate variable called Phiprime in Pitzer's paper. Vector index is
-    //! counterIJ
-    mutable vector<double> m_Phiprime_IJ;
-
-    //! Intermediate variable called PhiPhi in Pitzer's paper. Vector index is
-    //! counterIJ
-    mutable vector<double> m_PhiPhi_IJ;
-
-    //! Derivative of m_PhiPhi_IJ wrt T. Vector index is counterIJ
-    mutable vector<double> m_PhiPhi_IJ_L;
-
-    //! Derivative of m_PhiPhi_IJ wrt TT. Vector index is counterIJ
-    mutable vector<double> m_PhiPhi_IJ_LL;
-
-    //! Derivative of m_PhiPhi_IJ wrt P. Vector index is counterIJ
-    mutable vector<double> m_PhiPhi_IJ_P;
-
-    //! Intermediate variable called CMX in Pitzer's paper. Vector index is
+    //! Derivative of E-theta with respect to the ionic strength. Vector index is
     //! counterIJ
-    mutable vector<double> m_CMX_IJ;
-
-    //! Derivative of m_CMX_IJ wrt T. Vector index is counterIJ
-    mutable vector<double> m_CMX_IJ_L;
-
-    //! Derivative of m_CMX_IJ wrt TT. Vector index is counterIJ
-    mutable vector<double> m_CMX_IJ_LL;
-
-    //! Derivative of m_CMX_IJ wrt P. Vector index is counterIJ
-    mutable vector<double> m_CMX_IJ_P;
+    mutable vector<double> m_Etheta_prime_IJ;
 
     //! Intermediate storage of the activity coefficient itself. Vector index is
     //! the species index
@@ -1974,33 +1900,54 @@ private:
     /**
      *  This is the main routine in the whole module. It calculates the molality
      *  based activity coefficients for the solutes, and the activity of water.
+     *  The functions of the ionic strength used in the binary and mixing terms
+     *  are stored for use by s_updatePitzer_dlnMolalityActCoeff().
      */
     void s_updatePitzer_lnMolalityActCoeff() const;
 
-    //! Calculates the temperature derivative of the natural logarithm of the
-    //! molality activity coefficients.
+    //! Calculate the first and second temperature derivatives and the pressure
+    //! derivative of the Pitzer portion of the natural logarithm of the molality
+    //! activity coefficients in a single pass over the interactions.
     /*!
-     * Public function makes sure that all dependent data is
-     * up to date, before calling a private function
-     */
-    void s_updatePitzer_dlnMolalityActCoeff_dT() const;
-
-    /**
-     * This function calculates the temperature second derivative of the
-     * natural logarithm of the molality activity coefficients.
-     *
-     * It is assumed that the Pitzer activity coefficient and first derivative
-     * routine are called immediately preceding the call to this routine.
-     */
-    void s_updatePitzer_d2lnMolalityActCoeff_dT2() const;
-
-    //! Calculates the Pressure derivative of the natural logarithm of the
-    //! molality activity coefficients.
-    /*!
-     * It is assumed that the Pitzer activity coefficient and first derivative
-     * routine are called immediately preceding the calling of this routine.
-     */
-    void s_updatePitzer_dlnMolalityActCoeff_dP() const;
+     * The results are stored in m_dlnActCoeffMolaldT_Unscaled,
+     * m_d2lnActCoeffMolaldT2_Unscaled and m_dlnActCoeffMolaldP_Unscaled, before
+     * the cropping and pH scaling are applied. The activity coefficients are
+     * updated first, if necessary.
+     */
+    void s_updatePitzer_dlnMolalityActCoeff() const;
+
+    //! Coefficients and results for one of the quantities evaluated by
+    //! calcPitzerTerms(): either the natural logarithm of the activity
+    //! coefficients or one of its derivatives with respect to temperature or
+    //! pressure. The coefficients point to the corresponding member arrays,
+    //! for example #m_Beta0MX_ij or #m_Beta0MX_ij_L.
+    struct PitzerTerms {
+        const double* beta0;
+        const double* beta1;
+        const double* beta2;
+        const double* Cphi;
+        const double* theta;
+        const double* psi;
+        const Array2D* lambda;
+        const double* mu;
+        double Aphi; //!< A_Debye / 3, or its derivative
+        //! Include the E-theta terms, which depend only on the ionic strength
+        bool etheta;
+        //! Output: contribution to the log activity coefficients of the solutes
+        double* lnGamma;
+        //! Output: sum of the terms in the osmotic coefficient, such that
+        //! @f$ \sum_i m_i (\phi - 1) = 2 \cdot @f$ `osmoticSum`
+        double osmoticSum;
+    };
+
+    //! Evaluate the sums over the packed interaction lists for the quantities
+    //! in *terms*, using the stored functions of the ionic strength.
+    void calcPitzerTerms(PitzerTerms* terms, size_t nTerms) const;
+
+    //! Build the packed lists of interactions used by calcPitzerTerms() and
+    //! s_updatePitzer_CoeffWRTemp() from the charges of the species and the
+    //! nonzero interaction parameters.
+    void initPitzerInteractions() const;
 
     //! Calculates the Pitzer coefficients' dependence on the temperature.
     /*!
@@ -2014,6 +1961,45 @@ private:
      */
     void s_updatePitzer_CoeffWRTemp(int doDerivs = 2) const;
 
+    //! Temperature at which the Pitzer coefficients were last evaluated by
+    //! s_updatePitzer_CoeffWRTemp(). Set to NaN when an interaction parameter
+    //! is modified, which also causes the interaction lists to be rebuilt.
+    mutable double m_pitzerTemp = NAN;
+
+    //! Pair of species (*i*, *j*) and the corresponding index *c* into the
+    //! binary interaction arrays, or a neutral species *i* and a species *j* with
+    //! *c* = 0 for the lambda interactions
+    struct PitzerPair {
+        size_t i, j, c;
+    };
+
+    //! Triplet of species (*i*, *j*, *k*) and the corresponding index *n* into
+    //! #m_Psi_ijk
+    struct PitzerTriplet {
+        size_t i, j, k, n;
+    };
+
+    //! Cation-anion pairs, with the cation first
+    mutable vector<PitzerPair> m_pairsCA;
+
+    //! Pairs of distinct ions with charges of the same sign, with *i* < *j*
+    mutable vector<PitzerPair> m_pairsLike;
+
+    //! Nonzero ternary interactions: psi interactions with two cations *i* < *j*
+    //! and an anion *k* or two anions *i* < *j* and a cation *k*, and zeta
+    //! interactions of a neutral species *i*, a cation *j*, and an anion *k*
+    mutable vector<PitzerTriplet> m_psiTriplets;
+
+    //! Nonzero lambda interactions of a neutral species *i* with species *j*
+    mutable vector<PitzerPair> m_lambdaPairs;
+
+    //! Neutral solute species
+    mutable vector<size_t> m_neutralSolutes;
+
+    //! Indices into #m_Psi_ijk of all nonzero psi and zeta parameters,
+    //! including the permutations stored by setPsi()
+    mutable vector<size_t> m_psiIndices;
+
     //! Calculate the lambda interactions.
     /*!
      * Calculate E-lambda terms for charge combinations of like sign, using
@@ -549,10 +549,67 @@ public:
 
     //! @}
 
+    //! @name Batched Temperature Inversion
+    //!
+    //! These methods find the temperatures of a set of states of this phase given
+    //! the specific enthalpy or internal energy and the mass fractions of each
+    //! state, without modifying the state of the phase. They are intended for
+    //! applications such as CFD codes, where the temperature is recovered from the
+    //! energy in each cell.
+    //!
+    //! The temperature is found using Newton's method, safeguarded by bisection,
+    //! starting from the temperatures provided on input (for example, the
+    //! temperatures from the previous iteration of the calling code). If all
+    //! species use NASA 7-coefficient polynomials, the species polynomials are
+    //! first combined into a single polynomial for the mixture, so that each
+    //! Newton iteration costs a few operations instead of an evaluation of the
+    //! properties of all species. The result for each state depends only on the
+    //! inputs for that state, and the operations are performed in a fixed order,
+    //! so the results are reproducible regardless of the number of states in the
+    //! batch.
+    //!
+    //! @param nStates  Number of states
+    //! @param[in] h  Specific enthalpy [J/kg] of each state. Length *nStates*.
+    //! @param[in] u  Specific internal energy [J/kg] of each state. Length
+    //!     *nStates*.
+    //! @param[in] Y  Mass fractions of each state, stored contiguously for each
+    //!     state (that is, `Y[i * nSpecies() + k]` is the mass fraction of species
+    //!     `k` in state `i`). The mass fractions are not normalized.
+    //! @param[in,out] T  On input, the initial guess for the temperature [K] of
+    //!     each state, which must be positive. On output, the temperature of each
+    //!     state. Length *nStates*.
+    //! @param[out] iterations  If not `nullptr`, the number of iterations taken
+    //!     for each state. Length *nStates*.
+    //! @param rtol  Relative tolerance for the change in temperature
+    //! @param maxIter  Maximum number of iterations for each state
+    //! @returns the total number of iterations for all states
+    //! @since New in %Cantera 3.1.
+    //! @{
+
+    //! Find the temperatures of a set of states given their specific enthalpies
+    //! and mass fractions
+    size_t solveTemperatures_HY(size_t nStates, const double* h, const double* Y,
+                                double* T, int* iterations=nullptr,
+                                double rtol=1e-12, int maxIter=50) const;
+
+    //! Find the temperatures of a set of states given their specific internal
+    //! energies and mass fractions
+    size_t solveTemperatures_UY(size_t nStates, const double* u, const double* Y,
+                                double* T, int* iterations=nullptr,
+                                double rtol=1e-12, int maxIter=50) const;
+
+    //! @}
+
     bool addSpecies(shared_ptr<Species> spec) override;
     void setToEquilState(const double* mu_RT) override;
 
 protected:
+    //! Implementation of solveTemperatures_HY() (*doUV* = `false`) and
+    //! solveTemperatures_UY() (*doUV* = `true`).
+    size_t solveTemperatures(size_t nStates, const double* e, const double* Y,
+                             double* T, int* iterations, double rtol, int maxIter,
+                             bool doUV) const;
+
     //! Reference state pressure
     /*!
      *  Value of the reference state pressure in Pascals.
@@ -454,7 +454,149 @@ public:
     double satPressure(double TKelvin) override;
     void getActivityConcentrations(double* c) const override;
 
+    //! @name Vapor-liquid phase split
+    //!
+    //! These methods determine whether the current mixture (the "feed") splits into
+    //! a liquid and a vapor phase described by the same equation of state, and
+    //! compute the compositions of the coexisting phases.
+    //!
+    //! Stability of the feed is determined using the tangent plane distance
+    //! criterion of Michelsen @cite michelsen1982a, with a vapor-like and a
+    //! liquid-like trial phase. If the feed is unstable, the phase split is found by
+    //! successive substitution on the equilibrium ratios @f$ K_k = y_k / x_k @f$,
+    //! where the phase fractions are obtained from the Rachford-Rice equation
+    //! @cite michelsen1982b.
+    //! Both iterations are accelerated by the general dominant eigenvalue method
+    //! (GDEM) of Crowe and Nishio. The initial equilibrium ratios are estimated from
+    //! the critical properties of the pure species, using the correlation for the
+    //! vapor pressure from psatEst().
+    //!
+    //! The equilibrium ratios of the last two-phase result are kept and used as the
+    //! initial estimate for the next call. If the split computed from these values
+    //! converges and lowers the Gibbs free energy, the stability test is skipped,
+    //! which makes repeated calls at nearby conditions inexpensive.
+    //!
+    //! The state of the phase is left at the final temperature and pressure, with
+    //! the composition of the feed and the density of its most stable root.
+    //! @since New in %Cantera 3.1.
+    //! @{
+
+    //! Compute the vapor-liquid equilibrium of the current mixture at the specified
+    //! temperature and pressure (isothermal flash).
+    /*!
+     * @param T        Temperature [K]
+     * @param P        Pressure [Pa]
+     * @param xLiquid  (output) Mole fractions of the liquid phase. Length nSpecies().
+     *                 May be `nullptr`.
+     * @param yVapor   (output) Mole fractions of the vapor phase. Length nSpecies().
+     *                 May be `nullptr`.
+     * @returns the molar vapor fraction. If the feed is stable, both compositions
+     *     are set to the feed composition and the returned value is 0 if the
+     *     feed is in a liquid state and 1 otherwise.
+     */
+    double flashTP(double T, double P, double* xLiquid=nullptr,
+                   double* yVapor=nullptr);
+
+    //! Compute the vapor-liquid equilibrium of the current mixture at the specified
+    //! molar enthalpy and pressure.
+    /*!
+     * The temperature is found using a secant method safeguarded by bisection,
+     * starting from the current temperature, with an isothermal flash at each
+     * iterate.
+     *
+     * @param h        Molar enthalpy of the mixture, including both phases [J/kmol]
+     * @param P        Pressure [Pa]
+     * @param xLiquid  (output) Mole fractions of the liquid phase. May be `nullptr`.
+     * @param yVapor   (output) Mole fractions of the vapor phase. May be `nullptr`.
+     * @returns the molar vapor fraction, as for flashTP()
+     */
+    double flashHP(double h, double P, double* xLiquid=nullptr,
+                   double* yVapor=nullptr);
+
+    //! Discard the equilibrium ratios stored by the previous flash calculation,
+    //! so that the next calculation starts with a stability test, along with the
+    //! cached critical properties of the pure species. Called automatically when
+    //! the equation of state coefficients are modified.
+    void resetFlash() {
+        m_flashLnK.clear();
+        m_flashTc.clear();
+        m_flashPc.clear();
+    }
+
+    //! @}
+
 protected:
+    //! Find the roots of the equation of state for the molar volume at the current
+    //! temperature and composition and the pressure *P*.
+    /*!
+     * @param P      Pressure [Pa]
+     * @param Vroot  (output) Molar volumes [m^3/kmol]. If there are three roots,
+     *               the liquid root is `Vroot[0]` and the gas root is `Vroot[2]`.
+     * @returns the number of roots, as for solveCubic()
+     * @since New in %Cantera 3.1.
+     */
+    virtual int volumeRoots(double P, double Vroot[3]) const;
+
+    //! Set the phase to the composition *x* at the current temperature and
+    //! pressure *P*, and compute the logarithms of the fugacity coefficients.
+    /*!
+     * The density root on the branch *branch* (FLUID_GAS or FLUID_LIQUID_0) is used
+     * if there are multiple roots, and the only root otherwise.
+     *
+     * @param P       Pressure [Pa]
+     * @param x       Mole fractions. Length nSpecies().
+     * @param branch  Requested solution branch
+     * @param lnphi   (output) Logarithms of the fugacity coefficients
+     * @returns the density [kg/m^3]
+     * @since New in %Cantera 3.1.
+     */
+    double flashLnPhi(double P, const double* x, int branch, double* lnphi);
+
+    //! Isothermal flash at the current temperature, storing the molar enthalpy of
+    //! the mixture in *hmole*. Used by flashTP() and flashHP().
+    double flashAtT(double P, double* xLiquid, double* yVapor, double& hmole);
+
+    //! Tangent plane stability test for one trial phase.
+    /*!
+     * @param P       Pressure [Pa]
+     * @param z       Feed mole fractions
+     * @param d       @f$ \ln z_k + \ln \phi_k(z) @f$ for the feed
+     * @param branch  Solution branch used for the trial phase
+     * @param lnW     (input/output) Logarithms of the unnormalized mole numbers of
+     *                the trial phase
+     * @returns `true` if the trial phase shows that the feed is unstable
+     */
+    bool flashStability(double P, const vector<double>& z, const vector<double>& d,
+                        int branch, vector<double>& lnW);
+
+    //! Find the phase split for the feed *z* by successive substitution.
+    /*!
+     * @param P     Pressure [Pa]
+     * @param z     Feed mole fractions
+     * @param d     @f$ \ln z_k + \ln \phi_k(z) @f$ for the feed
+     * @param lnK   (input/output) Logarithms of the equilibrium ratios
+     * @param beta  (output) Molar vapor fraction
+     * @param x     (output) Mole fractions of the liquid phase
+     * @param y     (output) Mole fractions of the vapor phase
+     * @returns `true` if a non-trivial split with a vapor fraction between 0 and
+     *     1 which lowers the Gibbs free energy of the feed was found
+     */
+    bool flashSplit(double P, const vector<double>& z, const vector<double>& d,
+                    vector<double>& lnK, double& beta, vector<double>& x,
+                    vector<double>& y);
+
+    //! Equilibrium ratios from the last two-phase flash result, used as the
+    //! initial estimate for the next flash calculation. Empty if not available.
+    vector<double> m_flashLnK;
+
+    //! Critical temperatures of the pure species, used to estimate initial
+    //! equilibrium ratios. Evaluated the first time they are needed and cleared by
+    //! resetFlash().
+    vector<double> m_flashTc;
+
+    //! Critical pressures of the pure species; see #m_flashTc.
+    vector<double> m_flashPc;
+
     //! Calculate the pressure and the pressure derivative given the temperature
     //! and the molar volume
     /*!
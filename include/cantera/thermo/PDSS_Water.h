@@ -147,6 +147,7 @@ public:
         return &m_waterProps;
     }
 
+    void initThermo() override;
     void getParameters(AnyMap& eosNode) const override;
 
     //! @}
@@ -200,15 +200,19 @@ protected:
 
     //! Calculate temperature derivative @f$ d(a \alpha)/dT @f$
     /*!
-     *  These are stored internally.
+     *  This value is computed by updateMixingExpressions() and stored internally.
      */
-    double daAlpha_dT() const;
+    double daAlpha_dT() const {
+        return m_daAlpha_dT;
+    }
 
     //! Calculate second derivative @f$ d^2(a \alpha)/dT^2 @f$
     /*!
-     *  These are stored internally.
+     *  This value is computed by updateMixingExpressions() and stored internally.
      */
-    double d2aAlpha_dT2() const;
+    double d2aAlpha_dT2() const {
+        return m_d2aAlpha_dT2;
+    }
 
 public:
 
@@ -227,13 +231,21 @@ public:
      *  The @f$ a @f$ and the @f$ b @f$ parameters depend on the mole fraction and the
      *  parameter @f$ \alpha @f$ depends on the temperature. This function updates
      *  the internal numbers based on the state of the object.
+     *
+     *  The species @f$ \alpha_i @f$ and their temperature derivatives and the
+     *  matrix @f$ (a \alpha)_{ij} @f$ are only recomputed when the temperature
+     *  changes. The partial sums @f$ \sum_j X_j (a \alpha)_{ij} @f$ used by the
+     *  partial molar properties and the mixture values of @f$ a \alpha @f$ and its
+     *  first and second temperature derivatives are then computed together in a
+     *  single pass over the matrix.
      */
     void updateMixingExpressions() override;
 
     //! Calculate the @f$ a @f$, @f$ b @f$, and @f$ \alpha @f$ parameters given the temperature
     /*!
      * This function doesn't change the internal state of the object, so it is a
-     * const function.  It does use the stored mole fractions in the object.
+     * const function. It returns the values computed for the current temperature
+     * and mole fractions by updateMixingExpressions().
      *
      * @param aCalc (output)  Returns the a value
      * @param bCalc (output)  Returns the b value.
@@ -246,6 +258,9 @@ public:
     //! Prepare variables and call the function to solve the cubic equation of state
     int solveCubic(double T, double pres, double a, double b, double aAlpha,
                    double Vroot[3]) const;
+
+    int volumeRoots(double P, double Vroot[3]) const override;
+
 protected:
     //! Value of @f$ b @f$ in the equation of state
     /*!
@@ -270,9 +285,20 @@ protected:
     vector<double> m_b_coeffs;
     vector<double> m_kappa;
     vector<double> m_acentric; //!< acentric factor for each species, length #m_kk
-    mutable vector<double> m_dalphadT;
-    mutable vector<double> m_d2alphadT2;
+    vector<double> m_dalphadT;
+    vector<double> m_d2alphadT2;
     vector<double> m_alpha;
+    vector<double> m_sqrtAlpha; //!< Square root of #m_alpha, length #m_kk
+
+    //! Temperature at which #m_alpha, its derivatives and #m_aAlpha_binary were
+    //! last evaluated. Set to NaN when the species coefficients change.
+    double m_alphaTemp = NAN;
+
+    //! Value of @f$ d(a \alpha)/dT @f$ at the current state
+    double m_daAlpha_dT = 0.0;
+
+    //! Value of @f$ d^2(a \alpha)/dT^2 @f$ at the current state
+    double m_d2aAlpha_dT2 = 0.0;
 
     // Matrices for Binary coefficients a_{i,j} and {a*alpha}_{i.j} are saved in an
     // array form. Size = (m_kk, m_kk).
@@ -286,8 +312,14 @@ protected:
 
     double m_Vroot[3] = {0.0, 0.0, 0.0};
 
-    //! Temporary storage - length = m_kk.
-    mutable vector<double> m_pp;
+    //! Partial sums @f$ \sum_j X_j (a \alpha)_{kj} @f$ at the current state.
+    //! Length = m_kk.
+    vector<double> m_pp;
+
+    //! Partial sums @f$ \sum_j X_j (a \alpha)_{kj} \alpha'_j / \alpha_j @f$ at the
+    //! current state, where the prime denotes the temperature derivative.
+    //! Length = m_kk.
+    vector<double> m_ppdT;
 
     // Partial molar volumes of the species
     mutable vector<double> m_partialMolarVolumes;
@@ -356,6 +356,20 @@ public:
     //!     @since New in %Cantera 3.0.
     void setState_TD(double t, double rho);
 
+    //! Set the temperature (K), density (kg/m^3), and mass fractions without
+    //! normalizing the mass fractions.
+    //! This is intended for callers such as reactor models and CFD codes which
+    //! already maintain a consistent state. The mass fractions are copied and the
+    //! mean molecular weight computed in a single pass, and the temperature is only
+    //! set if it differs from the current value, which skips the corresponding
+    //! updates of temperature-dependent properties done by some phase models when
+    //! only the composition or density changes.
+    //!     @param t     Temperature in kelvin
+    //!     @param rho   Density (kg/m^3)
+    //!     @param y     Mass fractions. Length is m_kk.
+    //!     @since New in %Cantera 3.1.
+    void setState_TDY_NoNorm(double t, double rho, const double* y);
+
     //! @} end group set thermo state
 
     //! Molecular weight of species @c k.
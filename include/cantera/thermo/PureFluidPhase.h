@@ -16,6 +16,7 @@
 
 #include "ThermoPhase.h"
 #include "cantera/tpx/Sub.h"
+#include "cantera/tpx/PropertyTable.h"
 
 namespace Cantera
 {
@@ -25,6 +26,14 @@ namespace Cantera
  * The object inherits from ThermoPhase. However, it's built on top of the tpx
  * package.
  *
+ * Optionally, properties can be evaluated from a tpx::PropertyTable, which is
+ * built the first time it is needed and replaces the iterative property
+ * evaluations of the tpx package by table lookups. This is enabled using
+ * setTabulated() or by adding the field `tabulated: true` to the phase definition
+ * in the YAML input file. States which cannot be evaluated using the table are
+ * handled by the tpx package as usual. Building the table takes on the order of a
+ * second, so this option pays off when many states are evaluated.
+ *
  * @ingroup thermoprops
  */
 class PureFluidPhase : public ThermoPhase
@@ -121,6 +130,18 @@ public:
     //! Returns a reference to the substance object
     tpx::Substance& TPX_Substance();
 
+    //! Enable or disable the evaluation of properties using a tpx::PropertyTable.
+    //! @param tabulated  `true` to use the table
+    //! @param nT, nRho  Number of grid points in temperature and density
+    //! @since New in %Cantera 3.1.
+    void setTabulated(bool tabulated, size_t nT=200, size_t nRho=300);
+
+    //! Returns `true` if properties are evaluated using a tpx::PropertyTable.
+    //! @since New in %Cantera 3.1.
+    bool tabulated() const {
+        return m_tabulated;
+    }
+
     //! @name Properties of the Standard State of the Species in the Solution
     //!
     //! The standard state of the pure fluid is defined as the real properties
@@ -201,6 +222,14 @@ protected:
      */
     void Set(tpx::PropertyPair::type n, double x, double y) const;
 
+    //! Return the property table, building it if necessary, or `nullptr` if
+    //! properties are not tabulated.
+    const tpx::PropertyTable* propertyTable() const;
+
+    //! Evaluate the property *ijob* at the current state of the substance, using
+    //! the property table if possible.
+    double prop(tpx::propertyFlag::type ijob) const;
+
 private:
     //! Pointer to the underlying tpx object Substance that does the work
     mutable unique_ptr<tpx::Substance> m_sub;
@@ -213,6 +242,15 @@ private:
 
     //! flag to turn on some printing.
     bool m_verbose = false;
+
+    //! Table used to evaluate properties if #m_tabulated is `true`
+    mutable unique_ptr<tpx::PropertyTable> m_table;
+
+    //! Flag indicating whether properties are evaluated using #m_table
+    bool m_tabulated = false;
+
+    size_t m_nTableT = 200; //!< Number of temperatures in #m_table
+    size_t m_nTableRho = 300; //!< Number of densities in #m_table
 };
 
 }
@@ -171,6 +171,11 @@ public:
      *  The a and the b parameters depend on the mole fraction and the
      *  temperature. This function updates the internal numbers based on the
      *  state of the object.
+     *
+     *  The temperature-dependent coefficients @f$ a_{ij} @f$ are only recomputed
+     *  when the temperature changes. The partial sums @f$ \sum_j X_j a_{ij} @f$
+     *  used by the partial molar properties and the mixture values of @f$ a @f$
+     *  and @f$ da/dT @f$ are then computed together in a single pass.
      */
     void updateMixingExpressions() override;
 
@@ -187,13 +192,19 @@ public:
 
     // Special functions not inherited from MixtureFugacityTP
 
-    double da_dt() const;
+    //! Temperature derivative of the a parameter at the current state, as computed
+    //! by updateMixingExpressions()
+    double da_dt() const {
+        return m_dadT;
+    }
 
     void calcCriticalConditions(double& pc, double& tc, double& vc) const override;
 
     //! Prepare variables and call the function to solve the cubic equation of state
     int solveCubic(double T, double pres, double a, double b, double Vroot[3]) const;
 
+    int volumeRoots(double P, double Vroot[3]) const override;
+
 protected:
     //! Form of the temperature parameterization
     /*!
@@ -214,6 +225,13 @@ protected:
      */
     double m_a_current = 0.0;
 
+    //! Value of da/dT at the current state
+    double m_dadT = 0.0;
+
+    //! Temperature at which #a_vec_Curr_ was last evaluated. Set to NaN when the
+    //! species coefficients change.
+    double m_aTemp = NAN;
+
     vector<double> a_vec_Curr_;
     vector<double> b_vec_Curr_;
 
@@ -230,8 +248,13 @@ protected:
 
     double Vroot_[3] = {0.0, 0.0, 0.0};
 
-    //! Temporary storage - length = m_kk.
-    mutable vector<double> m_pp;
+    //! Partial sums @f$ \sum_j X_j a_{kj} @f$ at the current state.
+    //! Length = m_kk.
+    vector<double> m_pp;
+
+    //! Partial sums @f$ \sum_j X_j da_{kj}/dT @f$ at the current state.
+    //! Length = m_kk.
+    vector<double> m_dppdT;
 
     // Partial molar volumes of the species
     mutable vector<double> m_partialMolarVolumes;
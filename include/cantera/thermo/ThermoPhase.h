@@ -19,6 +19,8 @@
 namespace Cantera
 {
 
+class ChemEquil;
+
 /**
  * @defgroup thermoprops Thermodynamic Properties
  *
@@ -1148,6 +1150,24 @@ public:
      */
     virtual void setState_TPY(double t, double p, const string& y);
 
+    //! Set the temperature (K), pressure (Pa), and mass fractions without
+    //! normalizing the mass fractions.
+    /*!
+     * This is intended for callers such as reactor models and flame solvers
+     * which already maintain a consistent state. The temperature is only set if
+     * it differs from the current value, which avoids repeating updates of
+     * temperature-dependent properties (for example, the reference state and
+     * mixing rules of MixtureFugacityTP phases) when only the composition or
+     * pressure changes. Unlike setState_TPY(), the previous state is not restored
+     * if setting the pressure fails.
+     *
+     * @param t    Temperature (K)
+     * @param p    Pressure (Pa)
+     * @param y    Vector of mass fractions. Length is equal to m_kk.
+     * @since New in %Cantera 3.1.
+     */
+    void setState_TPY_NoNorm(double t, double p, const double* y);
+
     //! Set the temperature (K) and pressure (Pa)
     /*!
      * Setting the pressure may involve the solution of a nonlinear equation.
@@ -1642,12 +1662,20 @@ public:
      *  @param log_level  loglevel Controls amount of diagnostic output.
      *      log_level=0 suppresses diagnostics, and increasingly-verbose
      *      messages are written as loglevel increases.
+     *  @param warm_start  For the ChemEquil solver, use the element potentials
+     *      (and temperature, if it is not held constant) of the last successful
+     *      ChemEquil calculation for this phase as the initial guess, instead
+     *      of estimating them from the current composition. This reduces the
+     *      number of iterations when equilibrating a sequence of similar states.
+     *      If the solver fails to converge from this initial guess, it is
+     *      restarted from a new estimate. Since %Cantera 3.1.
      *
      * @ingroup equilGroup
      */
     void equilibrate(const string& XY, const string& solver="auto",
                      double rtol=1e-9, int max_steps=50000, int max_iter=100,
-                     int estimate_equil=0, int log_level=0);
+                     int estimate_equil=0, int log_level=0,
+                     bool warm_start=false);
 
     //!This method is used by the ChemEquil equilibrium solver.
     /*!
@@ -1993,6 +2021,10 @@ protected:
 
     //! last value of the temperature processed by reference state
     mutable double m_tlast = 0.0;
+
+    //! ChemEquil solver used by equilibrate(), which is kept so that its work
+    //! arrays and last solution can be reused by subsequent calls
+    shared_ptr<ChemEquil> m_chemEquil;
 };
 
 }
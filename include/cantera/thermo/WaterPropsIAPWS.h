@@ -337,6 +337,52 @@ public:
      */
     double psat(double temperature, int waterState = WATER_LIQUID);
 
+    //! Enable or disable the use of tabulated properties to accelerate the
+    //! calculation of the density and the saturation pressure.
+    /*!
+     * In tabulated mode, density() obtains an estimate of the density of the
+     * liquid or supercritical fluid from a table of @f$ \ln \rho @f$ as a function
+     * of @f$ T @f$ and @f$ \ln P @f$, which is evaluated using bicubic Hermite
+     * interpolation. This estimate is refined using Newton iterations on the full
+     * equation of state until the relative correction to the density is less than
+     * *rtol*, which usually requires one or two evaluations of the residual
+     * Helmholtz function compared to 10 to 20 for WaterPropsIAPWSphi::dfind().
+     * Since the final correction is applied, the error in the density is
+     * generally much smaller than *rtol*.
+     *
+     * psat() evaluates @f$ \ln P_{sat} @f$ and the densities of the saturated
+     * liquid and vapor from tables in the variable @f$ z = \sqrt{1 - T/T_c} @f$
+     * using cubic Hermite interpolation, where the density of the requested phase
+     * is then refined as above. The interpolated saturation pressure agrees with
+     * the iterative solution to within its convergence tolerance of about 1e-8.
+     *
+     * The tables cover temperatures from 253.15 K to 1273.15 K and pressures from
+     * 1 kPa to 1 GPa. They are shared by all objects, and are constructed the
+     * first time they are needed, which takes a few tenths of a second. States
+     * outside of the tables, states very close to the critical point, and states
+     * for which the refinement does not converge are evaluated using the
+     * iterative methods.
+     * Densities of the gas phase below the critical temperature are always
+     * evaluated iteratively.
+     *
+     * @param tabulated  `true` to enable tabulated properties
+     * @param rtol  Relative tolerance for the refinement of the density
+     * @since New in %Cantera 3.1.
+     */
+    void setTabulated(bool tabulated=true, double rtol=1e-8);
+
+    //! Returns `true` if tabulated properties are used. See setTabulated().
+    //! @since New in %Cantera 3.1.
+    bool tabulated() const {
+        return m_tabulated;
+    }
+
+    //! Relative tolerance for the density in tabulated mode. See setTabulated().
+    //! @since New in %Cantera 3.1.
+    double tabulationTolerance() const {
+        return m_rtol;
+    }
+
     //! Return the value of the density at the water spinodal point (on the
     //! liquid side) for the current temperature.
     /*!
@@ -419,6 +465,11 @@ private:
     void corr1(double temperature, double pressure, double& densLiq,
                double& densGas, double& pcorr);
 
+    class Table;
+
+    //! Tables used in tabulated mode, which are constructed on first use
+    static const Table& table();
+
     //! pointer to the underlying object that does the calculations.
     mutable WaterPropsIAPWSphi m_phi;
 
@@ -430,6 +481,12 @@ private:
 
     //! Current state of the system
     mutable int iState = -30000;
+
+    //! Use tabulated properties. See setTabulated().
+    bool m_tabulated = false;
+
+    //! Relative tolerance for the density in tabulated mode
+    double m_rtol = 1e-8;
 };
 
 }
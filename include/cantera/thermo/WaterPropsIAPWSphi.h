@@ -118,6 +118,26 @@ public:
      */
     double dfind(double p_red, double tau, double deltaGuess);
 
+    /**
+     * Compute the reduced density, given the reduced pressure and the reduced
+     * temperature, using undamped Newton iterations. Unlike dfind(), no safeguards
+     * are applied, so this function is intended for refining an initial guess
+     * which is already close to the solution.
+     *
+     * @param p_red       Value of the dimensionless pressure
+     * @param tau         Dimensionless temperature = T_c/T
+     * @param deltaGuess  Initial guess for the dimensionless density
+     * @param rtol        Relative tolerance for the correction to the density
+     * @param maxiter     Maximum number of iterations
+     *
+     * @returns the dimensionless density, or 0.0 if the iteration fails to
+     *     converge. The internal polynomials are left at the last iterate rather
+     *     than at the returned value.
+     * @since New in %Cantera 3.1.
+     */
+    double dnewton(double p_red, double tau, double deltaGuess, double rtol,
+                   int maxiter=8);
+
     //! Calculate the dimensionless Gibbs free energy
     double gibbs_RT() const;
 
@@ -163,6 +163,7 @@ public:
     void setDensity(const double dens) override;
 
     void initThermo() override;
+    void getParameters(AnyMap& phaseNode) const override;
 
     //! Get a pointer to a changeable WaterPropsIAPWS object
     WaterPropsIAPWS* getWater() {
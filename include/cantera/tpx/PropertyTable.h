@@ -0,0 +1,187 @@
+//! @file PropertyTable.h
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef TPX_PROPERTYTABLE_H
+#define TPX_PROPERTYTABLE_H
+
+#include "cantera/tpx/Sub.h"
+#include <vector>
+
+namespace tpx
+{
+
+/**
+ * Tabulated properties of a pure substance, used to evaluate properties and to
+ * solve for the state given a pair of properties at the cost of table lookups.
+ *
+ * The single-phase properties @f$ P @f$, @f$ u @f$ and @f$ s @f$ given by the
+ * equation of state are tabulated on a grid which is uniform in @f$ \ln T @f$ and
+ * @f$ \ln \rho @f$, together with their first derivatives and mixed second
+ * derivative, and are evaluated using bicubic Hermite interpolation. Since the
+ * equation of state is evaluated directly at each node, including nodes inside the
+ * saturation dome, the interpolant is continuously differentiable. The
+ * saturation pressure, the densities of the saturated liquid and vapor and their
+ * internal energies and entropies are tabulated as a function of
+ * @f$ z = \sqrt{1 - T/T_c} @f$ and evaluated using cubic Hermite interpolation;
+ * this variable removes the square-root behavior of the coexistence curve near the
+ * critical point. Two-phase states are evaluated using the lever rule.
+ *
+ * States given by one of the property pairs TV, TP, TX, PX, HP, SP, UP, UV, SV,
+ * PV, VH and ST are found using safeguarded one-dimensional root finding on the
+ * interpolated properties, where the phase (and therefore a bracket for the
+ * solution) is determined first from the saturation properties. Methods return
+ * `false` for states outside of the table, for states within a relative distance
+ * of 1e-4 of the critical temperature, and for other property pairs, so that
+ * the caller can fall back to the iterative methods of Substance.
+ *
+ * For the default grid (200 temperatures and 300 densities covering the full
+ * range of the equation of state), the relative differences with respect to the
+ * iterative methods of Substance are typically of order 1e-6 to 1e-5 for density,
+ * enthalpy and entropy, reaching 1e-4 for strongly compressed liquid states, and
+ * of order 1e-3 for the specific heats. Building the table requires about
+ * 500,000 evaluations of the equation of state.
+ *
+ * @since New in %Cantera 3.1.
+ */
+class PropertyTable
+{
+public:
+    //! Build a table for substance *sub*, which is used only during construction.
+    //! @param sub  Substance for which properties are tabulated
+    //! @param Tlow, Thigh  Temperature range [K]
+    //! @param rhoLow, rhoHigh  Density range [kg/m^3]
+    //! @param nT, nRho  Number of grid points in temperature and density
+    PropertyTable(Substance& sub, double Tlow, double Thigh,
+                  double rhoLow, double rhoHigh, size_t nT, size_t nRho);
+
+    //! Build a table for substance *sub* covering the temperature range of its
+    //! equation of state. The density range extends from the smaller of half the
+    //! saturated vapor density at the minimum temperature and 1e-5 times the
+    //! critical density, to 1.1 times the saturated liquid density at the minimum
+    //! temperature.
+    PropertyTable(Substance& sub, size_t nT=200, size_t nRho=300);
+
+    //! Evaluate the property *ijob* of the equilibrium state at temperature *T*
+    //! and density *rho*. Returns NaN if the state is outside of the table.
+    double prop(propertyFlag::type ijob, double T, double rho) const;
+
+    //! Vapor fraction at temperature *T* and density *rho*, defined as for
+    //! Substance::x(), or NaN if the state is outside of the table.
+    double x(double T, double rho) const;
+
+    //! Specific heat at constant volume [J/kg/K]. NaN for two-phase states.
+    double cv(double T, double rho) const;
+
+    //! Specific heat at constant pressure [J/kg/K]. Infinite for two-phase states.
+    double cp(double T, double rho) const;
+
+    //! Thermal expansion coefficient [1/K]. Infinite for two-phase states.
+    double thermalExpansionCoeff(double T, double rho) const;
+
+    //! Isothermal compressibility [1/Pa]. Infinite for two-phase states.
+    double isothermalCompressibility(double T, double rho) const;
+
+    //! Saturation pressure at temperature *T*, or NaN if *T* is outside of the
+    //! table.
+    double Ps(double T) const;
+
+    //! Saturation temperature at pressure *p*, or NaN if *p* is outside of the
+    //! table.
+    double Tsat(double p) const;
+
+    //! Find the temperature *T* and density *rho* of the state given by the
+    //! property pair *XY* with values *x0* and *y0*. Returns `false` if the state
+    //! cannot be determined from the table.
+    bool solve(PropertyPair::type XY, double x0, double y0,
+               double& T, double& rho) const;
+
+    //! Temperature range of the table [K]
+    double Tlow() const {
+        return exp(m_y0);
+    }
+    double Thigh() const {
+        return exp(m_y0 + m_dy * (m_nT - 1));
+    }
+
+    //! Density range of the table [kg/m^3]
+    double rhoLow() const {
+        return exp(m_x0);
+    }
+    double rhoHigh() const {
+        return exp(m_x0 + m_dx * (m_nRho - 1));
+    }
+
+protected:
+    //! Indices of the tabulated single-phase properties
+    enum { iP, iU, iS, nProps };
+
+    //! Indices of the tabulated saturation properties
+    enum { iLogP, iLogRhoF, iLogRhoV, iUF, iUV, iSF, iSV, nSatProps };
+
+    //! Construct the table; see the constructors for the meaning of the arguments.
+    void build(Substance& sub, double Tlow, double Thigh, double rhoLow,
+               double rhoHigh, size_t nT, size_t nRho);
+
+    //! Find the lowest temperature not less than *T* for which the saturation
+    //! properties of *sub* can be evaluated, or the critical temperature if there
+    //! is none.
+    static double lowestSaturationTemp(Substance& sub, double T);
+
+    //! Evaluate the single-phase properties at (*T*, @f$ \ln \rho @f$ = *lr*)
+    //! using the equation of state of *sub*.
+    static void evalSubstance(Substance& sub, double T, double lr, double* f);
+
+    //! Evaluate the saturation properties at temperature *T* using *sub*.
+    static void evalSaturation(Substance& sub, double T, double* g);
+
+    //! Interpolate the single-phase property *k* at (*T*, *lr*), returning the
+    //! value and the derivatives with respect to *T* and *lr* in *out*. Returns
+    //! `false` if the point is outside of the table.
+    bool interpolate(size_t k, double T, double lr, double* out) const;
+
+    //! Single-phase property *ijob* at (*T*, *lr*), or NaN outside of the table.
+    double singleProp(propertyFlag::type ijob, double T, double lr) const;
+
+    //! Property *ijob* of the saturated liquid (*vapor* = `false`) or vapor
+    //! (*vapor* = `true`) computed from the saturation properties *g*.
+    static double satProp(propertyFlag::type ijob, const double* g, bool vapor);
+
+    //! Interpolate the saturation properties at temperature *T*, storing the
+    //! result in *g*. Returns `false` if *T* is outside of the table.
+    bool saturation(double T, double* g) const;
+
+    //! Find the density at temperature *T* and pressure *p* in the interval
+    //! (*lrlo*, *lrhi*) of @f$ \ln \rho @f$. Returns NaN if no solution is found.
+    double rhoTP(double T, double p, double lrlo, double lrhi) const;
+
+    //! Find the density at temperature *T* and pressure *p*, selecting the phase
+    //! based on the saturation pressure.
+    double rhoTP(double T, double p) const;
+
+    //! Check whether the state (*T*, *rho*) lies inside the saturation dome.
+    //! Sets *twoPhase* and, for two-phase states, stores the saturation
+    //! properties in *g*. Returns `false` if this cannot be determined.
+    bool checkDome(double T, double rho, bool& twoPhase, double* g) const;
+
+    size_t m_nT, m_nRho;
+    double m_y0, m_dy; //!< First value and spacing of @f$ \ln T @f$
+    double m_x0, m_dx; //!< First value and spacing of @f$ \ln \rho @f$
+
+    //! Node data: for each node and property, the value and derivatives with
+    //! respect to @f$ \ln T @f$ and @f$ \ln \rho @f$ and the mixed derivative
+    std::vector<double> m_data;
+
+    double m_Tc, m_Pc, m_rhoc; //!< Critical properties
+    double m_Ttop; //!< Highest temperature of the saturation table
+    double m_Tmin; //!< Lowest temperature of the saturation table
+    size_t m_nSat; //!< Number of points in the saturation table
+    double m_z0, m_dz; //!< First value and spacing of the variable *z*
+    //! Saturation data: value and derivative with respect to *z* of each property
+    std::vector<double> m_sat;
+};
+
+}
+
+#endif
@@ -89,6 +89,13 @@ public:
         return T;
     }
 
+    //! Density [kg/m^3]. Unlike v(), this does not require the saturation
+    //! properties to be evaluated.
+    //! @since New in %Cantera 3.1.
+    double rho() const {
+        return Rho;
+    }
+
     //! Specific volume [m^3/kg]
     double v() {
         return prop(propertyFlag::V);
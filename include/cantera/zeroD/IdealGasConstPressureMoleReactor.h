@@ -45,7 +45,9 @@ public:
     //! Neglects derivatives with respect to mole fractions that would generate a
     //! fully-dense Jacobian. Currently also neglects terms related to interactions
     //! between reactors, for example via inlets and outlets.
-    Eigen::SparseMatrix<double> jacobian() override;
+    void getJacobianElements(vector<Eigen::Triplet<double>>& trips) override;
+
+    Eigen::SparseMatrix<double> productionRateJacobian() override;
 
     bool preconditionerSupported() const override { return true; };
 
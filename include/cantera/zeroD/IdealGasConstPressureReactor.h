@@ -44,6 +44,8 @@ public:
     size_t componentIndex(const string& nm) const override;
     string componentName(size_t k) override;
 
+    Eigen::SparseMatrix<double> productionRateJacobian() override;
+
 protected:
     vector<double> m_hk; //!< Species molar enthalpies
 };
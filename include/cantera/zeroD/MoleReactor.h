@@ -38,6 +38,8 @@ public:
 
     string componentName(size_t k) override;
 
+    Eigen::SparseMatrix<double> productionRateJacobian() override;
+
 protected:
     //! For each surface in the reactor, update vector of triplets with all relevant
     //! surface jacobian derivatives of species with respect to species
@@ -211,10 +211,44 @@ public:
     //!
     //! @warning  This method is an experimental part of the %Cantera
     //! API and may be changed or removed without notice.
-    virtual Eigen::SparseMatrix<double> jacobian() {
-        throw NotImplementedError("Reactor::jacobian");
+    virtual Eigen::SparseMatrix<double> jacobian();
+
+    //! Append the nonzero elements of the Jacobian returned by jacobian() to
+    //! `trips`, with row and column indices relative to the start of this reactor's
+    //! state vector.
+    //!
+    //! This allows ReactorNet to assemble the Jacobians of all reactors into a single
+    //! work array that is reused between evaluations.
+    //! @since New in %Cantera 3.1.
+    //!
+    //! @warning  This method is an experimental part of the %Cantera
+    //! API and may be changed or removed without notice.
+    virtual void getJacobianElements(vector<Eigen::Triplet<double>>& trips) {
+        throw NotImplementedError("Reactor::getJacobianElements");
     }
 
+    //! Calculate the derivatives of the right-hand side of the governing equations
+    //! with respect to the net production rates of the gas phase species,
+    //! @f$ \partial \dot{y}_i / \partial \dot{\omega}_k @f$, at the current state.
+    //! @returns a sparse matrix of size neq() by the number of gas phase species
+    //! @since New in %Cantera 3.1.
+    virtual Eigen::SparseMatrix<double> productionRateJacobian();
+
+    //! Number of reactions in the homogeneous phase
+    //! @since New in %Cantera 3.1.
+    size_t nReactions() const;
+
+    //! Calculate the derivatives of @f$ \lambda^T \dot{y} @f$ with respect to the
+    //! rate multipliers of all homogeneous phase reactions, at the current state.
+    //! Used for adjoint sensitivity analysis.
+    //! @param[in] lambda  Weights for each component of the state vector of this
+    //!     reactor, length neq()
+    //! @param[out] dmult  Derivatives with respect to each multiplier, relative to
+    //!     its current value, length nReactions()
+    //! @see ReactorNet::adjointSensitivities
+    //! @since New in %Cantera 3.1.
+    void getMultiplierDerivatives(const double* lambda, double* dmult);
+
     //! Calculate the reactor-specific Jacobian using a finite difference method.
     //!
     //! This method is used only for informational purposes. Jacobian calculations
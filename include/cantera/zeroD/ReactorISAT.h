@@ -0,0 +1,170 @@
+//! @file ReactorISAT.h
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_REACTORISAT_H
+#define CT_REACTORISAT_H
+
+#include "cantera/base/AnyMap.h"
+#include "cantera/numerics/eigen_dense.h"
+
+namespace Cantera
+{
+
+class ReactorNet;
+
+//! In-situ adaptive tabulation (ISAT) of the reaction mapping of a single reactor.
+/*!
+ * This class wraps a ReactorNet containing a single reactor whose contents are
+ * described by temperature, pressure and mass fractions, for example an
+ * IdealGasConstPressureReactor used for the chemistry substep of an operator-split
+ * CFD calculation. Each call to advance() maps the current state of the reactor
+ * contents @f$ \phi_0 = (T, P, Y_1, \ldots, Y_K) @f$ to the state
+ * @f$ R(\phi_0) @f$ reached after integrating for a fixed interval.
+ *
+ * Following Pope (Combust. Theory Modelling 1:41-63, 1997), the table stores
+ * entries consisting of a tabulation point @f$ \phi_0 @f$, the mapping
+ * @f$ R(\phi_0) @f$, the mapping gradient @f$ A = \partial R / \partial \phi_0 @f$
+ * and an ellipsoid of accuracy (EOA) @f$ \delta^T M \delta \le 1 @f$. The entries
+ * are the leaves of a binary tree whose nodes store cutting planes. For a query
+ * state @f$ \phi @f$:
+ *
+ * - *retrieve*: if @f$ \phi @f$ lies within the EOA of the leaf found by traversing
+ *   the tree, the linear approximation @f$ R(\phi_0) + A (\phi - \phi_0) @f$ is
+ *   returned without integration.
+ * - *grow*: otherwise, the reactor is integrated directly. If the linear
+ *   approximation of the leaf is within the tolerance of the direct result, the
+ *   EOA is grown to the minimum-volume ellipsoid containing the old EOA and
+ *   @f$ \phi @f$.
+ * - *add*: otherwise, a new entry is created for @f$ \phi @f$, with the mapping
+ *   gradient computed by finite differences, and the tree is extended.
+ *
+ * Errors are measured in a scaled norm, where each component is multiplied by the
+ * scale factor set using setScales(). The mass fractions are not scaled.
+ *
+ * The mapping depends on the integration interval, so changing the interval
+ * clears the table. The state of the ReactorNet (including its current time) is
+ * reset by each direct integration; the ReactorNet should not be used for other
+ * purposes while it is being managed by this object.
+ *
+ * @since New in %Cantera 3.1.
+ * @ingroup zerodGroup
+ */
+class ReactorISAT
+{
+public:
+    //! Create a tabulation for the only reactor in the network *net*.
+    explicit ReactorISAT(ReactorNet& net);
+
+    ReactorISAT(const ReactorISAT&) = delete;
+    ReactorISAT& operator=(const ReactorISAT&) = delete;
+
+    //! Set the error tolerance used for retrieving and growing table entries.
+    void setTolerance(double tol);
+
+    //! Get the error tolerance.
+    double tolerance() const {
+        return m_tol;
+    }
+
+    //! Set the maximum number of entries in the table. Once the table is full,
+    //! queries that cannot be retrieved are resolved by direct integration.
+    void setMaxEntries(size_t nmax) {
+        m_maxEntries = nmax;
+    }
+
+    //! Get the maximum number of entries in the table.
+    size_t maxEntries() const {
+        return m_maxEntries;
+    }
+
+    //! Set the scale factors applied to temperature [1/K] and pressure [1/Pa]
+    //! deviations when evaluating errors and ellipsoids of accuracy.
+    void setScales(double Tscale, double Pscale);
+
+    //! Advance the contents of the reactor by the interval *dt* [s], starting from
+    //! the current state of the reactor contents. On return, the state of the
+    //! reactor contents is set to the tabulated or integrated result.
+    void advance(double dt);
+
+    //! Number of entries in the table.
+    size_t nEntries() const {
+        return m_leaves.size();
+    }
+
+    //! Remove all entries from the table and reset the statistics.
+    void clear();
+
+    //! Return statistics on the table usage. Keys are `retrieves`, `grows`, `adds`,
+    //! `direct_evals` (direct integrations done while the table was full),
+    //! `entries`, and `tree_depth`.
+    AnyMap stats() const;
+
+protected:
+    //! A leaf of the binary tree, containing one tabulated mapping.
+    struct Leaf
+    {
+        Eigen::VectorXd phi; //!< Tabulation point
+        Eigen::VectorXd R; //!< Mapping at the tabulation point
+        Eigen::MatrixXd A; //!< Mapping gradient
+        Eigen::MatrixXd M; //!< Ellipsoid of accuracy in scaled coordinates
+    };
+
+    //! A node of the binary tree. A node is either a leaf (if `leaf` is set) or
+    //! a cutting plane `v . phi > a` separating its `left` and `right` subtrees.
+    struct Node
+    {
+        unique_ptr<Leaf> leaf;
+        Eigen::VectorXd v;
+        double a = 0.0;
+        unique_ptr<Node> left;
+        unique_ptr<Node> right;
+    };
+
+    //! Store the current state of the reactor contents in *phi*.
+    void getComposition(Eigen::VectorXd& phi);
+
+    //! Set the state of the reactor contents from *phi*.
+    void setComposition(const Eigen::VectorXd& phi);
+
+    //! Integrate the reactor from the state *phi* over the interval *m_dt* and
+    //! store the resulting state in *R*.
+    void integrate(const Eigen::VectorXd& phi, Eigen::VectorXd& R);
+
+    //! Traverse the tree to find the leaf nearest to *phi*.
+    Node* findLeaf(const Eigen::VectorXd& phi);
+
+    //! Create a new entry at *phi* where the mapping *R* has already been computed,
+    //! and insert it into the tree next to *sibling*.
+    void addEntry(const Eigen::VectorXd& phi, const Eigen::VectorXd& R,
+                  Node* sibling);
+
+    //! Depth of the tree below *node*.
+    size_t depth(const Node* node) const;
+
+    ReactorNet& m_net;
+
+    double m_tol = 1e-4; //!< Error tolerance
+    size_t m_maxEntries = 10000; //!< Maximum number of table entries
+    double m_dt = -1.0; //!< Integration interval for the current table
+
+    //! Scale factors for each component of the composition vector
+    Eigen::VectorXd m_scale;
+
+    unique_ptr<Node> m_root; //!< Root of the binary tree
+    vector<Leaf*> m_leaves; //!< All table entries, in order of addition
+
+    size_t m_nRetrieve = 0; //!< Number of successful retrieves
+    size_t m_nGrow = 0; //!< Number of EOA growths
+    size_t m_nAdd = 0; //!< Number of added entries
+    size_t m_nDirect = 0; //!< Number of direct evaluations with a full table
+
+    // work arrays
+    Eigen::VectorXd m_phi;
+    Eigen::VectorXd m_R;
+};
+
+}
+
+#endif
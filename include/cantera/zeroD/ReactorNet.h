@@ -42,6 +42,14 @@ public:
     //! Other options include: "DIAG", "DENSE", "GMRES", "BAND"
     void setLinearSolverType(const string& linSolverType="DENSE");
 
+    //! Set the type of integrator used for the reactor network.
+    //! @param integratorType  type of integrator, as accepted by newIntegrator().
+    //!     Default type: "CVODE" for ODE systems and "IDA" for DAE systems. The
+    //!     "Extrapolation" integrator avoids the setup overhead of CVODES for small
+    //!     networks that are reinitialized frequently.
+    //! @since New in %Cantera 3.1.
+    void setIntegratorType(const string& integratorType);
+
     //! Set preconditioner used by the linear solver
     //! @param preconditioner preconditioner object used for the linear solver
     void setPreconditioner(shared_ptr<PreconditionerBase> preconditioner);
@@ -135,9 +143,143 @@ public:
     //! (time or space). Returns the new value of the independent variable [s or m].
     double step();
 
+    //! @name Steady-state solution
+    //!
+    //! Methods for finding the steady state of networks of open reactors, such as
+    //! perfectly stirred reactors (PSRs) connected by flow devices, without
+    //! integrating to large times.
+    //! @since New in %Cantera 3.1.
+    //! @{
+
+    //! Solve directly for the steady state of the reactor network.
+    /*!
+     * The steady-state equations @f$ f(y) = 0 @f$ are solved using a damped Newton
+     * method, starting from the current state of the network. The Jacobian of the
+     * full network, including the coupling introduced by flow devices and walls, is
+     * evaluated by finite differences. If the Newton iteration fails, a number of
+     * backward Euler steps of the transient equations are taken with an increasing
+     * time step before the Newton method is tried again, as in OneDim::solve.
+     *
+     * Components whose equations vanish identically, such as the volume of a
+     * reactor without moving walls, are held at their current values. Networks
+     * containing closed reactors, whose steady states depend on conserved
+     * quantities, generally do not have a unique solution and are not supported.
+     * Reactors described by DAEs are not supported.
+     *
+     * On return, the state of all reactors is set to the steady-state solution and
+     * the integrator is reinitialized before the next call to advance() or step().
+     *
+     * @param loglevel  Controls the amount of diagnostic output
+     */
+    void solveSteady(int loglevel=0);
+
+    //! Trace a branch of steady-state solutions as a function of a parameter, such
+    //! as the residence time of a PSR, using pseudo-arclength continuation.
+    /*!
+     * The steady-state equations are augmented with the arclength condition
+     * @f$ \hat{t}^T W^2 (x - x_c) = \Delta s @f$ for the unknowns
+     * @f$ x = (y, \ln p) @f$, where @f$ x_c @f$ is the last converged solution,
+     * @f$ \hat{t} @f$ is the unit tangent to the branch (evaluated using the secant
+     * of the last two solutions) and @f$ W @f$ contains the error weights of the
+     * steady-state tolerances. This allows the continuation to pass through turning
+     * points, for example to trace the ignition and extinction points of an
+     * S-curve. The step size @f$ \Delta s @f$ is adapted based on the convergence
+     * of the Newton iteration, with the change in @f$ \ln p @f$ per step limited
+     * to that of the first step.
+     *
+     * @param setParameter  Function which sets the value of the (positive)
+     *     parameter in the network, for example by setting the mass flow rate of a
+     *     MassFlowController corresponding to a given residence time
+     * @param p0  Initial value of the parameter. The current state of the network
+     *     is used as the initial guess for the solution at *p0*.
+     * @param p1  Value of the parameter used for the first step, which determines
+     *     the initial direction and the maximum size of the steps
+     * @param pmin, pmax  Range of the parameter. The continuation stops once the
+     *     parameter leaves this range.
+     * @param callback  Function called with the value of the parameter after each
+     *     converged solution, with the state of the network set to the solution.
+     *     The continuation stops if the function returns `false`.
+     * @param maxPoints  Maximum number of solutions
+     * @returns the number of converged solutions. On return, the parameter and
+     *     network are set to the last solution.
+     */
+    size_t solveSteadyContinuation(const function<void(double)>& setParameter,
+                                   double p0, double p1, double pmin, double pmax,
+                                   const function<bool(double)>& callback,
+                                   size_t maxPoints=1000);
+
+    //! Set the relative and absolute tolerances used by solveSteady() and
+    //! solveSteadyContinuation(). The Newton iteration is converged when the
+    //! weighted RMS norm of the step is less than one.
+    void setSteadyTolerances(double rtol, double atol);
+
+    //! @}
+
     //! Add the reactor *r* to this reactor network.
     void addReactor(Reactor& r);
 
+    //! @name Events
+    //!
+    //! Events are zero crossings of scalar functions of the network state, which
+    //! are located by the root finding capabilities of the integrator while
+    //! advancing the network. Typical uses include ignition delay calculations,
+    //! where the event may be a temperature rise, a species mole fraction crossing
+    //! a threshold, or the maximum rate of temperature rise.
+    //! @since New in %Cantera 3.1.
+    //! @{
+
+    //! Add an event defined by the zero crossings of the function *func*.
+    /*!
+     * @param name  Name used to identify the event
+     * @param func  Event function, called with the independent variable, the
+     *     global state vector and its derivative as arguments. The state of all
+     *     reactors in the network is synchronized with the state vector before the
+     *     function is called.
+     * @param direction  If +1 (-1), only crossings where the function is
+     *     increasing (decreasing) are reported. If 0, all crossings are reported.
+     * @param terminal  If `true`, advance() stops at the first occurrence of the
+     *     event, and lastEvent() returns the index of the event.
+     * @returns the index of the event
+     */
+    size_t addEvent(const string& name,
+                    const function<double(double, const double*, const double*)>& func,
+                    int direction=0, bool terminal=false);
+
+    //! Add an event located at each maximum of the rate of change of the *k*-th
+    //! component of the global state vector, for example the maximum of the rate of
+    //! temperature rise. The second derivative of the component is evaluated using
+    //! a directional finite difference, which requires an additional evaluation of
+    //! the governing equations each time the event function is evaluated.
+    //! @see addEvent, globalComponentIndex
+    size_t addRateMaximumEvent(const string& name, size_t k, bool terminal=false);
+
+    //! Remove all events.
+    void clearEvents();
+
+    //! Number of events added to this reactor network.
+    size_t nEvents() const {
+        return m_events.size();
+    }
+
+    //! Name of the *i*-th event.
+    const string& eventName(size_t i) const {
+        return m_events.at(i).name;
+    }
+
+    //! Values of the independent variable at which the *i*-th event occurred since
+    //! the last call to setInitialTime().
+    const vector<double>& eventTimes(size_t i) const {
+        return m_events.at(i).times;
+    }
+
+    //! Index of the terminal event which stopped the last call to advance() or
+    //! step(), or @ref npos if the integration was not stopped by an event.
+    size_t lastEvent() const {
+        return m_lastEvent;
+    }
+
+    //! @}
+
     //! Return a reference to the *n*-th reactor in this network. The reactor
     //! indices are determined by the order in which the reactors were added
     //! to the reactor network.
@@ -184,6 +326,60 @@ public:
      */
     double sensitivity(size_t k, size_t p);
 
+    //! Compute the sensitivities of a scalar function of the state at time *tf*
+    //! with respect to the rate multipliers of all homogeneous phase reactions,
+    //! using the adjoint method.
+    /*!
+     * The network is advanced from its current state to *tf*, storing the solution
+     * at checkpoints taken every *checkpointSteps* steps. The adjoint equations
+     * @f[
+     *     \frac{d\lambda}{dt} = -J^T \lambda, \quad
+     *     \lambda(t_f) = \frac{\partial g}{\partial y}(y(t_f))
+     * @f]
+     * are then integrated backward to the current time, using an integrator of the
+     * same type as the network and the sensitivity tolerances, with the absolute
+     * tolerance scaled by the largest element of @f$ \lambda(t_f) @f$. For each
+     * interval between checkpoints, the solution of the network is recomputed
+     * from the checkpoint before the adjoint equations are integrated across the
+     * interval, so the memory required is proportional to the number of
+     * checkpoints plus *checkpointSteps*, rather than to the total number of steps.
+     * The sensitivities are evaluated by quadrature as
+     * @f[
+     *     \frac{dg}{dp_i} = \int \lambda^T \frac{\partial \dot{y}}{\partial p_i} dt
+     * @f]
+     * where @f$ p_i @f$ is a multiplier on the rate of reaction @f$ i @f$ relative
+     * to its current value, as for forward sensitivities added with
+     * Reactor::addSensitivityReaction. The cost is independent of the number of
+     * reactions.
+     *
+     * If all reactors provide an analytic Jacobian (see hasJacobian()), the
+     * Jacobian @f$ J @f$ is evaluated from Reactor::getJacobianElements. As these
+     * Jacobians may neglect minor terms to preserve sparsity, the sensitivities are
+     * then approximate. Otherwise, or if *finiteDifferences* is `true`, the
+     * Jacobian is evaluated using central differences of the governing equations,
+     * at a cost of 2 neq() evaluations of the governing equations per evaluation.
+     *
+     * The sensitivity of the time @f$ \tau @f$ of an event with event function
+     * @f$ e(y) @f$ (see addEvent()), such as an ignition delay, can be obtained
+     * using @f$ t_f = \tau @f$ and @f$ g = e @f$ from
+     * @f$ d\tau / dp_i = -(dg/dp_i) / (de/dt) @f$.
+     *
+     * @param tf  Final time [s]
+     * @param dgdy  Function which evaluates @f$ \partial g / \partial y @f$ (second
+     *     argument, length neq()) given the global state vector at *tf* (first
+     *     argument)
+     * @param checkpointSteps  Number of integrator steps between checkpoints
+     * @param finiteDifferences  Evaluate the Jacobian using finite differences
+     *     even if an analytic Jacobian is available
+     * @returns the sensitivities with respect to the multipliers of all reactions
+     *     of each reactor, ordered by reactor and then by reaction index. On
+     *     return, the network is at time *tf*.
+     * @since New in %Cantera 3.1.
+     */
+    vector<double> adjointSensitivities(
+        double tf, const function<void(const double*, double*)>& dgdy,
+        size_t checkpointSteps=100, bool finiteDifferences=false);
+
     //! Return the sensitivity of the component named *component* with respect to
     //! the *p*-th sensitivity parameter.
     //! @copydetails ReactorNet::sensitivity(size_t, size_t)
@@ -227,6 +423,25 @@ public:
 
     void getConstraints(double* constraints) override;
 
+    //! Returns `true` if all reactors in the network provide an analytic Jacobian
+    //! (see Reactor::jacobian).
+    bool hasJacobian() const override;
+
+    //! Evaluate the Jacobian of the network using the Jacobians of the individual
+    //! reactors. Terms coupling different reactors are not included.
+    void getJacobian(double t, double* y, double* jac) override;
+
+    size_t nRootFunctions() const override {
+        return m_events.size();
+    }
+
+    //! Evaluate the event functions added with addEvent() and
+    //! addRateMaximumEvent().
+    void evalRootFunctions(double t, double* y, double* gout) override;
+
+    //! Directions of the zero crossings of each event, as specified in addEvent()
+    void getRootDirections(int* dirs) const override;
+
     size_t nparams() const override {
         return m_sens_params.size();
     }
@@ -305,6 +520,10 @@ protected:
 
     void updatePreconditioner(double gamma) override;
 
+    //! Collect the Jacobian elements of all reactors in #m_jacElements, with indices
+    //! relative to the start of the network state vector.
+    void updateJacobianElements();
+
     //! Estimate a future state based on current derivatives.
     //! The function is intended for internal use by ReactorNet::advance
     //! and deliberately not exposed in external interfaces.
@@ -315,6 +534,23 @@ protected:
     //! and deliberately not exposed in external interfaces.
     virtual int lastOrder() const;
 
+    //! Record the events found by the integrator at the current time.
+    //! @returns `true` if a terminal event occurred
+    bool handleEvents();
+
+    //! An event added with addEvent() or addRateMaximumEvent()
+    struct Event
+    {
+        string name;
+        //! Event function; unused for rate maximum events
+        function<double(double, const double*, const double*)> func;
+        //! State vector component for rate maximum events, or @ref npos
+        size_t component = npos;
+        int direction = 0; //!< Direction of crossings that are reported
+        bool terminal = false; //!< Stop the integration when the event occurs
+        vector<double> times; //!< Times at which the event occurred
+    };
+
     vector<Reactor*> m_reactors;
     unique_ptr<Integrator> m_integ;
 
@@ -337,12 +573,26 @@ protected:
     double m_rtolsens = 1.0e-4;
     double m_atols = 1.0e-15;
     double m_atolsens = 1.0e-6;
+    double m_rtolSteady = 1.0e-6; //!< Relative tolerance of the steady-state solver
+    double m_atolSteady = 1.0e-12; //!< Absolute tolerance of the steady-state solver
     shared_ptr<PreconditionerBase> m_precon;
     string m_linearSolverType;
 
+    //! Type of the integrator, as passed to newIntegrator(). Empty until set
+    //! explicitly or determined by the first reactor added to the network.
+    string m_integratorType;
+
     //! Maximum integrator internal timestep. Default of 0.0 means infinity.
     double m_maxstep = 0.0;
 
+    //! Maximum number of integrator steps per output point. Default of 0 means
+    //! that the integrator default is used.
+    int m_maxSteps = 0;
+
+    //! Maximum number of error test failures per step. Default of 0 means that
+    //! the integrator default is used.
+    int m_maxErrTestFails = 0;
+
     bool m_verbose = false;
 
     //! Indicates whether time or space is the independent variable
@@ -354,6 +604,16 @@ protected:
     vector<double> m_ydot;
     vector<double> m_yest;
     vector<double> m_advancelimits;
+
+    vector<Event> m_events; //!< Events located during the integration
+    size_t m_lastEvent = npos; //!< Terminal event which stopped the integration
+    vector<double> m_yevent; //!< Work array for evaluating rate maximum events
+    vector<double> m_ydotevent; //!< Work array for evaluating rate maximum events
+
+    //! Work array holding the Jacobian elements of all reactors, reused between
+    //! evaluations of getJacobian() and preconditionerSetup()
+    vector<Eigen::Triplet<double>> m_jacElements;
+
     //! m_LHS is a vector representing the coefficients on the
     //! "left hand side" of each governing equation
     vector<double> m_LHS;
@@ -10,15 +10,20 @@
 #include "cantera/base/global.h"
 #include "cantera/base/utilities.h"
 #include <boost/algorithm/string.hpp>
+#include <cstring>
 #include <fstream>
+#include <limits>
+#include <random>
+#include <sstream>
 #include <mutex>
+#include <shared_mutex>
 #include <unordered_set>
 
 namespace ba = boost::algorithm;
 
 namespace { // helper functions
 
-std::mutex yaml_cache_mutex;
+std::shared_mutex yaml_cache_mutex;
 std::mutex yaml_field_order_mutex;
 using namespace Cantera;
 
@@ -149,6 +154,97 @@ long int getPrecision(const Cantera::AnyValue& precisionSource)
     return precision;
 }
 
+//! Minimum number of elements of numeric vectors or matrices that are written as
+//! binary blocks; zero if binary output is disabled
+size_t getBinaryThreshold(const Cantera::AnyValue& source)
+{
+    auto& threshold = source.getMetadata("binary-threshold");
+    if (threshold.is<long int>() && threshold.asInt() > 0) {
+        return threshold.asInt();
+    }
+    return 0;
+}
+
+const string binaryFloatTag = "!binary-float64";
+const string binaryIntTag = "!binary-int64";
+
+//! Encode values as a base64 string of 64-bit little-endian values, independent of
+//! the byte order and the size of `long int` of the host
+template <class T>
+string encodeBinaryBlock(const vector<T>& values)
+{
+    vector<unsigned char> bytes;
+    bytes.reserve(8 * values.size());
+    for (const auto& value : values) {
+        uint64_t bits;
+        if constexpr (std::is_floating_point<T>::value) {
+            double x = value;
+            std::memcpy(&bits, &x, 8);
+        } else {
+            int64_t x = value;
+            std::memcpy(&bits, &x, 8);
+        }
+        for (int i = 0; i < 8; i++) {
+            bytes.push_back(static_cast<unsigned char>(bits >> (8 * i)));
+        }
+    }
+    return YAML::EncodeBase64(bytes.data(), bytes.size());
+}
+
+//! Decode a base64 string created by encodeBinaryBlock
+template <class T>
+vector<T> decodeBinaryBlock(const YAML::Node& node)
+{
+    const string& text = node.Scalar();
+    auto bytes = YAML::DecodeBase64(text);
+    if (bytes.size() % 8 || (bytes.empty() && !ba::all(text, ba::is_space()))) {
+        throw CanteraError("decodeBinaryBlock", "Invalid binary block with tag '{}' "
+            "on line {}", node.Tag(), node.Mark().line + 1);
+    }
+    vector<T> values(bytes.size() / 8);
+    for (size_t k = 0; k < values.size(); k++) {
+        uint64_t bits = 0;
+        for (int i = 0; i < 8; i++) {
+            bits |= static_cast<uint64_t>(bytes[8 * k + i]) << (8 * i);
+        }
+        if constexpr (std::is_floating_point<T>::value) {
+            double x;
+            std::memcpy(&x, &bits, 8);
+            values[k] = x;
+        } else {
+            int64_t x;
+            std::memcpy(&x, &bits, 8);
+            values[k] = static_cast<T>(x);
+        }
+    }
+    return values;
+}
+
+//! Check whether all elements of a sequence are binary blocks with the given tag
+bool isBinaryRows(const YAML::Node& node, const string& tag)
+{
+    if (node.size() == 0) {
+        return false;
+    }
+    for (const auto& el : node) {
+        if (!el.IsScalar() || el.Tag() != tag) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//! Total number of elements of a matrix
+template <class T>
+size_t elementCount(const vector<vector<T>>& values)
+{
+    size_t count = 0;
+    for (const auto& row : values) {
+        count += row.size();
+    }
+    return count;
+}
+
 string formatDouble(double x, long int precision)
 {
     // This function ensures that trailing zeros resulting from round-off error
@@ -231,6 +327,182 @@ struct Quantity
 
 Cantera::AnyValue Empty;
 
+// Helper functions for the binary representation used for the on-disk cache of
+// parsed input files
+
+//! Types of values stored in the binary representation
+enum class BinaryType : uint8_t {
+    Empty, Double, Integer, Bool, String, Map,
+    VectorDouble, VectorInteger, VectorBool, VectorString, VectorMap, VectorAny,
+    Vector2Double, Vector2Integer, Vector2Bool, Vector2String
+};
+
+//! Identifies cache files and the version of the binary format
+const string binaryMagic = "CTYAMLB2";
+
+//! Number of bytes used to store a value of type T in the binary representation.
+//! Fixed widths are used so that the format does not depend on the platform.
+template <class T>
+constexpr size_t binaryWidth()
+{
+    if constexpr (sizeof(T) == 1) {
+        return 1;
+    } else if constexpr (std::is_same<T, int>::value) {
+        return 4;
+    } else {
+        return 8;
+    }
+}
+
+//! Append a number or enum value to *out* in little-endian byte order
+template <class T>
+void putBinary(string& out, const T& value)
+{
+    uint64_t bits;
+    if constexpr (std::is_floating_point<T>::value) {
+        double x = value;
+        std::memcpy(&bits, &x, 8);
+    } else if constexpr (std::is_enum<T>::value || std::is_unsigned<T>::value) {
+        bits = static_cast<uint64_t>(value);
+    } else {
+        bits = static_cast<uint64_t>(static_cast<int64_t>(value));
+    }
+    for (size_t i = 0; i < binaryWidth<T>(); i++) {
+        out.push_back(static_cast<char>(bits >> (8 * i)));
+    }
+}
+
+void putBinary(string& out, bool value)
+{
+    putBinary(out, static_cast<uint8_t>(value));
+}
+
+void putBinary(string& out, const string& value)
+{
+    putBinary(out, static_cast<uint64_t>(value.size()));
+    out.append(value);
+}
+
+template <class T>
+void putBinaryVector(string& out, const vector<T>& values)
+{
+    putBinary(out, static_cast<uint64_t>(values.size()));
+    for (const auto& value : values) {
+        putBinary(out, static_cast<T>(value));
+    }
+}
+
+template <class T>
+void putBinaryVector2(string& out, const vector<vector<T>>& values)
+{
+    putBinary(out, static_cast<uint64_t>(values.size()));
+    for (const auto& row : values) {
+        putBinaryVector(out, row);
+    }
+}
+
+//! Read a number or enum value written by putBinary()
+template <class T>
+T getBinary(const string& data, size_t& pos)
+{
+    constexpr size_t n = binaryWidth<T>();
+    if (pos + n > data.size()) {
+        throw CanteraError("AnyMap::readBinary", "Unexpected end of data");
+    }
+    uint64_t bits = 0;
+    for (size_t i = 0; i < n; i++) {
+        bits |= static_cast<uint64_t>(static_cast<unsigned char>(data[pos + i]))
+                << (8 * i);
+    }
+    pos += n;
+    if constexpr (std::is_floating_point<T>::value) {
+        double x;
+        std::memcpy(&x, &bits, 8);
+        return x;
+    } else if constexpr (std::is_enum<T>::value || std::is_unsigned<T>::value) {
+        return static_cast<T>(bits);
+    } else {
+        // Sign-extend values narrower than 64 bits
+        int64_t x = static_cast<int64_t>(bits << (64 - 8 * n)) >> (64 - 8 * n);
+        if (x < std::numeric_limits<T>::min() || x > std::numeric_limits<T>::max()) {
+            throw CanteraError("AnyMap::readBinary", "Integer value {} out of range",
+                               x);
+        }
+        return static_cast<T>(x);
+    }
+}
+
+//! Read the size of a string or vector, checking it against the remaining data
+size_t getBinarySize(const string& data, size_t& pos)
+{
+    auto n = getBinary<uint64_t>(data, pos);
+    if (n > data.size() - pos) {
+        throw CanteraError("AnyMap::readBinary", "Invalid size {}", n);
+    }
+    return static_cast<size_t>(n);
+}
+
+template <>
+bool getBinary<bool>(const string& data, size_t& pos)
+{
+    return getBinary<uint8_t>(data, pos) != 0;
+}
+
+template <>
+string getBinary<string>(const string& data, size_t& pos)
+{
+    size_t n = getBinarySize(data, pos);
+    string value = data.substr(pos, n);
+    pos += n;
+    return value;
+}
+
+template <class T>
+vector<T> getBinaryVector(const string& data, size_t& pos)
+{
+    size_t n = getBinarySize(data, pos);
+    vector<T> values;
+    values.reserve(n);
+    for (size_t i = 0; i < n; i++) {
+        values.push_back(getBinary<T>(data, pos));
+    }
+    return values;
+}
+
+template <class T>
+vector<vector<T>> getBinaryVector2(const string& data, size_t& pos)
+{
+    size_t n = getBinarySize(data, pos);
+    vector<vector<T>> values;
+    values.reserve(n);
+    for (size_t i = 0; i < n; i++) {
+        values.push_back(getBinaryVector<T>(data, pos));
+    }
+    return values;
+}
+
+//! Name of the on-disk cache file for an input file with the given contents,
+//! based on a 64-bit FNV-1a hash of the contents and the %Cantera version
+string fileCacheKey(const string& contents)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    auto update = [&hash](const string& text) {
+        for (unsigned char c : text) {
+            hash = (hash ^ c) * 1099511628211ULL;
+        }
+    };
+    update(version());
+    update(gitCommit());
+    update(contents);
+    return fmt::format("{:016x}-{:x}", hash, contents.size());
+}
+
+string fileCacheDirFromEnv()
+{
+    const char* dir = getenv("CANTERA_YAML_CACHE");
+    return dir ? string(dir) : "";
+}
+
 } // end anonymous namespace
 
 namespace YAML { // YAML converters
@@ -422,11 +694,23 @@ YAML::Emitter& operator<<(YAML::Emitter& out, const AnyValue& rhs)
     } else if (rhs.is<vector<AnyMap>>()) {
         out << rhs.asVector<AnyMap>();
     } else if (rhs.is<vector<double>>()) {
-        emitFlowVector(out, rhs.asVector<double>(), getPrecision(rhs));
+        const auto& v = rhs.asVector<double>();
+        size_t threshold = getBinaryThreshold(rhs);
+        if (threshold && v.size() >= threshold) {
+            out << YAML::LocalTag(binaryFloatTag.substr(1)) << encodeBinaryBlock(v);
+        } else {
+            emitFlowVector(out, v, getPrecision(rhs));
+        }
     } else if (rhs.is<vector<string>>()) {
         emitFlowVector(out, rhs.asVector<string>());
     } else if (rhs.is<vector<long int>>()) {
-        emitFlowVector(out, rhs.asVector<long int>());
+        const auto& v = rhs.asVector<long int>();
+        size_t threshold = getBinaryThreshold(rhs);
+        if (threshold && v.size() >= threshold) {
+            out << YAML::LocalTag(binaryIntTag.substr(1)) << encodeBinaryBlock(v);
+        } else {
+            emitFlowVector(out, v);
+        }
     } else if (rhs.is<vector<bool>>()) {
         emitFlowVector(out, rhs.asVector<bool>());
     } else if (rhs.is<vector<Cantera::AnyValue>>()) {
@@ -434,9 +718,15 @@ YAML::Emitter& operator<<(YAML::Emitter& out, const AnyValue& rhs)
     } else if (rhs.is<vector<vector<double>>>()) {
         const auto& v = rhs.asVector<vector<double>>();
         long int precision = getPrecision(rhs);
+        size_t threshold = getBinaryThreshold(rhs);
+        bool binary = threshold && elementCount(v) >= threshold;
         out << YAML::BeginSeq;
         for (const auto& u : v) {
-            emitFlowVector(out, u, precision);
+            if (binary) {
+                out << YAML::LocalTag(binaryFloatTag.substr(1)) << encodeBinaryBlock(u);
+            } else {
+                emitFlowVector(out, u, precision);
+            }
         }
         out << YAML::EndSeq;
     } else if (rhs.is<vector<vector<string>>>()) {
@@ -448,9 +738,15 @@ YAML::Emitter& operator<<(YAML::Emitter& out, const AnyValue& rhs)
         out << YAML::EndSeq;
     } else if (rhs.is<vector<vector<long int>>>()) {
         const auto& v = rhs.asVector<vector<long int>>();
+        size_t threshold = getBinaryThreshold(rhs);
+        bool binary = threshold && elementCount(v) >= threshold;
         out << YAML::BeginSeq;
         for (const auto& u : v) {
-            emitFlowVector(out, u);
+            if (binary) {
+                out << YAML::LocalTag(binaryIntTag.substr(1)) << encodeBinaryBlock(u);
+            } else {
+                emitFlowVector(out, u);
+            }
         }
         out << YAML::EndSeq;
     } else if (rhs.is<vector<vector<bool>>>()) {
@@ -477,7 +773,13 @@ struct convert<Cantera::AnyValue> {
 
     static bool decode(const Node& node, Cantera::AnyValue& target) {
         target.setLoc(node.Mark().line, node.Mark().column);
-        if (node.IsScalar()) {
+        if (node.IsScalar() && node.Tag() == binaryFloatTag) {
+            target = decodeBinaryBlock<double>(node);
+            return true;
+        } else if (node.IsScalar() && node.Tag() == binaryIntTag) {
+            target = decodeBinaryBlock<long int>(node);
+            return true;
+        } else if (node.IsScalar()) {
             // Scalar nodes are int, doubles, or strings
             string nodestr = node.as<string>();
             if (node.Tag() == "!") {
@@ -502,6 +804,20 @@ struct convert<Cantera::AnyValue> {
                 target = nodestr;
             }
             return true;
+        } else if (isBinaryRows(node, binaryFloatTag)) {
+            vector<vector<double>> values;
+            for (const auto& row : node) {
+                values.push_back(decodeBinaryBlock<double>(row));
+            }
+            target = std::move(values);
+            return true;
+        } else if (isBinaryRows(node, binaryIntTag)) {
+            vector<vector<long int>> values;
+            for (const auto& row : node) {
+                values.push_back(decodeBinaryBlock<long int>(row));
+            }
+            target = std::move(values);
+            return true;
         } else if (node.IsSequence()) {
             // Convert sequences of the same element type to vectors of that type
             Type types = elementTypes(node);
@@ -563,8 +879,9 @@ struct convert<Cantera::AnyValue> {
 
 namespace Cantera {
 
-std::unordered_map<string,
-                   pair<AnyMap, std::filesystem::file_time_type>> AnyMap::s_cache;
+std::unordered_map<string, AnyMap::CachedFile> AnyMap::s_cache;
+
+string AnyMap::s_fileCacheDir = fileCacheDirFromEnv();
 
 std::unordered_map<string, vector<string>> AnyMap::s_headFields;
 std::unordered_map<string, vector<string>> AnyMap::s_tailFields;
@@ -1352,6 +1669,146 @@ vector<AnyMap>& AnyValue::asVector<AnyMap>(size_t nMin, size_t nMax)
     return vv;
 }
 
+void AnyValue::writeBinary(string& out) const
+{
+    putBinary(out, m_line);
+    putBinary(out, m_column);
+    putBinary(out, m_key);
+    if (m_value.type() == typeid(void)) {
+        putBinary(out, BinaryType::Empty);
+    } else if (is<double>()) {
+        putBinary(out, BinaryType::Double);
+        putBinary(out, as<double>());
+    } else if (is<long int>()) {
+        putBinary(out, BinaryType::Integer);
+        putBinary(out, as<long int>());
+    } else if (is<bool>()) {
+        putBinary(out, BinaryType::Bool);
+        putBinary(out, as<bool>());
+    } else if (is<string>()) {
+        putBinary(out, BinaryType::String);
+        putBinary(out, as<string>());
+    } else if (is<AnyMap>()) {
+        putBinary(out, BinaryType::Map);
+        as<AnyMap>().writeBinary(out);
+    } else if (is<vector<double>>()) {
+        putBinary(out, BinaryType::VectorDouble);
+        putBinaryVector(out, as<vector<double>>());
+    } else if (is<vector<long int>>()) {
+        putBinary(out, BinaryType::VectorInteger);
+        putBinaryVector(out, as<vector<long int>>());
+    } else if (is<vector<bool>>()) {
+        putBinary(out, BinaryType::VectorBool);
+        putBinaryVector(out, as<vector<bool>>());
+    } else if (is<vector<string>>()) {
+        putBinary(out, BinaryType::VectorString);
+        putBinaryVector(out, as<vector<string>>());
+    } else if (is<vector<AnyMap>>()) {
+        putBinary(out, BinaryType::VectorMap);
+        const auto& items = as<vector<AnyMap>>();
+        putBinary(out, static_cast<uint64_t>(items.size()));
+        for (const auto& item : items) {
+            item.writeBinary(out);
+        }
+    } else if (is<vector<AnyValue>>()) {
+        putBinary(out, BinaryType::VectorAny);
+        const auto& items = as<vector<AnyValue>>();
+        putBinary(out, static_cast<uint64_t>(items.size()));
+        for (const auto& item : items) {
+            item.writeBinary(out);
+        }
+    } else if (is<vector<vector<double>>>()) {
+        putBinary(out, BinaryType::Vector2Double);
+        putBinaryVector2(out, as<vector<vector<double>>>());
+    } else if (is<vector<vector<long int>>>()) {
+        putBinary(out, BinaryType::Vector2Integer);
+        putBinaryVector2(out, as<vector<vector<long int>>>());
+    } else if (is<vector<vector<bool>>>()) {
+        putBinary(out, BinaryType::Vector2Bool);
+        putBinaryVector2(out, as<vector<vector<bool>>>());
+    } else if (is<vector<vector<string>>>()) {
+        putBinary(out, BinaryType::Vector2String);
+        putBinaryVector2(out, as<vector<vector<string>>>());
+    } else {
+        throw CanteraError("AnyValue::writeBinary",
+            "Unable to store value of type '{}'", type_str());
+    }
+}
+
+void AnyValue::readBinary(const string& data, size_t& pos)
+{
+    int line = getBinary<int>(data, pos);
+    int column = getBinary<int>(data, pos);
+    m_key = getBinary<string>(data, pos);
+    switch (getBinary<BinaryType>(data, pos)) {
+    case BinaryType::Empty:
+        m_value.reset();
+        m_equals = eq_comparer<size_t>;
+        break;
+    case BinaryType::Double:
+        *this = getBinary<double>(data, pos);
+        break;
+    case BinaryType::Integer:
+        *this = getBinary<long int>(data, pos);
+        break;
+    case BinaryType::Bool:
+        *this = getBinary<bool>(data, pos);
+        break;
+    case BinaryType::String:
+        *this = getBinary<string>(data, pos);
+        break;
+    case BinaryType::Map: {
+        AnyMap item;
+        item.readBinary(data, pos);
+        *this = std::move(item);
+        break;
+    }
+    case BinaryType::VectorDouble:
+        *this = getBinaryVector<double>(data, pos);
+        break;
+    case BinaryType::VectorInteger:
+        *this = getBinaryVector<long int>(data, pos);
+        break;
+    case BinaryType::VectorBool:
+        *this = getBinaryVector<bool>(data, pos);
+        break;
+    case BinaryType::VectorString:
+        *this = getBinaryVector<string>(data, pos);
+        break;
+    case BinaryType::VectorMap: {
+        vector<AnyMap> items(getBinarySize(data, pos));
+        for (auto& item : items) {
+            item.readBinary(data, pos);
+        }
+        *this = std::move(items);
+        break;
+    }
+    case BinaryType::VectorAny: {
+        vector<AnyValue> items(getBinarySize(data, pos));
+        for (auto& item : items) {
+            item.readBinary(data, pos);
+        }
+        *this = std::move(items);
+        break;
+    }
+    case BinaryType::Vector2Double:
+        *this = getBinaryVector2<double>(data, pos);
+        break;
+    case BinaryType::Vector2Integer:
+        *this = getBinaryVector2<long int>(data, pos);
+        break;
+    case BinaryType::Vector2Bool:
+        *this = getBinaryVector2<bool>(data, pos);
+        break;
+    case BinaryType::Vector2String:
+        *this = getBinaryVector2<string>(data, pos);
+        break;
+    default:
+        throw CanteraError("AnyValue::readBinary", "Invalid value type");
+    }
+    setLoc(line, column);
+}
+
 // Methods of class AnyMap
 
 AnyMap::AnyMap()
@@ -1744,12 +2201,107 @@ bool AnyMap::addOrderingRules(const string& objectType,
     return true;
 }
 
+void AnyMap::writeBinary(string& out) const
+{
+    putBinary(out, m_line);
+    putBinary(out, m_column);
+    putBinary(out, static_cast<uint64_t>(m_data.size()));
+    for (const auto& [key, value] : m_data) {
+        putBinary(out, key);
+        value.writeBinary(out);
+    }
+}
+
+void AnyMap::readBinary(const string& data, size_t& pos)
+{
+    m_line = getBinary<int>(data, pos);
+    m_column = getBinary<int>(data, pos);
+    size_t n = getBinarySize(data, pos);
+    for (size_t i = 0; i < n; i++) {
+        string key = getBinary<string>(data, pos);
+        m_data[key].readBinary(data, pos);
+    }
+}
+
+bool AnyMap::loadFileCache(const string& hash, AnyMap& target)
+{
+    string fileName = fileCacheDirectory() + "/" + hash + ".bin";
+    std::ifstream in(fileName, std::ios::binary);
+    if (!in) {
+        return false;
+    }
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    string data = buffer.str();
+    try {
+        size_t pos = 0;
+        if (getBinary<string>(data, pos) != binaryMagic
+            || getBinary<string>(data, pos) != hash)
+        {
+            return false;
+        }
+        target.readBinary(data, pos);
+        if (pos != data.size()) {
+            throw CanteraError("AnyMap::loadFileCache", "Unexpected trailing data");
+        }
+    } catch (CanteraError&) {
+        target = AnyMap();
+        return false;
+    }
+    return true;
+}
+
+void AnyMap::saveFileCache(const string& hash, const AnyMap& source)
+{
+    string data;
+    putBinary(data, binaryMagic);
+    putBinary(data, hash);
+    try {
+        source.writeBinary(data);
+    } catch (CanteraError&) {
+        return;
+    }
+
+    // Write to a temporary file first, so other processes never see a partially
+    // written cache file
+    namespace fs = std::filesystem;
+    fs::path dir = fileCacheDirectory();
+    std::error_code ec;
+    fs::create_directories(dir, ec);
+    fs::path target = dir / (hash + ".bin");
+    fs::path temp = dir / fmt::format("{}.{:x}.tmp", hash, std::random_device()());
+    {
+        std::ofstream out(temp, std::ios::binary);
+        out.write(data.data(), data.size());
+        if (!out) {
+            out.close();
+            fs::remove(temp, ec);
+            return;
+        }
+    }
+    fs::rename(temp, target, ec);
+    if (ec) {
+        fs::remove(temp, ec);
+    }
+}
+
+void AnyMap::setFileCacheDirectory(const string& path)
+{
+    std::unique_lock<std::shared_mutex> lock(yaml_cache_mutex);
+    s_fileCacheDir = path;
+}
+
+string AnyMap::fileCacheDirectory()
+{
+    std::shared_lock<std::shared_mutex> lock(yaml_cache_mutex);
+    return s_fileCacheDir;
+}
+
 void AnyMap::clearCachedFile(const string& filename)
 {
     string fullName = findInputFile(filename);
-    if (s_cache.count(fullName)) {
-        s_cache.erase(fullName);
-    }
+    std::unique_lock<std::shared_mutex> lock(yaml_cache_mutex);
+    s_cache.erase(fullName);
 }
 
 AnyMap AnyMap::fromYamlString(const string& yaml) {
@@ -1769,6 +2321,18 @@ AnyMap AnyMap::fromYamlString(const string& yaml) {
 }
 
 AnyMap AnyMap::fromYamlFile(const string& name, const string& parent_name)
+{
+    return *cachedYamlFile(name, parent_name).tree;
+}
+
+shared_ptr<const AnyMap> AnyMap::sharedYamlFile(const string& name,
+                                                const string& parent_name)
+{
+    return cachedYamlFile(name, parent_name).shared;
+}
+
+AnyMap::CachedFile AnyMap::cachedYamlFile(const string& name,
+                                          const string& parent_name)
 {
     string fullName;
     // See if a file with this name exists in a path relative to the parent file
@@ -1785,12 +2349,15 @@ AnyMap AnyMap::fromYamlFile(const string& name, const string& parent_name)
     }
 
     // Check for an already-parsed YAML file with the same last-modified time,
-    // and return that if possible
+    // and return that if possible. Cached trees are replaced rather than modified
+    // if the file changes, so they can be used without holding the lock.
     auto mtime = std::filesystem::last_write_time(fullName);
-    std::unique_lock<std::mutex> lock(yaml_cache_mutex);
-    auto iter = s_cache.find(fullName);
-    if (iter != s_cache.end() && iter->second.second == mtime) {
-        return iter->second.first;
+    {
+        std::shared_lock<std::shared_mutex> lock(yaml_cache_mutex);
+        auto iter = s_cache.find(fullName);
+        if (iter != s_cache.end() && iter->second.mtime == mtime) {
+            return iter->second;
+        }
     }
 
     if (!std::ifstream(fullName).good()) {
@@ -1798,32 +2365,54 @@ AnyMap AnyMap::fromYamlFile(const string& name, const string& parent_name)
             "on the Cantera search path.", name);
     }
 
-    // Generate an AnyMap from the YAML file and store it in the cache
-    auto& [cache_item, cache_time] = s_cache[fullName];
-    cache_time = mtime;
+    // Generate an AnyMap from the YAML file. Parsing is done without holding the
+    // lock, so that other files can be loaded from the cache in the meantime.
+    // If the on-disk cache is enabled, a previously parsed version of the file
+    // may be loaded from there instead.
+    auto item = make_shared<AnyMap>();
+    string cacheHash;
+    bool fromFileCache = false;
     try {
-        YAML::Node node = YAML::LoadFile(fullName);
-        cache_item = node.as<AnyMap>();
-        cache_item.setMetadata("filename", AnyValue(fullName));
-        cache_item.applyUnits();
+        if (fileCacheDirectory().empty()) {
+            YAML::Node node = YAML::LoadFile(fullName);
+            *item = node.as<AnyMap>();
+        } else {
+            std::ifstream in(fullName, std::ios::binary);
+            std::stringstream buffer;
+            buffer << in.rdbuf();
+            string contents = buffer.str();
+            cacheHash = fileCacheKey(contents);
+            fromFileCache = loadFileCache(cacheHash, *item);
+            if (!fromFileCache) {
+                YAML::Node node = YAML::Load(contents);
+                *item = node.as<AnyMap>();
+            }
+        }
+        item->setMetadata("filename", AnyValue(fullName));
+        item->applyUnits();
     } catch (YAML::Exception& err) {
-        s_cache.erase(fullName);
         AnyMap fake;
         fake.setLoc(err.mark.line, err.mark.column);
         fake.setMetadata("filename", AnyValue(fullName));
         throw InputFileError("AnyMap::fromYamlFile", fake, err.msg);
-    } catch (CanteraError&) {
-        s_cache.erase(fullName);
-        throw;
     }
-    cache_item["__file__"] = fullName;
+    if (!cacheHash.empty() && !fromFileCache) {
+        saveFileCache(cacheHash, *item);
+    }
+    (*item)["__file__"] = fullName;
 
-    if (cache_item.hasKey("deprecated")) {
-        warn_deprecated(fullName, cache_item["deprecated"].asString());
+    if (item->hasKey("deprecated")) {
+        warn_deprecated(fullName, (*item)["deprecated"].asString());
     }
 
-    // Return a copy of the AnyMap
-    return cache_item;
+    // Store the AnyMap in the cache, along with a separate copy to be shared by
+    // callers of sharedYamlFile()
+    CachedFile entry{item, make_shared<const AnyMap>(*item), mtime};
+    {
+        std::unique_lock<std::shared_mutex> lock(yaml_cache_mutex);
+        s_cache[fullName] = entry;
+    }
+    return entry;
 }
 
 string AnyMap::toYamlString() const
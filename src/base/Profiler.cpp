@@ -0,0 +1,119 @@
+/**
+ * @file Profiler.cpp
+ *    Definitions for built-in instrumentation of performance-critical code sections
+ *    (see @ref Cantera::Profiler).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/base/Profiler.h"
+#include "cantera/base/AnyMap.h"
+#include <array>
+#include <mutex>
+
+namespace Cantera
+{
+
+namespace {
+
+//! Counters of a single thread. Each counter is only modified by the owning thread,
+//! but may be read by other threads generating a report.
+struct ThreadCounters
+{
+    std::array<std::atomic<uint64_t>, Profiler::maxZones> calls{};
+    std::array<std::atomic<uint64_t>, Profiler::maxZones> time{};
+};
+
+std::mutex profilerMutex; //!< Mutex protecting zone names and the list of threads
+vector<string> zoneNames; //!< Names of registered zones
+
+//! Counters of all threads; entries are retained after a thread exits
+vector<shared_ptr<ThreadCounters>> allCounters;
+
+ThreadCounters& localCounters()
+{
+    thread_local shared_ptr<ThreadCounters> counters = [] {
+        auto created = make_shared<ThreadCounters>();
+        std::lock_guard<std::mutex> lock(profilerMutex);
+        allCounters.push_back(created);
+        return created;
+    }();
+    return *counters;
+}
+
+} // end unnamed namespace
+
+std::atomic<bool> Profiler::s_enabled{false};
+
+size_t Profiler::zoneIndex(const string& name) noexcept
+{
+    try {
+        std::lock_guard<std::mutex> lock(profilerMutex);
+        for (size_t i = 0; i < zoneNames.size(); i++) {
+            if (zoneNames[i] == name) {
+                return i;
+            }
+        }
+        if (zoneNames.size() < maxZones) {
+            zoneNames.push_back(name);
+            return zoneNames.size() - 1;
+        }
+    } catch (...) {
+        // Failure to register a zone (for example, due to a failed allocation)
+        // only disables profiling of that zone
+    }
+    return npos;
+}
+
+void Profiler::record(size_t zone, uint64_t nanoseconds)
+{
+    if (zone >= maxZones) {
+        return;
+    }
+    auto& counters = localCounters();
+    counters.calls[zone].fetch_add(1, std::memory_order_relaxed);
+    counters.time[zone].fetch_add(nanoseconds, std::memory_order_relaxed);
+}
+
+AnyMap Profiler::report()
+{
+    std::lock_guard<std::mutex> lock(profilerMutex);
+    AnyMap out;
+    for (size_t i = 0; i < zoneNames.size(); i++) {
+        uint64_t calls = 0;
+        uint64_t time = 0;
+        long int threads = 0;
+        for (const auto& counters : allCounters) {
+            uint64_t n = counters->calls[i].load(std::memory_order_relaxed);
+            if (n) {
+                calls += n;
+                time += counters->time[i].load(std::memory_order_relaxed);
+                threads++;
+            }
+        }
+        if (calls == 0) {
+            continue;
+        }
+        AnyMap zone;
+        zone["calls"] = static_cast<long int>(calls);
+        zone["time"] = 1e-9 * time;
+        zone["mean-time"] = 1e-9 * time / calls;
+        zone["threads"] = threads;
+        out[zoneNames[i]] = std::move(zone);
+    }
+    return out;
+}
+
+void Profiler::reset()
+{
+    std::lock_guard<std::mutex> lock(profilerMutex);
+    for (auto& counters : allCounters) {
+        for (size_t i = 0; i < maxZones; i++) {
+            counters->calls[i].store(0, std::memory_order_relaxed);
+            counters->time[i].store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+}
@@ -12,10 +12,15 @@
 #include "cantera/base/stringUtils.h"
 #include "cantera/thermo/ThermoPhase.h"
 #include "cantera/thermo/SurfPhase.h"
+#include "cantera/thermo/ThermoFactory.h"
+#include "cantera/kinetics/Kinetics.h"
 #include "cantera/base/utilities.h"
+#include "cantera/base/YamlWriter.h"
 #include <boost/algorithm/string.hpp>
 #include <fstream>
+#include <functional>
 #include <sstream>
+#include <thread>
 
 
 namespace ba = boost::algorithm;
@@ -819,6 +824,299 @@ void SolutionArray::normalize() {
     }
 }
 
+vector<string> SolutionArray::equilibrate(const string& XY, const string& solver,
+                                          double rtol, int max_steps, int max_iter,
+                                          int estimate_equil, size_t nThreads)
+{
+    vector<string> errors(m_size);
+    if (m_size == 0) {
+        return errors;
+    }
+    if (nThreads == 0) {
+        nThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    nThreads = std::min(nThreads, m_size);
+
+    // The first block uses the phase of the associated Solution object; all other
+    // blocks use independent copies of the phase, created from its YAML
+    // representation before any of the threads are started.
+    auto phase = m_sol->thermo();
+    vector<double> initial_state;
+    phase->saveState(initial_state);
+    vector<shared_ptr<ThermoPhase>> phases{phase};
+    if (nThreads > 1) {
+        YamlWriter writer;
+        writer.addPhase(phase);
+        AnyMap root = AnyMap::fromYamlString(writer.toYamlString());
+        auto& phaseNode = root["phases"].getMapWhere("name", phase->name());
+        for (size_t i = 1; i < nThreads; i++) {
+            phases.push_back(newThermo(phaseNode, root));
+        }
+    }
+
+    size_t nState = phase->stateSize();
+    size_t blockSize = (m_size + nThreads - 1) / nThreads;
+    auto solveBlock = [&](size_t i) {
+        ThermoPhase& tp = *phases[i];
+        bool warmStart = false;
+        for (size_t k = i * blockSize; k < std::min((i + 1) * blockSize, m_size); k++) {
+            double* state = m_data->data() + m_active[k] * m_stride;
+            try {
+                tp.restoreState(nState, state);
+                tp.equilibrate(XY, solver, rtol, max_steps, max_iter, estimate_equil,
+                               0, warmStart);
+                tp.saveState(nState, state);
+                warmStart = true;
+            } catch (std::exception& err) {
+                errors[k] = err.what();
+            }
+        }
+    };
+
+    vector<std::thread> workers;
+    for (size_t i = 1; i < nThreads; i++) {
+        workers.emplace_back(solveBlock, i);
+    }
+    solveBlock(0);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    // Restore the phase to the (possibly updated) state at the buffered location
+    if (m_loc != npos) {
+        phase->restoreState(nState, m_data->data() + m_loc * m_stride);
+    } else {
+        phase->restoreState(initial_state);
+    }
+    return errors;
+}
+
+SolutionArray::ComponentView SolutionArray::componentView(const string& name)
+{
+    auto phase = m_sol->thermo();
+    size_t ix = phase->speciesIndex(name);
+    if (ix != npos) {
+        ix += m_stride - phase->nSpecies();
+    } else if (name != "X" && name != "Y" && phase->nativeState().count(name)) {
+        ix = phase->nativeState()[name];
+    } else {
+        throw CanteraError("SolutionArray::componentView",
+            "'{}' is not a component of the state.", name);
+    }
+    return ComponentView(m_data->data() + ix, m_stride, m_active);
+}
+
+namespace { // restrict scope of helper functions to local translation unit
+
+//! Number of values per entry of a property evaluated by SolutionArray::getProperty
+enum class PropertySize { scalar, species, kineticsSpecies, reactions };
+
+//! Definition of a property evaluated by SolutionArray::getProperty. The evaluator
+//! stores the values for the current state of the phase (and kinetics manager) in
+//! the output array, and may use the work array, which has two entries per reaction.
+struct BulkProperty
+{
+    PropertySize size;
+    std::function<void(ThermoPhase&, Kinetics*, double*, double*)> eval;
+};
+
+using PS = PropertySize;
+
+const map<string, BulkProperty> bulkProperties = {
+    {"T", {PS::scalar, [](ThermoPhase& tp, Kinetics*, double* out, double*) {
+        *out = tp.temperature(); }}},
+    {"P", {PS::scalar, [](ThermoPhase& tp, Kinetics*, double* out, double*) {
+        *out = tp.pressure(); }}},
+    {"density", {PS::scalar, [](ThermoPhase& tp, Kinetics*, double* out, double*) {
+        *out = tp.density(); }}},
+    {"density_mole", {PS::scalar,
+        [](ThermoPhase& tp, Kinetics*, double* out, double*) {
+            *out = tp.molarDensity(); }}},
+    {"mean_molecular_weight", {PS::scalar,
+        [](ThermoPhase& tp, Kinetics*, double* out, double*) {
+            *out = tp.meanMolecularWeight(); }}},
+    {"enthalpy_mass", {PS::scalar,
+        [](ThermoPhase& tp, Kinetics*, double* out, double*) {
+            *out = tp.enthalpy_mass(); }}},
+    {"enthalpy_mole", {PS::scalar,
+        [](ThermoPhase& tp, Kinetics*, double* out, double*) {
+            *out = tp.enthalpy_mole(); }}},
+    {"int_energy_mass", {PS::scalar,
+        [](ThermoPhase& tp, Kinetics*, double* out, double*) {
+            *out = tp.intEnergy_mass(); }}},
+    {"int_energy_mole", {PS::scalar,
+        [](ThermoPhase& tp, Kinetics*, double* out, double*) {
+            *out = tp.intEnergy_mole(); }}},
+    {"entropy_mass", {PS::scalar,
+        [](ThermoPhase& tp, Kinetics*, double* out, double*) {
+            *out = tp.entropy_mass(); }}},
+    {"entropy_mole", {PS::scalar,
+        [](ThermoPhase& tp, Kinetics*, double* out, double*) {
+            *out = tp.entropy_mole(); }}},
+    {"gibbs_mass", {PS::scalar, [](ThermoPhase& tp, Kinetics*, double* out, double*) {
+        *out = tp.gibbs_mass(); }}},
+    {"gibbs_mole", {PS::scalar, [](ThermoPhase& tp, Kinetics*, double* out, double*) {
+        *out = tp.gibbs_mole(); }}},
+    {"cp_mass", {PS::scalar, [](ThermoPhase& tp, Kinetics*, double* out, double*) {
+        *out = tp.cp_mass(); }}},
+    {"cp_mole", {PS::scalar, [](ThermoPhase& tp, Kinetics*, double* out, double*) {
+        *out = tp.cp_mole(); }}},
+    {"cv_mass", {PS::scalar, [](ThermoPhase& tp, Kinetics*, double* out, double*) {
+        *out = tp.cv_mass(); }}},
+    {"cv_mole", {PS::scalar, [](ThermoPhase& tp, Kinetics*, double* out, double*) {
+        *out = tp.cv_mole(); }}},
+    {"sound_speed", {PS::scalar, [](ThermoPhase& tp, Kinetics*, double* out, double*) {
+        *out = tp.soundSpeed(); }}},
+    {"X", {PS::species, [](ThermoPhase& tp, Kinetics*, double* out, double*) {
+        tp.getMoleFractions(out); }}},
+    {"Y", {PS::species, [](ThermoPhase& tp, Kinetics*, double* out, double*) {
+        tp.getMassFractions(out); }}},
+    {"concentrations", {PS::species,
+        [](ThermoPhase& tp, Kinetics*, double* out, double*) {
+            tp.getConcentrations(out); }}},
+    {"partial_molar_enthalpies", {PS::species,
+        [](ThermoPhase& tp, Kinetics*, double* out, double*) {
+            tp.getPartialMolarEnthalpies(out); }}},
+    {"partial_molar_entropies", {PS::species,
+        [](ThermoPhase& tp, Kinetics*, double* out, double*) {
+            tp.getPartialMolarEntropies(out); }}},
+    {"partial_molar_int_energies", {PS::species,
+        [](ThermoPhase& tp, Kinetics*, double* out, double*) {
+            tp.getPartialMolarIntEnergies(out); }}},
+    {"partial_molar_cp", {PS::species,
+        [](ThermoPhase& tp, Kinetics*, double* out, double*) {
+            tp.getPartialMolarCp(out); }}},
+    {"partial_molar_volumes", {PS::species,
+        [](ThermoPhase& tp, Kinetics*, double* out, double*) {
+            tp.getPartialMolarVolumes(out); }}},
+    {"chemical_potentials", {PS::species,
+        [](ThermoPhase& tp, Kinetics*, double* out, double*) {
+            tp.getChemPotentials(out); }}},
+    {"creation_rates", {PS::kineticsSpecies,
+        [](ThermoPhase&, Kinetics* kin, double* out, double*) {
+            kin->getCreationRates(out); }}},
+    {"destruction_rates", {PS::kineticsSpecies,
+        [](ThermoPhase&, Kinetics* kin, double* out, double*) {
+            kin->getDestructionRates(out); }}},
+    {"net_production_rates", {PS::kineticsSpecies,
+        [](ThermoPhase&, Kinetics* kin, double* out, double*) {
+            kin->getNetProductionRates(out); }}},
+    {"forward_rates_of_progress", {PS::reactions,
+        [](ThermoPhase&, Kinetics* kin, double* out, double*) {
+            kin->getFwdRatesOfProgress(out); }}},
+    {"reverse_rates_of_progress", {PS::reactions,
+        [](ThermoPhase&, Kinetics* kin, double* out, double*) {
+            kin->getRevRatesOfProgress(out); }}},
+    {"net_rates_of_progress", {PS::reactions,
+        [](ThermoPhase&, Kinetics* kin, double* out, double*) {
+            kin->getNetRatesOfProgress(out); }}},
+    {"heat_release_rate", {PS::scalar,
+        [](ThermoPhase&, Kinetics* kin, double* out, double* work) {
+            size_t nr = kin->nReactions();
+            kin->getDeltaEnthalpy(work);
+            kin->getNetRatesOfProgress(work + nr);
+            *out = 0.0;
+            for (size_t i = 0; i < nr; i++) {
+                *out -= work[i] * work[nr + i];
+            }
+        }}},
+};
+
+}
+
+vector<double> SolutionArray::getProperty(const string& name, size_t nThreads)
+{
+    if (!bulkProperties.count(name)) {
+        throw CanteraError("SolutionArray::getProperty",
+            "Unknown property '{}'.", name);
+    }
+    const auto& prop = bulkProperties.at(name);
+    bool kinetics = (prop.size == PS::kineticsSpecies || prop.size == PS::reactions
+                     || name == "heat_release_rate");
+    auto kin = m_sol->kinetics();
+    if (kinetics && !kin) {
+        throw CanteraError("SolutionArray::getProperty", "Property '{}' requires "
+            "a Solution object with an associated Kinetics object.", name);
+    }
+    auto phase = m_sol->thermo();
+    size_t width = 1;
+    if (prop.size == PS::species) {
+        width = phase->nSpecies();
+    } else if (prop.size == PS::kineticsSpecies) {
+        width = kin->nTotalSpecies();
+    } else if (prop.size == PS::reactions) {
+        width = kin->nReactions();
+    }
+    vector<double> out(m_size * width);
+    if (m_size == 0) {
+        return out;
+    }
+    if (nThreads == 0) {
+        nThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    if (m_sol->nAdjacent()) {
+        nThreads = 1;
+    }
+    nThreads = std::min(nThreads, m_size);
+
+    // The first block uses the associated Solution object; all other blocks use
+    // independent copies, created from its YAML representation before any of the
+    // threads are started.
+    vector<double> initial_state;
+    phase->saveState(initial_state);
+    vector<shared_ptr<Solution>> solutions{m_sol};
+    if (nThreads > 1) {
+        YamlWriter writer;
+        writer.addPhase(m_sol);
+        AnyMap root = AnyMap::fromYamlString(writer.toYamlString());
+        auto& phaseNode = root["phases"].getMapWhere("name", phase->name());
+        for (size_t i = 1; i < nThreads; i++) {
+            solutions.push_back(newSolution(phaseNode, root, "none"));
+        }
+    }
+
+    size_t nState = phase->stateSize();
+    size_t blockSize = (m_size + nThreads - 1) / nThreads;
+    vector<std::exception_ptr> errors(nThreads);
+    auto evalBlock = [&](size_t i) {
+        ThermoPhase& tp = *solutions[i]->thermo();
+        Kinetics* kn = kinetics ? solutions[i]->kinetics().get() : nullptr;
+        vector<double> work(kn ? 2 * kn->nReactions() : 0);
+        try {
+            for (size_t k = i * blockSize; k < std::min((i + 1) * blockSize, m_size);
+                 k++)
+            {
+                tp.restoreState(nState, m_data->data() + m_active[k] * m_stride);
+                prop.eval(tp, kn, out.data() + k * width, work.data());
+            }
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    };
+
+    vector<std::thread> workers;
+    for (size_t i = 1; i < nThreads; i++) {
+        workers.emplace_back(evalBlock, i);
+    }
+    evalBlock(0);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    // Restore the phase to the state at the buffered location
+    if (m_loc != npos) {
+        phase->restoreState(nState, m_data->data() + m_loc * m_stride);
+    } else {
+        phase->restoreState(initial_state);
+    }
+    for (auto& err : errors) {
+        if (err) {
+            std::rethrow_exception(err);
+        }
+    }
+    return out;
+}
+
 AnyMap SolutionArray::getAuxiliary(int loc)
 {
     setLoc(loc);
@@ -1143,6 +1441,73 @@ void SolutionArray::writeEntry(const string& fname, const string& name,
     if (!m_dataSize) {
         return;
     }
+    _writeData(file, path);
+}
+
+void SolutionArray::appendEntry(const string& fname, const string& name,
+                                const string& sub, int compression, size_t chunkSize)
+{
+    if (name == "") {
+        throw CanteraError("SolutionArray::appendEntry",
+            "Group name specifying root location must not be empty.");
+    }
+    if (m_size < m_dataSize) {
+        throw NotImplementedError("SolutionArray::appendEntry",
+            "Unable to save sliced data.");
+    }
+    if (apiNdim() > 1) {
+        throw NotImplementedError("SolutionArray::appendEntry",
+            "Unable to append multi-dimensional arrays.");
+    }
+    Storage file(fname, true);
+    if (compression) {
+        file.setCompressionLevel(compression);
+    }
+    file.setChunkSize(chunkSize);
+    string path = name;
+    if (sub != "") {
+        path += "/" + sub;
+    } else {
+        path += "/data";
+    }
+    auto components = componentNames();
+    size_t offset = 0;
+    if (file.checkGroup(path, true)) {
+        AnyMap existing = file.readAttributes(path, false);
+        if (!existing.hasKey("size") || !existing.hasKey("components") ||
+            existing["components"].asVector<string>() != components)
+        {
+            throw CanteraError("SolutionArray::appendEntry",
+                "Unable to append to group '{}' as stored components do not match "
+                "components of SolutionArray.", path);
+        }
+        offset = existing["size"].asInt();
+    } else {
+        file.writeAttributes(path, m_meta);
+        AnyMap more;
+        more["size"] = 0;
+        more["components"] = components;
+        file.writeAttributes(path, more);
+    }
+    if (m_dataSize) {
+        // Rows are written starting at the recorded size, which discards any rows
+        // left over from an append that failed part way
+        _writeData(file, path, offset);
+    }
+    AnyMap more;
+    more["size"] = int(offset + m_dataSize);
+    file.writeAttributes(path, more, true);
+}
+
+void SolutionArray::_writeData(Storage& file, const string& path, size_t offset)
+{
+    auto write = [&file, &path, offset](const string& key, const AnyValue& data) {
+        if (offset != npos) {
+            file.appendData(path, key, data, offset);
+        } else {
+            file.writeData(path, key, data);
+        }
+    };
 
     const auto& nativeState = m_sol->thermo()->nativeState();
     size_t nSpecies = m_sol->thermo()->nSpecies();
@@ -1156,16 +1521,16 @@ void SolutionArray::writeEntry(const string& fname, const string& name,
             }
             AnyValue data;
             data = prop;
-            file.writeData(path, key, data);
+            write(key, data);
         } else {
             auto data = getComponent(key);
-            file.writeData(path, key, data);
+            write(key, data);
         }
     }
 
     for (const auto& [key, value] : *m_extra) {
         if (isSimpleVector(value)) {
-            file.writeData(path, key, value);
+            write(key, value);
         } else if (value.is<void>()) {
             // skip unintialized component
         } else {
@@ -1276,7 +1641,7 @@ void SolutionArray::append(const vector<double>& state, const AnyMap& extra)
 
 void SolutionArray::save(const string& fname, const string& name, const string& sub,
                          const string& desc, bool overwrite, int compression,
-                         const string& basis)
+                         const string& basis, bool binary)
 {
     if (m_size < m_dataSize) {
         throw NotImplementedError("SolutionArray::save",
@@ -1309,6 +1674,10 @@ void SolutionArray::save(const string& fname, const string& name, const string&
         }
         writeHeader(data, name, desc, overwrite);
         writeEntry(data, name, sub, true);
+        if (binary) {
+            // Store large numeric arrays as base64-encoded binary blocks
+            data.setMetadata("binary-threshold", AnyValue(s_binaryThreshold));
+        }
 
         // Write the output file and remove the now-outdated cached file
         std::ofstream out(fname);
@@ -1364,6 +1733,13 @@ AnyMap SolutionArray::readHeader(const AnyMap& root, const string& name)
 
 AnyMap SolutionArray::restore(const string& fname,
                               const string& name, const string& sub)
+{
+    return restore(fname, name, sub, 0);
+}
+
+AnyMap SolutionArray::restore(const string& fname, const string& name,
+                              const string& sub, size_t start, size_t count,
+                              const vector<string>& extra)
 {
     size_t dot = fname.find_last_of(".");
     string extension = (dot != npos) ? toLowerCopy(fname.substr(dot + 1)) : "";
@@ -1374,9 +1750,14 @@ AnyMap SolutionArray::restore(const string& fname,
             "'read_csv' instead.");
     }
     if (extension == "h5" || extension == "hdf"  || extension == "hdf5") {
-        readEntry(fname, name, sub);
+        readEntry(fname, name, sub, start, count, extra);
         header = readHeader(fname, name);
     } else if (extension == "yaml" || extension == "yml") {
+        if (start != 0 || count != npos || !extra.empty()) {
+            throw NotImplementedError("SolutionArray::restore",
+                "Restoring a subset of entries or components is only supported "
+                "for HDF files.");
+        }
         const AnyMap& root = AnyMap::fromYamlFile(fname);
         readEntry(root, name, sub);
         header = readHeader(root, name);
@@ -1621,6 +2002,13 @@ string getName(const set<string>& names, const string& name)
 
 void SolutionArray::readEntry(const string& fname, const string& name,
                               const string& sub)
+{
+    readEntry(fname, name, sub, 0);
+}
+
+void SolutionArray::readEntry(const string& fname, const string& name,
+                              const string& sub, size_t start, size_t count,
+                              const vector<string>& extra)
 {
     Storage file(fname, false);
     if (name == "") {
@@ -1642,17 +2030,31 @@ void SolutionArray::readEntry(const string& fname, const string& name,
     auto [size, names] = file.contents(path);
     m_meta = file.readAttributes(path, true);
     if (m_meta.hasKey("size")) {
-        // one-dimensional array
-        resize(m_meta["size"].as<long int>());
+        size = m_meta["size"].as<long int>();
         m_meta.erase("size");
-    } else if (m_meta.hasKey("api-shape")) {
+    }
+    if (start > size) {
+        throw IndexError("SolutionArray::readEntry", "entries", start, size);
+    }
+    bool partial = (start != 0 || (count != npos && count < size));
+    count = std::min(count, size - start);
+    if (partial) {
+        file.setRowRange(start, count);
+    }
+    if (m_meta.hasKey("api-shape")) {
         // API uses multiple dimensions to interpret C++ SolutionArray
+        if (partial) {
+            throw NotImplementedError("SolutionArray::readEntry",
+                "Partial reads of multi-dimensional arrays are not supported.");
+        }
         setApiShape(m_meta["api-shape"].asVector<long int>());
         m_meta.erase("api-shape");
     } else {
-        // legacy format; size needs to be detected
-        resize(static_cast<int>(size));
+        // one-dimensional array or legacy format where size is detected
+        resize(static_cast<int>(count));
     }
+    bool allExtra = extra.empty();
+    set<string> selected(extra.begin(), extra.end());
 
     if (m_size == 0) {
         return;
@@ -1763,7 +2165,7 @@ void SolutionArray::readEntry(const string& fname, const string& name,
         for (const auto& name : components) {
             if (hasComponent(name) || name == "X" || name == "Y") {
                 back = true;
-            } else {
+            } else if (allExtra || selected.erase(name)) {
                 addExtra(name, back);
                 AnyValue data;
                 data = file.readData(path, name, m_dataSize);
@@ -1775,7 +2177,9 @@ void SolutionArray::readEntry(const string& fname, const string& name,
         // data format used by Python h5py export (Cantera 2.5)
         warn_user("SolutionArray::readEntry", "Detected legacy HDF format.");
         for (const auto& name : names) {
-            if (!hasComponent(name) && name != "X" && name != "Y") {
+            if (!hasComponent(name) && name != "X" && name != "Y" &&
+                (allExtra || selected.erase(name)))
+            {
                 addExtra(name);
                 AnyValue data;
                 data = file.readData(path, name, m_dataSize);
@@ -1783,6 +2187,11 @@ void SolutionArray::readEntry(const string& fname, const string& name,
             }
         }
     }
+    if (!selected.empty()) {
+        throw CanteraError("SolutionArray::readEntry",
+            "Auxiliary component(s) '{}' not found in group '{}'.",
+            ba::join(selected, "', '"), path);
+    }
 }
 
 void SolutionArray::readEntry(const AnyMap& root, const string& name, const string& sub)
@@ -77,6 +77,25 @@ void Storage::setCompressionLevel(int level)
     m_compressionLevel = level;
 }
 
+void Storage::setChunkSize(size_t rows)
+{
+    if (rows == 0) {
+        throw CanteraError("Storage::setChunkSize",
+            "Chunk size needs to be positive.");
+    }
+    m_chunkSize = rows;
+}
+
+void Storage::setRowRange(size_t start, size_t count)
+{
+    if (count == npos) {
+        m_rowStart = 0;
+    } else {
+        m_rowStart = start;
+    }
+    m_rowCount = count;
+}
+
 bool Storage::hasGroup(const string& id) const
 {
     if (!m_file->exist(id)) {
@@ -297,12 +316,15 @@ AnyMap Storage::readAttributes(const string& id, bool recursive) const
     }
 }
 
-void writeH5Attributes(h5::Group sub, const AnyMap& meta)
+void writeH5Attributes(h5::Group sub, const AnyMap& meta, bool overwrite)
 {
     for (auto& [name, item] : meta) {
         if (sub.hasAttribute(name)) {
-            throw NotImplementedError("writeH5Attributes",
-                "Unable to overwrite existing Attribute '{}'", name);
+            if (!overwrite) {
+                throw NotImplementedError("writeH5Attributes",
+                    "Unable to overwrite existing Attribute '{}'", name);
+            }
+            sub.deleteAttribute(name);
         }
         if (item.is<long int>()) {
             int value = item.asInt();
@@ -354,8 +376,11 @@ void writeH5Attributes(h5::Group sub, const AnyMap& meta)
         } else if (item.is<AnyMap>()) {
             // step into recursion
             auto value = item.as<AnyMap>();
-            auto grp = sub.createGroup(name);
-            writeH5Attributes(grp, value);
+            if (overwrite && sub.exist(name)) {
+                writeH5Attributes(sub.getGroup(name), value, overwrite);
+            } else {
+                writeH5Attributes(sub.createGroup(name), value, overwrite);
+            }
         } else {
             throw NotImplementedError("writeH5Attributes",
                 "Unable to write attribute '{}' with type '{}'",
@@ -364,12 +389,12 @@ void writeH5Attributes(h5::Group sub, const AnyMap& meta)
     }
 }
 
-void Storage::writeAttributes(const string& id, const AnyMap& meta)
+void Storage::writeAttributes(const string& id, const AnyMap& meta, bool overwrite)
 {
     try {
         checkGroupWrite(id, false);
         h5::Group sub = m_file->getGroup(id);
-        writeH5Attributes(sub, meta);
+        writeH5Attributes(sub, meta, overwrite);
     } catch (const Cantera::NotImplementedError& err) {
         throw NotImplementedError("Storage::writeAttribute",
             "{} in group '{}'.", err.getMessage(), id);
@@ -414,27 +439,47 @@ AnyValue Storage::readData(const string& id,
             "Cannot process DataSet '{}' as data has {} dimensions.", name, ndim);
     }
     const auto& shape = space.getDimensions();
-    if (shape[0] != rows) {
+    if (m_rowCount == npos && shape[0] != rows) {
         throw CanteraError("Storage::readData",
             "Shape of DataSet '{}' is inconsistent; expected {} rows "
             "but received {}.", name, rows, shape[0]);
+    } else if (m_rowCount != npos && rows != m_rowCount) {
+        throw CanteraError("Storage::readData",
+            "Number of rows for DataSet '{}' is inconsistent; expected {} rows "
+            "but the selected range contains {}.", name, rows, m_rowCount);
+    } else if (m_rowCount != npos && shape[0] < m_rowStart + m_rowCount) {
+        throw CanteraError("Storage::readData",
+            "Selected rows {} to {} exceed size of DataSet '{}' with {} rows.",
+            m_rowStart, m_rowStart + m_rowCount - 1, name, shape[0]);
     }
     if (cols != 0 && cols != npos && shape[1] != cols) {
         throw CanteraError("Storage::readData",
             "Shape of DataSet '{}' is inconsistent; expected {} columns "
             "but received {}.", name, cols, shape[1]);
     }
+    // read either the entire dataset or the selected rows
+    auto read = [&](auto& data) {
+        if (m_rowCount == npos) {
+            dataset.read(data);
+        } else {
+            vector<size_t> offset(ndim, 0);
+            offset[0] = m_rowStart;
+            vector<size_t> count = shape;
+            count[0] = m_rowCount;
+            dataset.select(offset, count).read(data);
+        }
+    };
     AnyValue out;
     const auto datatype = dataset.getDataType().getClass();
     if (datatype == h5::DataTypeClass::Float) {
         try {
             if (ndim == 1) {
                 vector<double> data;
-                dataset.read(data);
+                read(data);
                 out = data;
             } else { // ndim == 2
                 vector<vector<double>> data;
-                dataset.read(data);
+                read(data);
                 out = data;
             }
         } catch (const std::exception& err) {
@@ -446,11 +491,11 @@ AnyValue Storage::readData(const string& id,
         try {
             if (ndim == 1) {
                 vector<long int> data;
-                dataset.read(data);
+                read(data);
                 out = data;
             } else { // ndim == 2
                 vector<vector<long int>> data;
-                dataset.read(data);
+                read(data);
                 out = data;
             }
         } catch (const std::exception& err) {
@@ -462,11 +507,11 @@ AnyValue Storage::readData(const string& id,
         try {
             if (ndim == 1) {
                 vector<string> data;
-                dataset.read(data);
+                read(data);
                 out = data;
             } else { // ndim == 2
                 vector<vector<string>> data;
-                dataset.read(data);
+                read(data);
                 out = data;
             }
         } catch (const std::exception& err) {
@@ -531,11 +576,12 @@ void Storage::writeData(const string& id, const string& name, const AnyValue& da
             "'{}'\nis not supported.", name, id, data.type_str());
     }
     if (m_compressionLevel) {
-        // Set chunk size to single chunk and apply compression level; for caveats, see
+        // Set chunk size and apply compression level; for caveats, see
         // https://stackoverflow.com/questions/32994766/compressed-files-bigger-in-h5py
-        h5::DataSpace space(dims, dims); //{h5::DataSpace::UNLIMITED, dims[1]});
+        h5::DataSpace space(dims, dims);
         h5::DataSetCreateProps props;
-        props.add(h5::Chunking(vector<hsize_t>{dims[0], dims[1]}));
+        hsize_t chunkRows = std::max<size_t>(std::min(dims[0], m_chunkSize), 1);
+        props.add(h5::Chunking(vector<hsize_t>{chunkRows, dims[1]}));
         props.add(h5::Deflate(m_compressionLevel));
         if (data.isVector<vector<long int>>()) {
             h5::DataSet dataset = sub.createDataSet<long int>(name, space, props);
@@ -570,6 +616,114 @@ void Storage::writeData(const string& id, const string& name, const AnyValue& da
     }
 }
 
+void Storage::appendData(const string& id, const string& name, const AnyValue& data,
+                         size_t offset)
+{
+    try {
+        checkGroupWrite(id, false);
+    } catch (const CanteraError& err) {
+        // rethrow with public method attribution
+        throw CanteraError("Storage::appendData", "{}", err.getMessage());
+    } catch (const std::exception& err) {
+        // convert HighFive exception
+        throw CanteraError("Storage::appendData",
+            "Encountered exception for group '{}':\n{}", id, err.what());
+    }
+    vector<size_t> dims;
+    if (data.isVector<long int>() || data.isVector<double>() ||
+        data.isVector<string>())
+    {
+        dims.push_back(data.vectorSize());
+    } else if (data.isVector<vector<long int>>() || data.isVector<vector<double>>() ||
+               data.isVector<vector<string>>())
+    {
+        auto [rows, cols] = data.matrixShape();
+        if (cols == npos) {
+            throw CanteraError("Storage::appendData",
+                "Cannot append to DataSet '{}' in group '{}' as input data does not "
+                "have a regular shape.", name, id);
+        }
+        dims.push_back(rows);
+        dims.push_back(cols);
+    } else {
+        throw NotImplementedError("Storage::appendData",
+            "Cannot append to DataSet '{}' in group '{}' as input data with type\n"
+            "'{}'\nis not supported.", name, id, data.type_str());
+    }
+    if (dims[0] == 0) {
+        return;
+    }
+
+    h5::Group sub = m_file->getGroup(id);
+    try {
+        if (!sub.exist(name)) {
+            // Create an empty dataset that is extendible along its first dimension
+            vector<size_t> initial = dims;
+            initial[0] = 0;
+            vector<size_t> maxDims = dims;
+            maxDims[0] = h5::DataSpace::UNLIMITED;
+            h5::DataSpace space(initial, maxDims);
+            h5::DataSetCreateProps props;
+            vector<hsize_t> chunk(dims.begin(), dims.end());
+            chunk[0] = m_chunkSize;
+            if (chunk.size() == 2) {
+                chunk[1] = std::max<hsize_t>(chunk[1], 1);
+            }
+            props.add(h5::Chunking(chunk));
+            if (m_compressionLevel) {
+                props.add(h5::Deflate(m_compressionLevel));
+            }
+            if (data.isVector<long int>() || data.isVector<vector<long int>>()) {
+                sub.createDataSet<long int>(name, space, props);
+            } else if (data.isVector<double>() || data.isVector<vector<double>>()) {
+                sub.createDataSet<double>(name, space, props);
+            } else {
+                sub.createDataSet<string>(name, space, props);
+            }
+        }
+
+        h5::DataSet dataset = sub.getDataSet(name);
+        auto shape = dataset.getSpace().getDimensions();
+        if (shape.size() != dims.size() || (dims.size() == 2 && shape[1] != dims[1])) {
+            throw CanteraError("Storage::appendData",
+                "Shape of DataSet '{}' in group '{}' is inconsistent with the data "
+                "to be appended.", name, id);
+        }
+        if (offset == npos) {
+            offset = shape[0];
+        } else if (offset > shape[0]) {
+            throw CanteraError("Storage::appendData",
+                "Unable to write to DataSet '{}' in group '{}' at row {}, as it only "
+                "has {} rows.", name, id, offset, shape[0]);
+        }
+        vector<size_t> start(dims.size(), 0);
+        start[0] = offset;
+        shape[0] = offset + dims[0];
+        dataset.resize(shape);
+        auto selection = dataset.select(start, dims);
+        if (data.isVector<long int>()) {
+            selection.write(data.asVector<long int>());
+        } else if (data.isVector<double>()) {
+            selection.write(data.asVector<double>());
+        } else if (data.isVector<string>()) {
+            selection.write(data.asVector<string>());
+        } else if (data.isVector<vector<long int>>()) {
+            selection.write(data.asVector<vector<long int>>());
+        } else if (data.isVector<vector<double>>()) {
+            selection.write(data.asVector<vector<double>>());
+        } else {
+            selection.write(data.asVector<vector<string>>());
+        }
+    } catch (const CanteraError&) {
+        throw;
+    } catch (const std::exception& err) {
+        // convert HighFive exception
+        throw CanteraError("Storage::appendData",
+            "Encountered HighFive exception for DataSet '{}' in group '{}':\n{}",
+            name, id, err.what());
+    }
+}
+
 #else
 
 Storage::Storage(string fname, bool write)
@@ -588,6 +742,18 @@ void Storage::setCompressionLevel(int level)
                        "Saving to HDF requires HighFive installation.");
 }
 
+void Storage::setChunkSize(size_t rows)
+{
+    throw CanteraError("Storage::setChunkSize",
+                       "Saving to HDF requires HighFive installation.");
+}
+
+void Storage::setRowRange(size_t start, size_t count)
+{
+    throw CanteraError("Storage::setRowRange",
+                       "Saving to HDF requires HighFive installation.");
+}
+
 bool Storage::hasGroup(const string& id) const
 {
     throw CanteraError("Storage::hasGroup",
@@ -624,7 +790,7 @@ AnyMap Storage::readAttributes(const string& id, bool recursive) const
                        "Saving to HDF requires HighFive installation.");
 }
 
-void Storage::writeAttributes(const string& id, const AnyMap& meta)
+void Storage::writeAttributes(const string& id, const AnyMap& meta, bool overwrite)
 {
     throw CanteraError("Storage::writeAttributes",
                        "Saving to HDF requires HighFive installation.");
@@ -644,6 +810,13 @@ void Storage::writeData(const string& id,
                        "Saving to HDF requires HighFive installation.");
 }
 
+void Storage::appendData(const string& id,
+                         const string& name, const AnyValue& data, size_t offset)
+{
+    throw CanteraError("Storage::appendData",
+                       "Saving to HDF requires HighFive installation.");
+}
+
 #endif
 
 }
@@ -10,6 +10,9 @@
 #include "cantera/base/AnyMap.h"
 #include "cantera/base/utilities.h"
 #include <regex>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
 
 namespace {
 using namespace Cantera;
@@ -101,6 +104,21 @@ const map<string, double> prefixes{
     {"z", 1e-21},
     {"y", 1e-24}
 };
+
+//! Units of molar energy (J/kmol), used to identify activation energy units
+const Units molarEnergyUnits(1.0, 1, 2, -2, 0, 0, -1);
+
+//! Cache of Units objects parsed from strings, keyed by the unit string. Unit
+//! strings are typically drawn from a small set that is used repeatedly while
+//! reading input files, so this avoids repeated regex matching and map lookups.
+std::unordered_map<string, Units> parsedUnits;
+
+//! Mutex for access to parsedUnits
+std::shared_mutex parsedUnitsMutex;
+
+//! Limit on the size of parsedUnits, beyond which newly parsed units are not
+//! cached
+const size_t maxParsedUnits = 1000;
 }
 
 namespace Cantera
@@ -130,6 +148,17 @@ Units::Units(double factor, double mass, double length, double time,
 
 Units::Units(const string& name, bool force_unity)
 {
+    {
+        std::shared_lock<std::shared_mutex> lock(parsedUnitsMutex);
+        auto iter = parsedUnits.find(name);
+        if (iter != parsedUnits.end()) {
+            *this = iter->second;
+            lock.unlock();
+            checkUnity(name, force_unity);
+            return;
+        }
+    }
+
     size_t start = 0;
 
     // Determine factor
@@ -188,6 +217,17 @@ Units::Units(const string& name, bool force_unity)
         }
     }
 
+    {
+        std::unique_lock<std::shared_mutex> lock(parsedUnitsMutex);
+        if (parsedUnits.size() < maxParsedUnits) {
+            parsedUnits.emplace(name, *this);
+        }
+    }
+    checkUnity(name, force_unity);
+}
+
+void Units::checkUnity(const string& name, bool force_unity) const
+{
     if (force_unity && (std::abs(m_factor - 1.) > SmallNumber)) {
         throw CanteraError("Units::Units(string)",
             "Detected non-unity conversion factor:\n"
@@ -522,7 +562,7 @@ void UnitSystem::setDefaultActivationEnergy(const string& e_units)
 {
     Units u(e_units);
     m_defaults["activation-energy"] = e_units;
-    if (u.convertible(Units("J/kmol"))) {
+    if (u.convertible(molarEnergyUnits)) {
         m_activation_energy_factor = u.factor();
     } else if (u.convertible(knownUnits.at("K"))) {
         m_activation_energy_factor = GasConstant;
@@ -675,11 +715,11 @@ double UnitSystem::convertActivationEnergy(double value, const string& src,
 {
     // Convert to J/kmol
     Units usrc(src);
-    if (usrc.convertible(Units("J/kmol"))) {
+    if (usrc.convertible(molarEnergyUnits)) {
         value *= usrc.factor();
-    } else if (usrc.convertible(Units("K"))) {
+    } else if (usrc.convertible(knownUnits.at("K"))) {
         value *= GasConstant * usrc.factor();
-    } else if (usrc.convertible(Units("eV"))) {
+    } else if (usrc.convertible(knownUnits.at("eV"))) {
         value *= Avogadro * usrc.factor();
     } else {
         throw CanteraError("UnitSystem::convertActivationEnergy",
@@ -688,11 +728,11 @@ double UnitSystem::convertActivationEnergy(double value, const string& src,
 
     // Convert from J/kmol
     Units udest(dest);
-    if (udest.convertible(Units("J/kmol"))) {
+    if (udest.convertible(molarEnergyUnits)) {
         value /= udest.factor();
-    } else if (udest.convertible(Units("K"))) {
+    } else if (udest.convertible(knownUnits.at("K"))) {
         value /= GasConstant * udest.factor();
-    } else if (udest.convertible(Units("eV"))) {
+    } else if (udest.convertible(knownUnits.at("eV"))) {
         value /= Avogadro * udest.factor();
     } else {
         throw CanteraError("UnitSystem::convertActivationEnergy",
@@ -710,7 +750,7 @@ double UnitSystem::convertActivationEnergyTo(double value, const string& dest) c
 double UnitSystem::convertActivationEnergyTo(double value,
                                              const Units& dest) const
 {
-    if (dest.convertible(Units("J/kmol"))) {
+    if (dest.convertible(molarEnergyUnits)) {
         return value * m_activation_energy_factor / dest.factor();
     } else if (dest.convertible(knownUnits.at("K"))) {
         return value * m_activation_energy_factor / GasConstant;
@@ -725,7 +765,7 @@ double UnitSystem::convertActivationEnergyTo(double value,
 double UnitSystem::convertActivationEnergyFrom(double value, const string& src) const
 {
     Units usrc(src);
-    if (usrc.convertible(Units("J/kmol"))) {
+    if (usrc.convertible(molarEnergyUnits)) {
         return value * usrc.factor() / m_activation_energy_factor;
     } else if (usrc.convertible(knownUnits.at("K"))) {
         return value * GasConstant / m_activation_energy_factor;
@@ -132,14 +132,22 @@ void Application::ApplicationDestroy()
     }
 }
 
+//! Mutex for access to the set of issued deprecation warnings
+static std::mutex warnings_mutex;
+
 void Application::warn_deprecated(const string& method, const string& extra)
 {
     if (m_fatal_deprecation_warnings) {
         throw CanteraError(method, "Deprecated: " + extra);
-    } else if (m_suppress_deprecation_warnings || warnings.count(method)) {
+    } else if (m_suppress_deprecation_warnings) {
         return;
     }
-    warnings.insert(method);
+    {
+        std::unique_lock<std::mutex> warningsLock(warnings_mutex);
+        if (!warnings.insert(method).second) {
+            return;
+        }
+    }
     warnlog("Deprecation", fmt::format("{}: {}", method, extra));
 }
 
@@ -47,6 +47,10 @@ ChemEquil::ChemEquil(ThermoPhase& s)
 
 void ChemEquil::initialize(ThermoPhase& s)
 {
+    if (&s != m_phase || s.nSpecies() != m_kk || s.nElements() != m_mm) {
+        m_startSolnValid = false;
+    }
+
     // store a pointer to s and some of its properties locally.
     m_phase = &s;
     m_p0 = s.refPressure();
@@ -300,6 +304,37 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XY, int loglevel)
 
 int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
                            vector<double>& elMolesGoal, int loglevel)
+{
+    if (options.contin && m_startSolnValid && &s == m_phase) {
+        // The initial guess is only usable if the same elements are present
+        bool usable = true;
+        for (size_t m = 0; m < m_mm; m++) {
+            bool present = elMolesGoal[m] >= m_elemFracCutoff || m == m_eloc;
+            if (present != m_startElementPresent[m]) {
+                usable = false;
+            }
+        }
+        if (usable) {
+            vector<double> state;
+            s.saveState(state);
+            try {
+                return solveEquilibrium(s, XYstr, elMolesGoal, loglevel, true);
+            } catch (CanteraError& err) {
+                if (loglevel > 0) {
+                    writelog("ChemEquil::equilibrate: warm start failed; "
+                             "restarting from scratch.\n{}\n", err.getMessage());
+                }
+                s.restoreState(state);
+            }
+        }
+        m_startSolnValid = false;
+    }
+    return solveEquilibrium(s, XYstr, elMolesGoal, loglevel, false);
+}
+
+int ChemEquil::solveEquilibrium(ThermoPhase& s, const char* XYstr,
+                                vector<double>& elMolesGoal, int loglevel,
+                                bool warmStart)
 {
     int fail = 0;
     bool tempFixed = true;
@@ -316,6 +351,8 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
 
     initialize(s);
     update(s);
+    // Reinitialization invalidates the stored solution if the phase has changed
+    warmStart = warmStart && m_startSolnValid;
     switch (XY) {
     case TP:
     case PT:
@@ -410,7 +447,7 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
     double tmaxPhase = s.maxTemp();
     double tminPhase = s.minTemp();
     // loop to estimate T
-    if (!tempFixed) {
+    if (!tempFixed && !warmStart) {
         double tmin = std::max(s.temperature(), tminPhase);
         if (tmin > tmaxPhase) {
             tmin = tmaxPhase - 20;
@@ -481,29 +518,43 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
         }
     }
 
-    setInitialMoles(s, elMolesGoal,loglevel);
-
-    // Calculate initial estimates of the element potentials. This algorithm
-    // uses the MultiPhaseEquil object's initialization capabilities to
-    // calculate an initial estimate of the mole fractions for a set of linearly
-    // independent component species. Then, the element potentials are solved
-    // for based on the chemical potentials of the component species.
-    estimateElementPotentials(s, x, elMolesGoal);
+    int info;
+    if (warmStart) {
+        // Start from the element potentials and temperature of the last
+        // solution, using the same choice of components
+        x = m_startSoln;
+        if (tempFixed) {
+            x[m_mm] = log(s.temperature());
+        }
+        m_nComponents = m_startNComponents;
+        m_orderVectorElements = m_startOrderElements;
+    } else {
+        setInitialMoles(s, elMolesGoal,loglevel);
+
+        // Calculate initial estimates of the element potentials. This algorithm
+        // uses the MultiPhaseEquil object's initialization capabilities to
+        // calculate an initial estimate of the mole fractions for a set of
+        // linearly independent component species. Then, the element potentials
+        // are solved for based on the chemical potentials of the component
+        // species.
+        estimateElementPotentials(s, x, elMolesGoal);
+
+        // Do a better estimate of the element potentials. We have found that
+        // the current estimate may not be good enough to avoid drastic
+        // numerical issues associated with the use of a numerically generated
+        // Jacobian.
+        //
+        // The Brinkley algorithm assumes a constant T, P system and uses a
+        // linearized analytical Jacobian that turns out to be very stable.
+        info = estimateEP_Brinkley(s, x, elMolesGoal);
+        if (info == 0) {
+            setToEquilState(s, x, s.temperature());
+        }
 
-    // Do a better estimate of the element potentials. We have found that the
-    // current estimate may not be good enough to avoid drastic numerical issues
-    // associated with the use of a numerically generated Jacobian.
-    //
-    // The Brinkley algorithm assumes a constant T, P system and uses a
-    // linearized analytical Jacobian that turns out to be very stable.
-    int info = estimateEP_Brinkley(s, x, elMolesGoal);
-    if (info == 0) {
-        setToEquilState(s, x, s.temperature());
+        // Install the log(temp) into the last solution unknown slot.
+        x[m_mm] = log(s.temperature());
     }
 
-    // Install the log(temp) into the last solution unknown slot.
-    x[m_mm] = log(s.temperature());
-
     // Setting the max and min values for x[]. Also, if element abundance vector
     // is zero, setting x[] to -1000. This effectively zeroes out all species
     // containing that element.
@@ -568,6 +619,18 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
                 adjustEloc(s, elMolesGoal);
             }
 
+            // Store the solution for use as the initial guess of the next
+            // calculation
+            m_startSoln = x;
+            m_startNComponents = m_nComponents;
+            m_startOrderElements = m_orderVectorElements;
+            m_startElementPresent.resize(m_mm);
+            for (size_t m = 0; m < m_mm; m++) {
+                m_startElementPresent[m] = elMolesGoal[m] >= m_elemFracCutoff
+                                           || m == m_eloc;
+            }
+            m_startSolnValid = true;
+
             if (s.temperature() > s.maxTemp() + 1.0 ||
                     s.temperature() < s.minTemp() - 1.0) {
                 warn_user("ChemEquil::equilibrate",
@@ -641,9 +641,12 @@ void MultiPhase::equilibrate(const string& XY, const string& solver,
     if (solver == "auto" || solver == "vcs") {
         try {
             debuglog("Trying VCS equilibrium solver\n", log_level);
-            vcs_MultiPhaseEquil eqsolve(this, log_level-1);
-            int ret = eqsolve.equilibrate(ixy, estimate_equil, log_level-1,
-                                          rtol, max_steps);
+            if (!m_vcsEquil || m_vcsEquil->mixture() != this) {
+                // A solver copied along with the mixture refers to the original
+                m_vcsEquil = make_shared<vcs_MultiPhaseEquil>(this, log_level-1);
+            }
+            int ret = m_vcsEquil->equilibrate(ixy, estimate_equil, log_level-1,
+                                              rtol, max_steps);
             if (ret) {
                 throw CanteraError("MultiPhase::equilibrate",
                     "VCS solver failed. Return code: {}", ret);
@@ -653,6 +656,7 @@ void MultiPhase::equilibrate(const string& XY, const string& solver,
         } catch (std::exception& err) {
             debuglog("VCS solver failed.\n", log_level);
             debuglog(err.what(), log_level);
+            m_vcsEquil.reset();
             m_moleFractions = initial_moleFractions;
             m_moles = initial_moles;
             m_temp = initial_T;
@@ -691,6 +695,14 @@ void MultiPhase::equilibrate(const string& XY, const string& solver,
     }
 }
 
+AnyMap MultiPhase::solverStats() const
+{
+    if (!m_vcsEquil || m_vcsEquil->mixture() != this) {
+        return AnyMap();
+    }
+    return m_vcsEquil->solverStats();
+}
+
 void MultiPhase::setTemperature(const double T)
 {
     if (!m_init) {
@@ -19,6 +19,31 @@
 
 namespace Cantera
 {
+
+namespace {
+
+//! Keep track of the nesting depth of the equilibrate methods, which call each
+//! other for property pairs other than TP.
+class SolveDepth
+{
+public:
+    explicit SolveDepth(int& depth) : m_depth(depth) {
+        m_depth++;
+    }
+    ~SolveDepth() {
+        m_depth--;
+    }
+    //! True if this is the outermost call
+    bool outermost() const {
+        return m_depth == 1;
+    }
+
+private:
+    int& m_depth;
+};
+
+}
+
 vcs_MultiPhaseEquil::vcs_MultiPhaseEquil(MultiPhase* mix, int printLvl) :
     m_mix(mix),
     m_printLvl(printLvl),
@@ -26,10 +51,38 @@ vcs_MultiPhaseEquil::vcs_MultiPhaseEquil(MultiPhase* mix, int printLvl) :
 {
 }
 
+void vcs_MultiPhaseEquil::prepareSolve()
+{
+    m_iter = 0;
+    m_nSolves++;
+    m_vsolve.vcs_prob_reload();
+}
+
+AnyMap vcs_MultiPhaseEquil::solverStats() const
+{
+    const VCS_COUNTERS& counts = *m_vsolve.m_VCount;
+    AnyMap stats;
+    stats["solves"] = m_nSolves;
+    stats["TP_solves"] = counts.T_Calls_vcs_TP;
+    stats["iterations"] = counts.T_Its;
+    stats["basis_optimizations"] = counts.T_Basis_Opts;
+    stats["initial_estimates"] = counts.T_Calls_Inest;
+    stats["phase_stability_tests"] = counts.T_Calls_phaseStability;
+    stats["TP_time"] = counts.T_Time_vcs_TP;
+    stats["basis_optimization_time"] = counts.T_Time_basopt;
+    stats["initial_estimate_time"] = counts.T_Time_inest;
+    stats["phase_stability_time"] = counts.T_Time_phaseStability;
+    return stats;
+}
+
 int vcs_MultiPhaseEquil::equilibrate_TV(int XY, double xtarget, int estimateEquil,
                                         int printLvl, double err,
                                         int maxsteps, int loglevel)
 {
+    SolveDepth depth(m_solveDepth);
+    if (depth.outermost()) {
+        prepareSolve();
+    }
     double Vtarget = m_mix->volume();
     if ((XY != TV) && (XY != HV) && (XY != UV) && (XY != SV)) {
         throw CanteraError("vcs_MultiPhaseEquil::equilibrate_TV",
@@ -126,6 +179,10 @@ int vcs_MultiPhaseEquil::equilibrate_HP(double Htarget, int XY, double Tlow,
     double Thigh, int estimateEquil, int printLvl, double err, int maxsteps,
     int loglevel)
 {
+    SolveDepth depth(m_solveDepth);
+    if (depth.outermost()) {
+        prepareSolve();
+    }
     int maxiter = 100;
     int iSuccess;
     if (XY != HP && XY != UP) {
@@ -239,6 +296,10 @@ int vcs_MultiPhaseEquil::equilibrate_HP(double Htarget, int XY, double Tlow,
 int vcs_MultiPhaseEquil::equilibrate_SP(double Starget, double Tlow, double Thigh,
     int estimateEquil, int printLvl, double err, int maxsteps, int loglevel)
 {
+    SolveDepth depth(m_solveDepth);
+    if (depth.outermost()) {
+        prepareSolve();
+    }
     int maxiter = 100;
     int strt = estimateEquil;
 
@@ -406,6 +467,10 @@ int vcs_MultiPhaseEquil::equilibrate(int XY, int estimateEquil, int printLvl,
 int vcs_MultiPhaseEquil::equilibrate_TP(int estimateEquil, int printLvl, double err,
                                         int maxsteps, int loglevel)
 {
+    SolveDepth depth(m_solveDepth);
+    if (depth.outermost()) {
+        prepareSolve();
+    }
     int maxit = maxsteps;
     clockWC tickTock;
     m_printLvl = printLvl;
@@ -432,6 +497,7 @@ int vcs_MultiPhaseEquil::equilibrate_TP(int estimateEquil, int printLvl, double
         ip1 = 0;
     }
     int iSuccess = m_vsolve.vcs(ipr, ip1, maxit);
+    m_iter += m_vsolve.m_VCount->Its;
 
     double te = tickTock.secondsWC();
     if (printLvl > 0) {
@@ -668,7 +668,10 @@ size_t VCS_SOLVE::vcs_popPhaseID(vector<size_t> & phasePopPhaseIDs)
             } else {
                 // MultiSpecies Phase Stability Resolution
                 if (vcs_popPhasePossible(iph)) {
+                    clockWC tickTock;
                     Fephase = vcs_phaseStabilityTest(iph);
+                    m_VCount->T_Calls_phaseStability++;
+                    m_VCount->T_Time_phaseStability += tickTock.secondsWC();
                     if (Fephase > 0.0) {
                         if (Fephase > FephaseMax) {
                             iphasePop = iph;
@@ -883,12 +886,16 @@ size_t VCS_SOLVE::vcs_RxnStepSizes(int& forceComponentCalc, size_t& kSpecial)
 
     // LOOP OVER THE FORMATION REACTIONS
     for (size_t irxn = 0; irxn < m_numRxnRdc; ++irxn) {
-        ANOTE = "Normal Calc";
+        if (m_debug_print_lvl >= 2) {
+            ANOTE = "Normal Calc";
+        }
 
         size_t kspec = m_indexRxnToSpecies[irxn];
         if (m_speciesStatus[kspec] == VCS_SPECIES_ZEROEDPHASE) {
             m_deltaMolNumSpecies[kspec] = 0.0;
-            ANOTE = "ZeroedPhase: Phase is artificially zeroed";
+            if (m_debug_print_lvl >= 2) {
+                ANOTE = "ZeroedPhase: Phase is artificially zeroed";
+            }
         } else if (m_speciesUnknownType[kspec] != VCS_SPECIES_TYPE_INTERFACIALVOLTAGE) {
             if (m_molNumSpecies_old[kspec] == 0.0 && (!m_SSPhase[kspec])) {
                 // MULTISPECIES PHASE WITH total moles equal to zero
@@ -896,6 +903,7 @@ size_t VCS_SOLVE::vcs_RxnStepSizes(int& forceComponentCalc, size_t& kSpecial)
                 // If dg[irxn] is negative, then the multispecies phase should
                 // come alive again. Add a small positive step size to make it
                 // come alive.
+                const char* note;
                 if (m_deltaGRxn_new[irxn] < -1.0e-4) {
                     // First decide if this species is part of a multiphase that
                     // is nontrivial in size.
@@ -907,28 +915,28 @@ size_t VCS_SOLVE::vcs_RxnStepSizes(int& forceComponentCalc, size_t& kSpecial)
                         m_deltaMolNumSpecies[kspec] = m_totalMolNum * VCS_SMALL_MULTIPHASE_SPECIES;
                         if (m_speciesStatus[kspec] == VCS_SPECIES_STOICHZERO) {
                             m_deltaMolNumSpecies[kspec] = 0.0;
-                            ANOTE = fmt::sprintf("MultSpec (%s): Species not born due to STOICH/PHASEPOP even though DG = %11.3E",
-                                vcs_speciesType_string(m_speciesStatus[kspec], 15), m_deltaGRxn_new[irxn]);
+                            note = "Species not born due to STOICH/PHASEPOP even though";
                         } else {
                             m_deltaMolNumSpecies[kspec] = m_totalMolNum * VCS_SMALL_MULTIPHASE_SPECIES * 10.0;
-                            ANOTE = fmt::sprintf("MultSpec (%s): small species born again DG = %11.3E",
-                                vcs_speciesType_string(m_speciesStatus[kspec], 15), m_deltaGRxn_new[irxn]);
+                            note = "small species born again";
                         }
                     } else {
-                        ANOTE = fmt::sprintf("MultSpec (%s):still dead, no phase pop, even though DG = %11.3E",
-                            vcs_speciesType_string(m_speciesStatus[kspec], 15), m_deltaGRxn_new[irxn]);
+                        note = "still dead, no phase pop, even though";
                         m_deltaMolNumSpecies[kspec] = 0.0;
                         if (Vphase->exists() > 0 && trphmoles > 0.0) {
                             m_deltaMolNumSpecies[kspec] = m_totalMolNum * VCS_SMALL_MULTIPHASE_SPECIES * 10.;
-                            ANOTE = fmt::sprintf("MultSpec (%s): birthed species because it was zero in a small existing phase with DG = %11.3E",
-                                vcs_speciesType_string(m_speciesStatus[kspec], 15), m_deltaGRxn_new[irxn]);
+                            note = "birthed species because it was zero in a small existing phase with";
                         }
                     }
                 } else {
-                    ANOTE = fmt::sprintf("MultSpec (%s): still dead DG = %11.3E",
-                        vcs_speciesType_string(m_speciesStatus[kspec], 15), m_deltaGRxn_new[irxn]);
+                    note = "still dead";
                     m_deltaMolNumSpecies[kspec] = 0.0;
                 }
+                if (m_debug_print_lvl >= 2) {
+                    ANOTE = fmt::sprintf("MultSpec (%s): %s DG = %11.3E",
+                        vcs_speciesType_string(m_speciesStatus[kspec], 15), note,
+                        m_deltaGRxn_new[irxn]);
+                }
             } else {
                 // REGULAR PROCESSING
                 //
@@ -936,8 +944,8 @@ size_t VCS_SOLVE::vcs_RxnStepSizes(int& forceComponentCalc, size_t& kSpecial)
                 // bother if superconvergence has already been achieved in this
                 // mode.
                 if (fabs(m_deltaGRxn_new[irxn]) <= m_tolmaj2) {
-                    ANOTE = fmt::sprintf("Skipped: superconverged DG = %11.3E", m_deltaGRxn_new[irxn]);
                     if (m_debug_print_lvl >= 2) {
+                        ANOTE = fmt::sprintf("Skipped: superconverged DG = %11.3E", m_deltaGRxn_new[irxn]);
                         plogf("   --- %-12.12s", m_speciesName[kspec]);
                         plogf("  %12.4E %12.4E %12.4E | %s\n",
                               m_molNumSpecies_old[kspec], m_deltaMolNumSpecies[kspec],
@@ -949,9 +957,9 @@ size_t VCS_SOLVE::vcs_RxnStepSizes(int& forceComponentCalc, size_t& kSpecial)
                 // Don't calculate for minor or nonexistent species if their
                 // values are to be decreasing anyway.
                 if ((m_speciesStatus[kspec] != VCS_SPECIES_MAJOR) && (m_deltaGRxn_new[irxn] >= 0.0)) {
-                    ANOTE = fmt::sprintf("Skipped: IC = %3d and DG >0: %11.3E",
-                        m_speciesStatus[kspec], m_deltaGRxn_new[irxn]);
                     if (m_debug_print_lvl >= 2) {
+                        ANOTE = fmt::sprintf("Skipped: IC = %3d and DG >0: %11.3E",
+                            m_speciesStatus[kspec], m_deltaGRxn_new[irxn]);
                         plogf("   --- %-12.12s", m_speciesName[kspec]);
                         plogf("  %12.4E %12.4E %12.4E | %s\n",
                               m_molNumSpecies_old[kspec], m_deltaMolNumSpecies[kspec],
@@ -985,8 +993,10 @@ size_t VCS_SOLVE::vcs_RxnStepSizes(int& forceComponentCalc, size_t& kSpecial)
                     if (m_useActCoeffJac) {
                         double s_old = s;
                         s = vcs_Hessian_diag_adj(irxn, s_old);
-                        ANOTE = fmt::sprintf("Normal calc: diag adjusted from %g "
-                            "to %g due to act coeff", s_old, s);
+                        if (m_debug_print_lvl >= 2) {
+                            ANOTE = fmt::sprintf("Normal calc: diag adjusted from %g "
+                                "to %g due to act coeff", s_old, s);
+                        }
                     }
 
                     m_deltaMolNumSpecies[kspec] = -m_deltaGRxn_new[irxn] / s;
@@ -997,14 +1007,18 @@ size_t VCS_SOLVE::vcs_RxnStepSizes(int& forceComponentCalc, size_t& kSpecial)
                             double negChangeComp = -stoicC * m_deltaMolNumSpecies[kspec];
                             if (negChangeComp > m_molNumSpecies_old[j]) {
                                 if (m_molNumSpecies_old[j] > 0.0) {
-                                    ANOTE = fmt::sprintf("Delta damped from %g "
-                                        "to %g due to component %d (%10s) going neg", m_deltaMolNumSpecies[kspec],
-                                        -m_molNumSpecies_old[j] / stoicC, j, m_speciesName[j]);
+                                    if (m_debug_print_lvl >= 2) {
+                                        ANOTE = fmt::sprintf("Delta damped from %g "
+                                            "to %g due to component %d (%10s) going neg", m_deltaMolNumSpecies[kspec],
+                                            -m_molNumSpecies_old[j] / stoicC, j, m_speciesName[j]);
+                                    }
                                     m_deltaMolNumSpecies[kspec] = -m_molNumSpecies_old[j] / stoicC;
                                 } else {
-                                    ANOTE = fmt::sprintf("Delta damped from %g "
-                                        "to %g due to component %d (%10s) zero", m_deltaMolNumSpecies[kspec],
-                                        -m_molNumSpecies_old[j] / stoicC, j, m_speciesName[j]);
+                                    if (m_debug_print_lvl >= 2) {
+                                        ANOTE = fmt::sprintf("Delta damped from %g "
+                                            "to %g due to component %d (%10s) zero", m_deltaMolNumSpecies[kspec],
+                                            -m_molNumSpecies_old[j] / stoicC, j, m_speciesName[j]);
+                                    }
                                     m_deltaMolNumSpecies[kspec] = 0.0;
                                 }
                             }
@@ -1013,9 +1027,11 @@ size_t VCS_SOLVE::vcs_RxnStepSizes(int& forceComponentCalc, size_t& kSpecial)
                     // Implement a damping term that limits m_deltaMolNumSpecies
                     // to the size of the mole number
                     if (-m_deltaMolNumSpecies[kspec] > m_molNumSpecies_old[kspec]) {
-                        ANOTE = fmt::sprintf("Delta damped from %g "
-                            "to %g due to %s going negative", m_deltaMolNumSpecies[kspec], -m_molNumSpecies_old[kspec],
-                            m_speciesName[kspec]);
+                        if (m_debug_print_lvl >= 2) {
+                            ANOTE = fmt::sprintf("Delta damped from %g "
+                                "to %g due to %s going negative", m_deltaMolNumSpecies[kspec], -m_molNumSpecies_old[kspec],
+                                m_speciesName[kspec]);
+                        }
                         m_deltaMolNumSpecies[kspec] = -m_molNumSpecies_old[kspec];
                     }
                 } else {
@@ -1068,8 +1084,10 @@ size_t VCS_SOLVE::vcs_RxnStepSizes(int& forceComponentCalc, size_t& kSpecial)
                             // having all of the mole numbers of that phases. it
                             // seems that we can suggest a zero of the species
                             // and the code will recover.
-                            ANOTE = fmt::sprintf("Delta damped from %g to %g due to delete %s", m_deltaMolNumSpecies[kspec],
-                                -m_molNumSpecies_old[kspec], m_speciesName[kspec]);
+                            if (m_debug_print_lvl >= 2) {
+                                ANOTE = fmt::sprintf("Delta damped from %g to %g due to delete %s", m_deltaMolNumSpecies[kspec],
+                                    -m_molNumSpecies_old[kspec], m_speciesName[kspec]);
+                            }
                             m_deltaMolNumSpecies[kspec] = -m_molNumSpecies_old[kspec];
                             if (m_debug_print_lvl >= 2) {
                                 plogf("   --- %-12.12s", m_speciesName[kspec]);
@@ -1092,13 +1110,13 @@ size_t VCS_SOLVE::vcs_RxnStepSizes(int& forceComponentCalc, size_t& kSpecial)
                         iphDel = m_phaseID[k];
                         kSpecial = k;
 
-                        if (k != kspec) {
-                            ANOTE = fmt::sprintf("Delete component SS phase %d named %s - SS phases only",
-                                iphDel, m_speciesName[k]);
-                        } else {
-                            ANOTE = fmt::sprintf("Delete this SS phase %d - SS components only", iphDel);
-                        }
                         if (m_debug_print_lvl >= 2) {
+                            if (k != kspec) {
+                                ANOTE = fmt::sprintf("Delete component SS phase %d named %s - SS phases only",
+                                    iphDel, m_speciesName[k]);
+                            } else {
+                                ANOTE = fmt::sprintf("Delete this SS phase %d - SS components only", iphDel);
+                            }
                             plogf("   --- %-12.12s", m_speciesName[kspec]);
                             plogf("  %12.4E %12.4E %12.4E | %s\n",
                                   m_molNumSpecies_old[kspec], m_deltaMolNumSpecies[kspec],
@@ -2932,6 +2950,70 @@ void VCS_SOLVE::vcs_prob_specifyFully()
     m_numRxnRdc = m_numRxnTot;
 }
 
+void VCS_SOLVE::vcs_prob_reload()
+{
+    // Restore the original ordering of the species and elements, so that the
+    // solution path does not depend on the previously solved problems
+    for (size_t k = 0; k < m_nsp; k++) {
+        size_t kcur = k;
+        while (m_speciesMapIndex[kcur] != k) {
+            kcur++;
+        }
+        if (kcur != k) {
+            vcs_switch_pos(false, k, kcur);
+        }
+    }
+    for (size_t m = 0; m < m_nelem; m++) {
+        size_t mcur = m;
+        while (m_elementMapIndex[mcur] != m) {
+            mcur++;
+        }
+        if (mcur != m) {
+            vcs_switch_elem_pos(m, mcur);
+        }
+    }
+    m_speciesStatus.assign(m_nsp, VCS_SPECIES_MAJOR);
+    m_actCoeffSpecies_old.assign(m_nsp, 1.0);
+    m_actCoeffSpecies_new.assign(m_nsp, 1.0);
+
+    for (size_t kspec = 0; kspec < m_nsp; kspec++) {
+        size_t k = m_speciesMapIndex[kspec];
+        if (m_speciesUnknownType[kspec] == VCS_SPECIES_TYPE_MOLNUM) {
+            m_molNumSpecies_old[kspec] = m_mix->speciesMoles(k);
+        } else {
+            m_molNumSpecies_old[kspec] = m_mix->phase(m_phaseID[kspec]).electricPotential();
+        }
+    }
+    for (size_t iph = 0; iph < m_numPhases; iph++) {
+        vcs_VolPhase* volPhase = m_VolPhaseList[iph].get();
+        volPhase->setElectricPotential(m_mix->phase(iph).electricPotential());
+        volPhase->setMolesFromVCS(VCS_STATECALC_OLD, &m_molNumSpecies_old[0]);
+    }
+
+    // Required element abundances, using the current ordering of the species
+    // and elements
+    for (size_t j = 0; j < m_nelem; j++) {
+        m_elemAbundancesGoal[j] = 0.0;
+        for (size_t kspec = 0; kspec < m_nsp; kspec++) {
+            if (m_speciesUnknownType[kspec] != VCS_SPECIES_TYPE_INTERFACIALVOLTAGE) {
+                m_elemAbundancesGoal[j] += m_formulaMatrix(kspec,j) * m_molNumSpecies_old[kspec];
+            }
+        }
+        if (m_elType[j] == VCS_ELEM_TYPE_LATTICERATIO && m_elemAbundancesGoal[j] < 1.0E-10) {
+            m_elemAbundancesGoal[j] = 0.0;
+        } else if (m_elType[j] == VCS_ELEM_TYPE_CHARGENEUTRALITY
+                   && m_elemAbundancesGoal[j] != 0.0) {
+            if (fabs(m_elemAbundancesGoal[j]) > 1.0E-9) {
+                throw CanteraError("VCS_SOLVE::vcs_prob_reload",
+                        "Charge neutrality condition {} is significantly "
+                        "nonzero, {}. Giving up",
+                        m_elementName[j], m_elemAbundancesGoal[j]);
+            }
+            m_elemAbundancesGoal[j] = 0.0;
+        }
+    }
+}
+
 void VCS_SOLVE::vcs_inest(double* const aw, double* const sa, double* const sm,
                           double* const ss, double test)
 {
@@ -3253,6 +3335,8 @@ void VCS_SOLVE::vcs_counters_init(int ifunc)
         m_VCount->T_Time_basopt = 0.0;
         m_VCount->T_Time_inest = 0.0;
         m_VCount->T_Time_vcs = 0.0;
+        m_VCount->T_Calls_phaseStability = 0;
+        m_VCount->T_Time_phaseStability = 0.0;
     }
 }
 
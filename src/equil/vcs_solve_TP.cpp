@@ -30,7 +30,8 @@ namespace Cantera
 void VCS_SOLVE::checkDelta1(double* const dsLocal,
                             double* const delTPhMoles, size_t kspec)
 {
-    vector<double> dchange(m_numPhases, 0.0);
+    vector<double>& dchange = m_TmpPhase2;
+    dchange.assign(m_numPhases, 0.0);
     for (size_t k = 0; k < kspec; k++) {
         if (m_speciesUnknownType[k] != VCS_SPECIES_TYPE_INTERFACIALVOLTAGE) {
             size_t iph = m_phaseID[k];
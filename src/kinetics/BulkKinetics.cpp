@@ -4,6 +4,7 @@
 #include "cantera/kinetics/BulkKinetics.h"
 #include "cantera/kinetics/Reaction.h"
 #include "cantera/thermo/ThermoPhase.h"
+#include "cantera/base/Profiler.h"
 
 namespace Cantera
 {
@@ -456,6 +457,7 @@ Eigen::SparseMatrix<double> BulkKinetics::netRatesOfProgress_ddCi()
 
 void BulkKinetics::updateROP()
 {
+    CT_PROFILE_ZONE("BulkKinetics::updateROP");
     static const int cacheId = m_cache.getId();
     CachedScalar last = m_cache.getScalar(cacheId);
     double T = thermo().temperature();
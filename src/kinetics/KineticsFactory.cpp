@@ -14,6 +14,8 @@
 #include "cantera/base/stringUtils.h"
 #include "cantera/base/Solution.h"
 #include <boost/algorithm/string.hpp>
+#include <atomic>
+#include <thread>
 
 namespace Cantera
 {
@@ -104,6 +106,79 @@ shared_ptr<Kinetics> newKinetics(const vector<shared_ptr<ThermoPhase>>& phases,
     return newKinetics(phases, phaseNode, root);
 }
 
+namespace {
+
+//! Maximum number of threads used by addReactions(); zero for the number of
+//! concurrent threads supported by the hardware
+std::atomic<size_t> reactionSetupThreads{1};
+
+//! Minimum number of reactions created by each thread in addReactions()
+const size_t minReactionsPerThread = 200;
+
+//! Create the reactions defined by *nodes* and add them to *kin*. The Reaction
+//! objects are created using multiple threads if *parallel* is `true`, and then
+//! added in order. In optimized builds, error messages are appended to *errors*.
+void addReactionList(Kinetics& kin, const vector<AnyMap>& nodes, bool parallel,
+                     fmt::memory_buffer& errors)
+{
+    size_t nThreads = 1;
+    if (parallel) {
+        nThreads = reactionSetupThreads;
+        if (nThreads == 0) {
+            nThreads = std::thread::hardware_concurrency();
+        }
+        nThreads = std::max<size_t>(
+            std::min(nThreads, nodes.size() / minReactionsPerThread), 1);
+    }
+
+    vector<shared_ptr<Reaction>> reactions(nodes.size());
+    vector<std::exception_ptr> failures(nodes.size());
+    auto create = [&](size_t start, size_t stop) {
+        for (size_t i = start; i < stop; i++) {
+            try {
+                reactions[i] = newReaction(nodes[i], kin);
+            } catch (...) {
+                failures[i] = std::current_exception();
+            }
+        }
+    };
+    size_t blockSize = (nodes.size() + nThreads - 1) / nThreads;
+    vector<std::thread> workers;
+    for (size_t i = 1; i < nThreads; i++) {
+        workers.emplace_back(create, i * blockSize,
+                             std::min((i + 1) * blockSize, nodes.size()));
+    }
+    create(0, std::min(blockSize, nodes.size()));
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    for (size_t i = 0; i < nodes.size(); i++) {
+        #ifdef NDEBUG
+            try {
+                if (failures[i]) {
+                    std::rethrow_exception(failures[i]);
+                }
+                kin.addReaction(reactions[i], false);
+            } catch (CanteraError& err) {
+                fmt_append(errors, "{}", err.what());
+            }
+        #else
+            if (failures[i]) {
+                std::rethrow_exception(failures[i]);
+            }
+            kin.addReaction(reactions[i], false);
+        #endif
+    }
+}
+
+}
+
+void setReactionSetupThreads(size_t nThreads)
+{
+    reactionSetupThreads = nThreads;
+}
+
 void addReactions(Kinetics& kin, const AnyMap& phaseNode, const AnyMap& rootNode)
 {
     kin.skipUndeclaredThirdBodies(
@@ -181,30 +256,15 @@ void addReactions(Kinetics& kin, const AnyMap& phaseNode, const AnyMap& rootNode
             AnyMap reactions = AnyMap::fromYamlFile(fileName,
                 rootNode.getString("__file__", ""));
             loadExtensions(reactions);
-            for (const auto& R : reactions[node].asVector<AnyMap>()) {
-                #ifdef NDEBUG
-                    try {
-                        kin.addReaction(newReaction(R, kin), false);
-                    } catch (CanteraError& err) {
-                        fmt_append(add_rxn_err, "{}", err.what());
-                    }
-                #else
-                    kin.addReaction(newReaction(R, kin), false);
-                #endif
-            }
+            // Rates defined by extensions may not support concurrent creation
+            bool parallel = !rootNode.hasKey("extensions")
+                            && !reactions.hasKey("extensions");
+            addReactionList(kin, reactions[node].asVector<AnyMap>(), parallel,
+                            add_rxn_err);
         } else {
             // specified section is in the current file
-            for (const auto& R : rootNode.at(sections[i]).asVector<AnyMap>()) {
-                #ifdef NDEBUG
-                    try {
-                        kin.addReaction(newReaction(R, kin), false);
-                    } catch (CanteraError& err) {
-                        fmt_append(add_rxn_err, "{}", err.what());
-                    }
-                #else
-                    kin.addReaction(newReaction(R, kin), false);
-                #endif
-            }
+            addReactionList(kin, rootNode.at(sections[i]).asVector<AnyMap>(),
+                            !rootNode.hasKey("extensions"), add_rxn_err);
         }
     }
 
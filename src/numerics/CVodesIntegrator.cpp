@@ -5,6 +5,7 @@
 
 #include "cantera/numerics/CVodesIntegrator.h"
 #include "cantera/base/stringUtils.h"
+#include "cantera/base/Profiler.h"
 
 #include <iostream>
 using namespace std;
@@ -38,10 +39,21 @@ extern "C" {
      */
     static int cvodes_rhs(sunrealtype t, N_Vector y, N_Vector ydot, void* f_data)
     {
+        CT_PROFILE_ZONE("CVodesIntegrator::cvodes_rhs");
         FuncEval* f = (FuncEval*) f_data;
         return f->evalNoThrow(t, NV_DATA_S(y), NV_DATA_S(ydot));
     }
 
+    //! Function called by CVodes to evaluate the root functions used to locate
+    //! events during the integration. See FuncEval::evalRootFunctions.
+    static int cvodes_root(sunrealtype t, N_Vector y, sunrealtype* gout,
+                           void* f_data)
+    {
+        CT_PROFILE_ZONE("CVodesIntegrator::cvodes_root");
+        FuncEval* f = (FuncEval*) f_data;
+        return f->evalRootFunctionsNoThrow(t, NV_DATA_S(y), gout);
+    }
+
     //! Function called by CVodes when an error is encountered instead of
     //! writing to stdout. Here, save the error message provided by CVodes so
     //! that it can be included in the subsequently raised CanteraError. Used by
@@ -72,6 +84,7 @@ extern "C" {
                                  sunbooleantype jok, sunbooleantype *jcurPtr,
                                  sunrealtype gamma, void *f_data)
     {
+        CT_PROFILE_ZONE("CVodesIntegrator::cvodes_prec_setup");
         FuncEval* f = (FuncEval*) f_data;
         if (!jok) {
             *jcurPtr = true; // jacobian data was recomputed
@@ -87,6 +100,7 @@ extern "C" {
                                  N_Vector z, sunrealtype gamma, sunrealtype delta,
                                  int lr, void* f_data)
     {
+        CT_PROFILE_ZONE("CVodesIntegrator::cvodes_prec_solve");
         FuncEval* f = (FuncEval*) f_data;
         return f->preconditioner_solve_nothrow(NV_DATA_S(r),NV_DATA_S(z));
     }
@@ -325,6 +339,16 @@ void CVodesIntegrator::initialize(double t0, FuncEval& func)
     flag = CVodeSetUserData(m_cvode_mem, &func);
     checkError(flag, "initialize", "CVodeSetUserData");
 
+    if (func.nRootFunctions() > 0) {
+        flag = CVodeRootInit(m_cvode_mem, static_cast<int>(func.nRootFunctions()),
+                             cvodes_root);
+        checkError(flag, "initialize", "CVodeRootInit");
+        vector<int> directions(func.nRootFunctions());
+        func.getRootDirections(directions.data());
+        flag = CVodeSetRootDirection(m_cvode_mem, directions.data());
+        checkError(flag, "initialize", "CVodeSetRootDirection");
+    }
+
     if (func.nparams() > 0) {
         sensInit(t0, func);
         flag = CVodeSetSensParams(m_cvode_mem, func.m_sens_params.data(),
@@ -496,6 +520,7 @@ void CVodesIntegrator::applyOptions()
 
 void CVodesIntegrator::integrate(double tout)
 {
+    m_rootInfo.clear();
     if (tout == m_time) {
         return;
     } else if (tout < m_time) {
@@ -504,6 +529,21 @@ void CVodesIntegrator::integrate(double tout)
                            "Requested time {} < current time {}",
                            tout, m_time);
     }
+    if (m_func->nRootFunctions() > 0 && m_tInteg >= tout) {
+        // The internal integration has already passed the output time, which
+        // happens after stopping at a zero crossing. CVODES checks for further
+        // zero crossings before interpolating the solution at the output time.
+        double tret;
+        int flag = CVode(m_cvode_mem, tout, m_y, &tret, CV_NORMAL);
+        if (flag == CV_ROOT_RETURN) {
+            handleRoot(tret);
+            return;
+        }
+        checkError(flag, "integrate", "CVode");
+        m_time = tout;
+        m_sens_ok = false;
+        return;
+    }
     int nsteps = 0;
     while (m_tInteg < tout) {
         if (nsteps >= m_maxsteps) {
@@ -513,7 +553,11 @@ void CVodesIntegrator::integrate(double tout)
                 nsteps, tout, m_tInteg);
         }
         int flag = CVode(m_cvode_mem, tout, m_y, &m_tInteg, CV_ONE_STEP);
-        if (flag != CV_SUCCESS) {
+        if (flag == CV_ROOT_RETURN) {
+            // Stop at the zero crossing, where CVODES has interpolated the solution
+            handleRoot(m_tInteg);
+            return;
+        } else if (flag != CV_SUCCESS) {
             string f_errs = m_func->getErrors();
             if (!f_errs.empty()) {
                 f_errs = "Exceptions caught during RHS evaluation:\n" + f_errs;
@@ -534,8 +578,12 @@ void CVodesIntegrator::integrate(double tout)
 
 double CVodesIntegrator::step(double tout)
 {
+    m_rootInfo.clear();
     int flag = CVode(m_cvode_mem, tout, m_y, &m_tInteg, CV_ONE_STEP);
-    if (flag != CV_SUCCESS) {
+    if (flag == CV_ROOT_RETURN) {
+        handleRoot(m_tInteg);
+        return m_time;
+    } else if (flag != CV_SUCCESS) {
         string f_errs = m_func->getErrors();
         if (!f_errs.empty()) {
             f_errs = "Exceptions caught during RHS evaluation:\n" + f_errs;
@@ -552,6 +600,18 @@ double CVodesIntegrator::step(double tout)
     return m_time;
 }
 
+void CVodesIntegrator::handleRoot(double troot)
+{
+    // The zero crossing precedes the time reached by the internal integration
+    m_time = troot;
+    int flag = CVodeGetCurrentTime(m_cvode_mem, &m_tInteg);
+    checkError(flag, "handleRoot", "CVodeGetCurrentTime");
+    m_rootInfo.resize(m_func->nRootFunctions());
+    flag = CVodeGetRootInfo(m_cvode_mem, m_rootInfo.data());
+    checkError(flag, "handleRoot", "CVodeGetRootInfo");
+    m_sens_ok = false;
+}
+
 double* CVodesIntegrator::derivative(double tout, int n)
 {
     int flag = CVodeGetDky(m_cvode_mem, tout, n, m_dky);
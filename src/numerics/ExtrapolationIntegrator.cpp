@@ -0,0 +1,514 @@
+//! @file ExtrapolationIntegrator.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/numerics/ExtrapolationIntegrator.h"
+
+#include <limits>
+
+namespace Cantera
+{
+
+void ExtrapolationIntegrator::setTolerances(double reltol, size_t n, double* abstol)
+{
+    m_reltol = reltol;
+    m_abstol.assign(abstol, abstol + n);
+}
+
+void ExtrapolationIntegrator::setTolerances(double reltol, double abstol)
+{
+    m_reltol = reltol;
+    m_abstols = abstol;
+    m_abstol.assign(m_neq, m_abstols);
+}
+
+void ExtrapolationIntegrator::setLinearSolverType(const string& linSolverType)
+{
+    if (linSolverType != "DENSE") {
+        throw CanteraError("ExtrapolationIntegrator::setLinearSolverType",
+            "Unsupported linear solver type '{}'. Only 'DENSE' is available.",
+            linSolverType);
+    }
+}
+
+void ExtrapolationIntegrator::setPreconditioner(
+    shared_ptr<PreconditionerBase> preconditioner)
+{
+    throw CanteraError("ExtrapolationIntegrator::setPreconditioner",
+                       "Preconditioning is not supported by this integrator.");
+}
+
+void ExtrapolationIntegrator::setMaxOrder(int n)
+{
+    if (n < 2) {
+        throw CanteraError("ExtrapolationIntegrator::setMaxOrder",
+                           "Extrapolation order must be at least 2; got {}.", n);
+    }
+    m_order = n;
+    m_table.resize(m_neq, m_order);
+}
+
+void ExtrapolationIntegrator::setMaxStepSize(double hmax)
+{
+    m_hmax = hmax;
+}
+
+void ExtrapolationIntegrator::setMinStepSize(double hmin)
+{
+    m_hmin = hmin;
+}
+
+void ExtrapolationIntegrator::setMaxErrTestFails(int n)
+{
+    m_maxErrTestFails = n;
+}
+
+void ExtrapolationIntegrator::setMaxSteps(int nmax)
+{
+    m_maxSteps = nmax;
+}
+
+void ExtrapolationIntegrator::initialize(double t0, FuncEval& func)
+{
+    if (func.nparams() > 0) {
+        throw CanteraError("ExtrapolationIntegrator::initialize",
+            "Sensitivity analysis is not supported by this integrator.");
+    }
+    m_neq = func.neq();
+    if (m_abstol.empty()) {
+        m_abstol.assign(m_neq, m_abstols);
+    } else if (m_abstol.size() != m_neq) {
+        throw CanteraError("ExtrapolationIntegrator::initialize",
+            "Number of absolute tolerances ({}) does not match the number of "
+            "equations ({}).", m_abstol.size(), m_neq);
+    }
+
+    // Allocate all work arrays used during integration
+    m_y.resize(m_neq);
+    m_ynew.resize(m_neq);
+    m_f0.resize(m_neq);
+    m_f.resize(m_neq);
+    m_ysub.resize(m_neq);
+    m_dy.resize(m_neq);
+    m_err.resize(m_neq);
+    m_dky.resize(m_neq);
+    m_table.resize(m_neq, m_order);
+    m_jac.resize(m_neq, m_neq);
+    m_iter.resize(m_neq, m_neq);
+    m_lu = Eigen::PartialPivLU<Eigen::MatrixXd>(m_neq);
+    m_nRoots = func.nRootFunctions();
+    if (m_nRoots) {
+        m_yold.resize(m_neq);
+        m_fnew.resize(m_neq);
+        m_gPrev.resize(m_nRoots);
+        m_gLo.resize(m_nRoots);
+        m_gHi.resize(m_nRoots);
+        m_gMid.resize(m_nRoots);
+    }
+    reinitialize(t0, func);
+}
+
+void ExtrapolationIntegrator::reinitialize(double t0, FuncEval& func)
+{
+    if (func.neq() != m_neq || m_y.size() != static_cast<long>(m_neq)
+        || func.nRootFunctions() != m_nRoots) {
+        initialize(t0, func);
+        return;
+    }
+    m_func = &func;
+    m_func->clearErrors();
+    m_t = t0;
+    m_h = 0.0;
+    func.getState(m_y.data());
+    m_rootInfo.clear();
+    if (m_nRoots) {
+        func.evalRootFunctions(m_t, m_y.data(), m_gPrev.data());
+    }
+    m_nSteps = 0;
+    m_nEvals = 0;
+    m_nJacEvals = 0;
+    m_nErrTestFails = 0;
+    m_nLinSetups = 0;
+}
+
+void ExtrapolationIntegrator::integrate(double tout)
+{
+    m_rootInfo.clear();
+    if (tout == m_t) {
+        return;
+    } else if (tout < m_t) {
+        throw CanteraError("ExtrapolationIntegrator::integrate",
+                           "Cannot integrate backwards in time.\n"
+                           "Requested time {} < current time {}",
+                           tout, m_t);
+    }
+    int nsteps = 0;
+    while (m_t < tout && m_rootInfo.empty()) {
+        if (nsteps >= m_maxSteps) {
+            throw CanteraError("ExtrapolationIntegrator::integrate",
+                "Maximum number of timesteps ({}) taken without reaching output "
+                "time ({}).\nCurrent integrator time: {}",
+                nsteps, tout, m_t);
+        }
+        takeStep(tout, true);
+        nsteps++;
+    }
+}
+
+double ExtrapolationIntegrator::step(double tout)
+{
+    m_rootInfo.clear();
+    takeStep(tout, false);
+    return m_t;
+}
+
+double& ExtrapolationIntegrator::solution(size_t k)
+{
+    return m_y[k];
+}
+
+double* ExtrapolationIntegrator::solution()
+{
+    return m_y.data();
+}
+
+double* ExtrapolationIntegrator::derivative(double tout, int n)
+{
+    if (n == 0) {
+        return m_y.data();
+    } else if (n != 1) {
+        throw CanteraError("ExtrapolationIntegrator::derivative",
+                           "Derivatives of order {} are not available.", n);
+    }
+    if (!evalRHS(m_t, m_y.data(), m_dky.data())) {
+        throw CanteraError("ExtrapolationIntegrator::derivative",
+                           "Right-hand side evaluation failed:\n{}",
+                           m_func->getErrors());
+    }
+    return m_dky.data();
+}
+
+int ExtrapolationIntegrator::lastOrder() const
+{
+    // Only the first derivative of the solution is available through derivative(),
+    // which limits the order of extrapolations done by ReactorNet::advance.
+    return 1;
+}
+
+bool ExtrapolationIntegrator::evalRHS(double t, double* y, double* ydot)
+{
+    int flag = m_func->evalNoThrow(t, y, ydot);
+    m_nEvals++;
+    if (flag < 0) {
+        throw CanteraError("ExtrapolationIntegrator::evalRHS",
+                           "Unrecoverable error in right-hand side evaluation:\n{}",
+                           m_func->getErrors());
+    }
+    return flag == 0;
+}
+
+void ExtrapolationIntegrator::evalJacobian(double h)
+{
+    m_nJacEvals++;
+    if (m_func->hasJacobian()) {
+        m_func->getJacobian(m_t, m_y.data(), m_jac.data());
+        return;
+    }
+
+    // Forward difference approximation, with increments chosen as in CVODES. m_f0
+    // contains the right-hand side at the current state.
+    double srur = sqrt(std::numeric_limits<double>::epsilon());
+    double minInc = 1000 * std::abs(h) * std::numeric_limits<double>::epsilon()
+                    * m_neq * weightedNorm(m_f0);
+    if (minInc == 0.0) {
+        minInc = 1.0;
+    }
+    for (size_t j = 0; j < m_neq; j++) {
+        double ysave = m_y[j];
+        double ewt = m_reltol * std::abs(ysave) + m_abstol[j];
+        double inc = std::max(srur * std::abs(ysave), minInc * ewt);
+        m_y[j] += inc;
+        inc = m_y[j] - ysave;
+        bool ok = evalRHS(m_t, m_y.data(), m_f.data());
+        m_y[j] = ysave;
+        if (!ok) {
+            throw CanteraError("ExtrapolationIntegrator::evalJacobian",
+                "Right-hand side evaluation failed while computing the Jacobian:\n{}",
+                m_func->getErrors());
+        }
+        m_jac.col(j) = (m_f - m_f0) / inc;
+    }
+}
+
+double ExtrapolationIntegrator::weightedNorm(const Eigen::VectorXd& v) const
+{
+    double sum = 0.0;
+    for (size_t i = 0; i < m_neq; i++) {
+        double w = m_reltol * std::abs(m_y[i]) + m_abstol[i];
+        sum += (v[i] / w) * (v[i] / w);
+    }
+    return sqrt(sum / m_neq);
+}
+
+double ExtrapolationIntegrator::initialStepSize(double tout)
+{
+    // Algorithm from Hairer, Norsett and Wanner, "Solving Ordinary Differential
+    // Equations I", Section II.4, using an explicit Euler step to estimate the
+    // second derivative of the solution.
+    double d0 = weightedNorm(m_y);
+    double d1 = weightedNorm(m_f0);
+    double h0 = (d0 < 1e-5 || d1 < 1e-5) ? 1e-6 : 0.01 * d0 / d1;
+    if (tout > m_t) {
+        h0 = std::min(h0, tout - m_t);
+    }
+    m_ysub = m_y + h0 * m_f0;
+    double h;
+    if (evalRHS(m_t + h0, m_ysub.data(), m_f.data())) {
+        m_f -= m_f0;
+        double d2 = weightedNorm(m_f) / h0;
+        double dmax = std::max(d1, d2);
+        double h1 = (dmax <= 1e-15) ? std::max(1e-6, 1e-3 * h0)
+                                    : pow(0.01 / dmax, 1.0 / (m_order + 1));
+        h = std::min(100 * h0, h1);
+    } else {
+        h = 1e-3 * h0;
+    }
+    if (tout > m_t) {
+        h = std::min(h, tout - m_t);
+    }
+    if (m_hmax > 0.0) {
+        h = std::min(h, m_hmax);
+    }
+    return h;
+}
+
+double ExtrapolationIntegrator::attemptStep(double h)
+{
+    // Linearly implicit Euler solutions using j+1 substeps in column j
+    for (int j = 0; j < m_order; j++) {
+        int nsub = j + 1;
+        double hs = h / nsub;
+        m_iter = -hs * m_jac;
+        m_iter.diagonal().array() += 1.0;
+        m_lu.compute(m_iter);
+        m_nLinSetups++;
+        m_ysub = m_y;
+        for (int i = 0; i < nsub; i++) {
+            if (i == 0) {
+                m_f = m_f0;
+            } else if (!evalRHS(m_t + i * hs, m_ysub.data(), m_f.data())) {
+                return -1.0;
+            }
+            m_f *= hs;
+            m_dy.noalias() = m_lu.solve(m_f);
+            m_ysub += m_dy;
+        }
+        m_table.col(j) = m_ysub;
+    }
+
+    // Aitken-Neville extrapolation. After stage l, column j holds the solution of
+    // order l+1 based on columns j-l through j. The correction applied in the last
+    // stage is used as the error estimate.
+    for (int l = 1; l < m_order; l++) {
+        for (int j = m_order - 1; j >= l; j--) {
+            double denom = static_cast<double>(j + 1) / (j - l + 1) - 1.0;
+            if (l == m_order - 1) {
+                m_err = (m_table.col(j) - m_table.col(j - 1)) / denom;
+            }
+            m_table.col(j) += (m_table.col(j) - m_table.col(j - 1)) / denom;
+        }
+    }
+    m_ynew = m_table.col(m_order - 1);
+
+    double sum = 0.0;
+    for (size_t i = 0; i < m_neq; i++) {
+        double w = m_reltol * std::max(std::abs(m_y[i]), std::abs(m_ynew[i]))
+                   + m_abstol[i];
+        sum += (m_err[i] / w) * (m_err[i] / w);
+    }
+    double err = sqrt(sum / m_neq);
+    return std::isfinite(err) ? err : 1e10;
+}
+
+void ExtrapolationIntegrator::takeStep(double tout, bool clip)
+{
+    if (!evalRHS(m_t, m_y.data(), m_f0.data())) {
+        throw CanteraError("ExtrapolationIntegrator::takeStep",
+                           "Right-hand side evaluation failed at t = {}:\n{}",
+                           m_t, m_func->getErrors());
+    }
+    if (m_h <= 0.0) {
+        m_h = initialStepSize(tout);
+    }
+    double h = (m_hmax > 0.0) ? std::min(m_h, m_hmax) : m_h;
+    bool clipped = false;
+    if (clip && m_t + 1.01 * h >= tout) {
+        h = tout - m_t;
+        clipped = true;
+    }
+
+    evalJacobian(h);
+    int fails = 0;
+    while (true) {
+        double err = attemptStep(h);
+        if (err >= 0.0 && err <= 1.0) {
+            double fac = (err == 0.0) ? 4.0 :
+                std::min(4.0, std::max(0.2, 0.9 * pow(err, -1.0 / m_order)));
+            double t0 = m_t;
+            if (m_nRoots) {
+                m_yold = m_y;
+            }
+            m_t = clipped ? tout : m_t + h;
+            m_y = m_ynew;
+            // A step shortened to reach the output time does not limit the size
+            // of the following step
+            if (!clipped || h * fac > m_h) {
+                m_h = h * fac;
+            }
+            m_nSteps++;
+            if (m_nRoots) {
+                findRoots(t0);
+            }
+            return;
+        }
+
+        m_nErrTestFails++;
+        if (++fails > m_maxErrTestFails) {
+            throw CanteraError("ExtrapolationIntegrator::takeStep",
+                "Error test failed {} times at t = {} with step size {}.\n{}",
+                fails, m_t, h, m_func->getErrors());
+        }
+        if (err < 0.0 || fails >= 3) {
+            // Repeated failures indicate that the asymptotic error behavior assumed
+            // by the step size controller does not hold (for example, during fast
+            // initial transients), so reduce the step size more aggressively.
+            h *= 0.1;
+        } else {
+            h *= std::max(0.2, 0.9 * pow(err, -1.0 / m_order));
+        }
+        if (h <= m_hmin || m_t + h == m_t) {
+            throw CanteraError("ExtrapolationIntegrator::takeStep",
+                "Step size {} at t = {} is below the minimum step size.", h, m_t);
+        }
+        m_h = h;
+        clipped = false;
+    }
+}
+
+void ExtrapolationIntegrator::interpolate(double t0, double t)
+{
+    double h = m_t - t0;
+    double s = (t - t0) / h;
+    double s2 = s * s;
+    double s3 = s2 * s;
+    m_ysub = (2 * s3 - 3 * s2 + 1) * m_yold + (s3 - 2 * s2 + s) * h * m_f0
+             + (3 * s2 - 2 * s3) * m_y + (s3 - s2) * h * m_fnew;
+}
+
+void ExtrapolationIntegrator::findRoots(double t0)
+{
+    // A root function changes sign if it crosses zero or reaches zero from a
+    // non-zero value. Functions that start the step at zero are ignored.
+    auto crossed = [](double glo, double ghi) {
+        return (glo < 0 && ghi >= 0) || (glo > 0 && ghi <= 0);
+    };
+    m_func->evalRootFunctions(m_t, m_y.data(), m_gHi.data());
+    bool found = false;
+    for (size_t i = 0; i < m_nRoots; i++) {
+        found = found || crossed(m_gPrev[i], m_gHi[i]);
+    }
+    if (!found) {
+        m_gPrev = m_gHi;
+        return;
+    }
+
+    if (!evalRHS(m_t, m_y.data(), m_fnew.data())) {
+        throw CanteraError("ExtrapolationIntegrator::findRoots",
+                           "Right-hand side evaluation failed at t = {}:\n{}",
+                           m_t, m_func->getErrors());
+    }
+
+    // Illinois algorithm, as used by CVODES. The bracket [tlo, thi] always
+    // contains the earliest crossing.
+    double tlo = t0;
+    double thi = m_t;
+    m_gLo = m_gPrev;
+    double ttol = 100 * std::numeric_limits<double>::epsilon()
+                  * (std::abs(m_t) + std::abs(m_t - t0));
+    double alpha = 1.0;
+    int side = 0;
+    while (thi - tlo > ttol) {
+        // Secant estimate based on the function with the earliest crossing
+        double tmid = thi;
+        for (size_t i = 0; i < m_nRoots; i++) {
+            if (crossed(m_gLo[i], m_gHi[i])) {
+                double ti = thi - (thi - tlo) * m_gHi[i]
+                                  / (m_gHi[i] - alpha * m_gLo[i]);
+                tmid = std::min(tmid, ti);
+            }
+        }
+        // Keep the trial point away from the ends of the bracket
+        double frac = std::min(0.1, 0.5 * (thi - tlo) / (m_t - t0));
+        if (tmid - tlo < 0.5 * ttol) {
+            tmid = tlo + frac * (thi - tlo);
+        } else if (thi - tmid < 0.5 * ttol) {
+            tmid = thi - frac * (thi - tlo);
+        }
+
+        interpolate(t0, tmid);
+        m_func->evalRootFunctions(tmid, m_ysub.data(), m_gMid.data());
+        bool lower = false;
+        bool zero = false;
+        for (size_t i = 0; i < m_nRoots; i++) {
+            if (crossed(m_gLo[i], m_gHi[i])) {
+                lower = lower || crossed(m_gLo[i], m_gMid[i]);
+                zero = zero || m_gMid[i] == 0.0;
+            }
+        }
+        int sidePrev = side;
+        if (lower) {
+            thi = tmid;
+            m_gHi = m_gMid;
+            if (zero) {
+                break;
+            }
+            side = 1;
+        } else {
+            tlo = tmid;
+            m_gLo = m_gMid;
+            side = 2;
+        }
+        if (side == sidePrev) {
+            alpha = (side == 2) ? 2 * alpha : 0.5 * alpha;
+        } else {
+            alpha = 1.0;
+        }
+    }
+
+    m_rootInfo.assign(m_nRoots, 0);
+    for (size_t i = 0; i < m_nRoots; i++) {
+        if (crossed(m_gLo[i], m_gHi[i])) {
+            m_rootInfo[i] = (m_gLo[i] < 0) ? 1 : -1;
+        }
+    }
+    if (thi < m_t) {
+        interpolate(t0, thi);
+        m_y = m_ysub;
+        m_t = thi;
+    }
+    m_gPrev = m_gHi;
+}
+
+AnyMap ExtrapolationIntegrator::solverStats() const
+{
+    AnyMap stats;
+    stats["steps"] = m_nSteps;
+    stats["rhs_evals"] = m_nEvals;
+    stats["jac_evals"] = m_nJacEvals;
+    stats["err_test_fails"] = m_nErrTestFails;
+    stats["lin_solve_setups"] = m_nLinSetups;
+    return stats;
+}
+
+}
@@ -68,6 +68,32 @@ int FuncEval::evalDaeNoThrow(double t, double* y, double* ydot, double* r)
     return 0; // successful evaluation
 }
 
+int FuncEval::evalRootFunctionsNoThrow(double t, double* y, double* gout)
+{
+    try {
+        evalRootFunctions(t, y, gout);
+    } catch (std::exception& err) {
+        if (suppressErrors()) {
+            m_errors.push_back(err.what());
+        } else {
+            writelog("FuncEval::evalRootFunctionsNoThrow: unhandled exception:\n");
+            writelog(err.what());
+            writelogendl();
+        }
+        return -1;
+    } catch (...) {
+        string msg = "FuncEval::evalRootFunctionsNoThrow: unhandled exception "
+                     "of unknown type\n";
+        if (suppressErrors()) {
+            m_errors.push_back(msg);
+        } else {
+            writelog(msg);
+        }
+        return -1;
+    }
+    return 0;
+}
+
 string FuncEval::getErrors() const {
     std::stringstream errs;
     for (const auto& err : m_errors) {
@@ -7,6 +7,7 @@
 #include "cantera/numerics/Integrator.h"
 #include "cantera/numerics/CVodesIntegrator.h"
 #include "cantera/numerics/IdasIntegrator.h"
+#include "cantera/numerics/ExtrapolationIntegrator.h"
 
 namespace Cantera
 {
@@ -17,6 +18,8 @@ Integrator* newIntegrator(const string& itype)
         return new CVodesIntegrator();
     } else if (itype == "IDA") {
         return new IdasIntegrator();
+    } else if (itype == "Extrapolation") {
+        return new ExtrapolationIntegrator();
     } else {
         throw CanteraError("newIntegrator",
                            "unknown integrator: "+itype);
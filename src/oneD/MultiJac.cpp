@@ -4,6 +4,7 @@
 // at https://cantera.org/license.txt for license and copyright information.
 
 #include "cantera/oneD/MultiJac.h"
+#include "cantera/base/Profiler.h"
 #include <ctime>
 
 namespace Cantera
@@ -35,6 +36,7 @@ void MultiJac::incrementDiagonal(int j, double d)
 
 void MultiJac::eval(double* x0, double* resid0, double rdt)
 {
+    CT_PROFILE_ZONE("MultiJac::eval");
     m_nevals++;
     clock_t t0 = clock();
     bfill(0.0);
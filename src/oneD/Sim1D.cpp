@@ -96,7 +96,8 @@ void Sim1D::setProfile(size_t dom, size_t comp,
 }
 
 void Sim1D::save(const string& fname, const string& name, const string& desc,
-                 bool overwrite, int compression, const string& basis)
+                 bool overwrite, int compression, const string& basis,
+                 bool binary)
 {
     size_t dot = fname.find_last_of(".");
     string extension = (dot != npos) ? toLowerCopy(fname.substr(dot+1)) : "";
@@ -134,6 +135,11 @@ void Sim1D::save(const string& fname, const string& name, const string& desc,
             auto arr = dom->asArray(m_state->data() + dom->loc());
             arr->writeEntry(data, name, dom->id(), overwrite);
         }
+        if (binary) {
+            // Store large numeric arrays as base64-encoded binary blocks
+            data.setMetadata("binary-threshold",
+                             AnyValue(SolutionArray::s_binaryThreshold));
+        }
 
         // Write the output file and remove the now-outdated cached file
         std::ofstream out(fname);
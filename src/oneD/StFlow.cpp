@@ -238,22 +238,18 @@ void StFlow::_getInitialSoln(double* x)
 
 void StFlow::setGas(const double* x, size_t j)
 {
-    m_thermo->setTemperature(T(x,j));
     const double* yy = x + m_nv*j + c_offset_Y;
-    m_thermo->setMassFractions_NoNorm(yy);
-    m_thermo->setPressure(m_press);
+    m_thermo->setState_TPY_NoNorm(T(x,j), m_press, yy);
 }
 
 void StFlow::setGasAtMidpoint(const double* x, size_t j)
 {
-    m_thermo->setTemperature(0.5*(T(x,j)+T(x,j+1)));
     const double* yyj = x + m_nv*j + c_offset_Y;
     const double* yyjp = x + m_nv*(j+1) + c_offset_Y;
     for (size_t k = 0; k < m_nsp; k++) {
         m_ybar[k] = 0.5*(yyj[k] + yyjp[k]);
     }
-    m_thermo->setMassFractions_NoNorm(m_ybar.data());
-    m_thermo->setPressure(m_press);
+    m_thermo->setState_TPY_NoNorm(0.5*(T(x,j)+T(x,j+1)), m_press, m_ybar.data());
 }
 
 void StFlow::_finalize(const double* x)
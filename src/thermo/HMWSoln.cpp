@@ -373,6 +373,7 @@ void HMWSoln::setBinarySalt(const string& sp1, const string& sp2,
     }
     m_Alpha1MX_ij[c] = alpha1;
     m_Alpha2MX_ij[c] = alpha2;
+    m_pitzerTemp = NAN;
 }
 
 void HMWSoln::setTheta(const string& sp1, const string& sp2,
@@ -396,6 +397,7 @@ void HMWSoln::setTheta(const string& sp1, const string& sp2,
     for (size_t n = 0; n < nParams; n++) {
         m_Theta_ij_coeff(n, c) = theta[n];
     }
+    m_pitzerTemp = NAN;
 }
 
 void HMWSoln::setPsi(const string& sp1, const string& sp2,
@@ -432,6 +434,7 @@ void HMWSoln::setPsi(const string& sp1, const string& sp2,
         }
         m_Psi_ijk[c] = psi[0];
     }
+    m_pitzerTemp = NAN;
 }
 
 void HMWSoln::setLambda(const string& sp1, const string& sp2,
@@ -459,6 +462,7 @@ void HMWSoln::setLambda(const string& sp1, const string& sp2,
         m_Lambda_nj_coeff(n, c) = lambda[n];
     }
     m_Lambda_nj(k1, k2) = lambda[0];
+    m_pitzerTemp = NAN;
 }
 
 void HMWSoln::setMunnn(const string& sp, size_t nParams, double* munnn)
@@ -477,6 +481,7 @@ void HMWSoln::setMunnn(const string& sp, size_t nParams, double* munnn)
         m_Mu_nnn_coeff(n, k) = munnn[n];
     }
     m_Mu_nnn[k] = munnn[0];
+    m_pitzerTemp = NAN;
 }
 
 void HMWSoln::setZeta(const string& sp1, const string& sp2,
@@ -520,6 +525,7 @@ void HMWSoln::setZeta(const string& sp1, const string& sp2,
         m_Psi_ijk_coeff(n, c) = psi[n];
     }
     m_Psi_ijk[c] = psi[0];
+    m_pitzerTemp = NAN;
 }
 
 void HMWSoln::setPitzerTempModel(const string& model)
@@ -534,6 +540,7 @@ void HMWSoln::setPitzerTempModel(const string& model)
         throw CanteraError("HMWSoln::setPitzerTempModel",
                            "Unknown Pitzer ActivityCoeff Temp model: {}", model);
     }
+    m_pitzerTemp = NAN;
 }
 
 void HMWSoln::setA_Debye(double A)
@@ -1022,12 +1029,19 @@ double HMWSoln::dA_DebyedT_TP(double tempArg, double presArg) const
         P = presArg;
     }
     double dAdT;
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
     switch (m_form_A_Debye) {
     case A_DEBYE_CONST:
         dAdT = 0.0;
         break;
     case A_DEBYE_WATER:
-        dAdT = m_waterProps->ADebye(T, P, 1);
+        if(cached.validate(T, P)) {
+            dAdT = cached.value;
+        } else {
+            dAdT = m_waterProps->ADebye(T, P, 1);
+            cached.value = dAdT;
+        }
         break;
     default:
         throw CanteraError("HMWSoln::dA_DebyedT_TP", "shouldn't be here");
@@ -1112,12 +1126,19 @@ double HMWSoln::d2A_DebyedT2_TP(double tempArg, double presArg) const
         P = presArg;
     }
     double d2AdT2;
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
     switch (m_form_A_Debye) {
     case A_DEBYE_CONST:
         d2AdT2 = 0.0;
         break;
     case A_DEBYE_WATER:
-        d2AdT2 = m_waterProps->ADebye(T, P, 2);
+        if(cached.validate(T, P)) {
+            d2AdT2 = cached.value;
+        } else {
+            d2AdT2 = m_waterProps->ADebye(T, P, 2);
+            cached.value = d2AdT2;
+        }
         break;
     default:
         throw CanteraError("HMWSoln::d2A_DebyedT2_TP", "shouldn't be here");
@@ -1209,31 +1230,9 @@ void HMWSoln::initLengths()
     m_g2func_IJ.resize(maxCounterIJlen, 0.0);
     m_hfunc_IJ.resize(maxCounterIJlen, 0.0);
     m_h2func_IJ.resize(maxCounterIJlen, 0.0);
-    m_BMX_IJ.resize(maxCounterIJlen, 0.0);
-    m_BMX_IJ_L.resize(maxCounterIJlen, 0.0);
-    m_BMX_IJ_LL.resize(maxCounterIJlen, 0.0);
-    m_BMX_IJ_P.resize(maxCounterIJlen, 0.0);
-    m_BprimeMX_IJ.resize(maxCounterIJlen, 0.0);
-    m_BprimeMX_IJ_L.resize(maxCounterIJlen, 0.0);
-    m_BprimeMX_IJ_LL.resize(maxCounterIJlen, 0.0);
-    m_BprimeMX_IJ_P.resize(maxCounterIJlen, 0.0);
-    m_BphiMX_IJ.resize(maxCounterIJlen, 0.0);
-    m_BphiMX_IJ_L.resize(maxCounterIJlen, 0.0);
-    m_BphiMX_IJ_LL.resize(maxCounterIJlen, 0.0);
-    m_BphiMX_IJ_P.resize(maxCounterIJlen, 0.0);
-    m_Phi_IJ.resize(maxCounterIJlen, 0.0);
-    m_Phi_IJ_L.resize(maxCounterIJlen, 0.0);
-    m_Phi_IJ_LL.resize(maxCounterIJlen, 0.0);
-    m_Phi_IJ_P.resize(maxCounterIJlen, 0.0);
-    m_Phiprime_IJ.resize(maxCounterIJlen, 0.0);
-    m_PhiPhi_IJ.resize(maxCounterIJlen, 0.0);
-    m_PhiPhi_IJ_L.resize(maxCounterIJlen, 0.0);
-    m_PhiPhi_IJ_LL.resize(maxCounterIJlen, 0.0);
-    m_PhiPhi_IJ_P.resize(maxCounterIJlen, 0.0);
-    m_CMX_IJ.resize(maxCounterIJlen, 0.0);
-    m_CMX_IJ_L.resize(maxCounterIJlen, 0.0);
-    m_CMX_IJ_LL.resize(maxCounterIJlen, 0.0);
-    m_CMX_IJ_P.resize(maxCounterIJlen, 0.0);
+    m_Etheta_IJ.resize(maxCounterIJlen, 0.0);
+    m_Etheta_prime_IJ.resize(maxCounterIJlen, 0.0);
+    m_pitzerTemp = NAN;
 
     m_gamma_tmp.resize(m_kk, 0.0);
     IMS_lnActCoeffMolal_.resize(m_kk, 0.0);
@@ -1559,9 +1558,80 @@ void HMWSoln::calcMCCutoffParams_()
     }
 }
 
+void HMWSoln::initPitzerInteractions() const
+{
+    m_pairsCA.clear();
+    m_pairsLike.clear();
+    m_psiTriplets.clear();
+    m_lambdaPairs.clear();
+    m_neutralSolutes.clear();
+    m_psiIndices.clear();
+    for (size_t i = 1; i < m_kk; i++) {
+        if (charge(i) == 0.0) {
+            m_neutralSolutes.push_back(i);
+        }
+        for (size_t j = i + 1; j < m_kk; j++) {
+            size_t c = m_CounterIJ[m_kk * i + j];
+            if (charge(i) * charge(j) < 0.0) {
+                if (charge(i) > 0.0) {
+                    m_pairsCA.push_back({i, j, c});
+                } else {
+                    m_pairsCA.push_back({j, i, c});
+                }
+            } else if (charge(i) * charge(j) > 0.0) {
+                m_pairsLike.push_back({i, j, c});
+            }
+        }
+    }
+
+    auto nonzero = [](const Array2D& coeffs, size_t n) {
+        for (size_t m = 0; m < coeffs.nRows(); m++) {
+            if (coeffs(m, n) != 0.0) {
+                return true;
+            }
+        }
+        return false;
+    };
+    for (size_t i : m_neutralSolutes) {
+        for (size_t j = 1; j < m_kk; j++) {
+            if (nonzero(m_Lambda_nj_coeff, i * m_kk + j)) {
+                m_lambdaPairs.push_back({i, j, 0});
+            }
+        }
+    }
+
+    // Each psi parameter is stored for all permutations of the three species,
+    // while each zeta parameter is stored once, with the neutral species first
+    // and the cation second
+    for (size_t n = 0; n < m_Psi_ijk_coeff.nColumns(); n++) {
+        if (!nonzero(m_Psi_ijk_coeff, n)) {
+            continue;
+        }
+        m_psiIndices.push_back(n);
+        size_t i = n / (m_kk * m_kk);
+        size_t j = (n / m_kk) % m_kk;
+        size_t k = n % m_kk;
+        if (charge(i) == 0.0) {
+            if (charge(j) > 0.0 && charge(k) < 0.0) {
+                m_psiTriplets.push_back({i, j, k, n});
+            }
+        } else if (i < j && charge(i) * charge(j) > 0.0 && charge(i) * charge(k) < 0.0) {
+            m_psiTriplets.push_back({i, j, k, n});
+        }
+    }
+}
+
 void HMWSoln::s_updatePitzer_CoeffWRTemp(int doDerivs) const
 {
     double T = temperature();
+    if (T == m_pitzerTemp) {
+        return;
+    }
+    if (std::isnan(m_pitzerTemp)) {
+        initPitzerInteractions();
+    }
+    m_pitzerTemp = T;
+
     const double twoT = 2.0 * T;
     const double invT = 1.0 / T;
     const double invT2 = invT * invT;
@@ -1576,232 +1646,62 @@ void HMWSoln::s_updatePitzer_CoeffWRTemp(int doDerivs) const
         tinv = 1.0/T - 1.0/m_TempPitzerRef;
     }
 
-    for (size_t i = 1; i < (m_kk - 1); i++) {
-        for (size_t j = (i+1); j < m_kk; j++) {
-            // Find the counterIJ for the symmetric binary interaction
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            const double* beta0MX_coeff = m_Beta0MX_ij_coeff.ptrColumn(counterIJ);
-            const double* beta1MX_coeff = m_Beta1MX_ij_coeff.ptrColumn(counterIJ);
-            const double* beta2MX_coeff = m_Beta2MX_ij_coeff.ptrColumn(counterIJ);
-            const double* CphiMX_coeff = m_CphiMX_ij_coeff.ptrColumn(counterIJ);
-            const double* Theta_coeff = m_Theta_ij_coeff.ptrColumn(counterIJ);
-
-            switch (m_formPitzerTemp) {
-            case PITZER_TEMP_CONSTANT:
-                break;
-            case PITZER_TEMP_LINEAR:
-
-                m_Beta0MX_ij[counterIJ] = beta0MX_coeff[0]
-                                          + beta0MX_coeff[1]*tlin;
-                m_Beta0MX_ij_L[counterIJ] = beta0MX_coeff[1];
-                m_Beta0MX_ij_LL[counterIJ] = 0.0;
-                m_Beta1MX_ij[counterIJ] = beta1MX_coeff[0]
-                                            + beta1MX_coeff[1]*tlin;
-                m_Beta1MX_ij_L[counterIJ] = beta1MX_coeff[1];
-                m_Beta1MX_ij_LL[counterIJ] = 0.0;
-                m_Beta2MX_ij[counterIJ] = beta2MX_coeff[0]
-                                             + beta2MX_coeff[1]*tlin;
-                m_Beta2MX_ij_L[counterIJ] = beta2MX_coeff[1];
-                m_Beta2MX_ij_LL[counterIJ] = 0.0;
-                m_CphiMX_ij[counterIJ] = CphiMX_coeff[0]
-                                             + CphiMX_coeff[1]*tlin;
-                m_CphiMX_ij_L[counterIJ] = CphiMX_coeff[1];
-                m_CphiMX_ij_LL[counterIJ] = 0.0;
-                m_Theta_ij[counterIJ] = Theta_coeff[0] + Theta_coeff[1]*tlin;
-                m_Theta_ij_L[counterIJ] = Theta_coeff[1];
-                m_Theta_ij_LL[counterIJ] = 0.0;
-                break;
-
-            case PITZER_TEMP_COMPLEX1:
-                m_Beta0MX_ij[counterIJ] = beta0MX_coeff[0]
-                                          + beta0MX_coeff[1]*tlin
-                                          + beta0MX_coeff[2]*tquad
-                                          + beta0MX_coeff[3]*tinv
-                                          + beta0MX_coeff[4]*tln;
-                m_Beta1MX_ij[counterIJ] = beta1MX_coeff[0]
-                                          + beta1MX_coeff[1]*tlin
-                                          + beta1MX_coeff[2]*tquad
-                                          + beta1MX_coeff[3]*tinv
-                                          + beta1MX_coeff[4]*tln;
-                m_Beta2MX_ij[counterIJ] = beta2MX_coeff[0]
-                                          + beta2MX_coeff[1]*tlin
-                                          + beta2MX_coeff[2]*tquad
-                                          + beta2MX_coeff[3]*tinv
-                                          + beta2MX_coeff[4]*tln;
-                m_CphiMX_ij[counterIJ] = CphiMX_coeff[0]
-                                         + CphiMX_coeff[1]*tlin
-                                         + CphiMX_coeff[2]*tquad
-                                         + CphiMX_coeff[3]*tinv
-                                         + CphiMX_coeff[4]*tln;
-                m_Theta_ij[counterIJ] = Theta_coeff[0]
-                                        + Theta_coeff[1]*tlin
-                                        + Theta_coeff[2]*tquad
-                                        + Theta_coeff[3]*tinv
-                                        + Theta_coeff[4]*tln;
-                m_Beta0MX_ij_L[counterIJ] = beta0MX_coeff[1]
-                                             + beta0MX_coeff[2]*twoT
-                                             - beta0MX_coeff[3]*invT2
-                                             + beta0MX_coeff[4]*invT;
-                m_Beta1MX_ij_L[counterIJ] = beta1MX_coeff[1]
-                                             + beta1MX_coeff[2]*twoT
-                                             - beta1MX_coeff[3]*invT2
-                                             + beta1MX_coeff[4]*invT;
-                m_Beta2MX_ij_L[counterIJ] = beta2MX_coeff[1]
-                                             + beta2MX_coeff[2]*twoT
-                                             - beta2MX_coeff[3]*invT2
-                                             + beta2MX_coeff[4]*invT;
-                m_CphiMX_ij_L[counterIJ] = CphiMX_coeff[1]
-                                            + CphiMX_coeff[2]*twoT
-                                            - CphiMX_coeff[3]*invT2
-                                            + CphiMX_coeff[4]*invT;
-                m_Theta_ij_L[counterIJ] = Theta_coeff[1]
-                                            + Theta_coeff[2]*twoT
-                                            - Theta_coeff[3]*invT2
-                                            + Theta_coeff[4]*invT;
-                doDerivs = 2;
-                if (doDerivs > 1) {
-                    m_Beta0MX_ij_LL[counterIJ] =
-                        + beta0MX_coeff[2]*2.0
-                        + beta0MX_coeff[3]*twoinvT3
-                        - beta0MX_coeff[4]*invT2;
-                    m_Beta1MX_ij_LL[counterIJ] =
-                        + beta1MX_coeff[2]*2.0
-                        + beta1MX_coeff[3]*twoinvT3
-                        - beta1MX_coeff[4]*invT2;
-                    m_Beta2MX_ij_LL[counterIJ] =
-                        + beta2MX_coeff[2]*2.0
-                        + beta2MX_coeff[3]*twoinvT3
-                        - beta2MX_coeff[4]*invT2;
-                    m_CphiMX_ij_LL[counterIJ] =
-                        + CphiMX_coeff[2]*2.0
-                        + CphiMX_coeff[3]*twoinvT3
-                        - CphiMX_coeff[4]*invT2;
-                    m_Theta_ij_LL[counterIJ] =
-                        + Theta_coeff[2]*2.0
-                        + Theta_coeff[3]*twoinvT3
-                        - Theta_coeff[4]*invT2;
-                }
-                break;
-            }
-        }
-    }
-
-    // Lambda interactions and Mu_nnn
-    // i must be neutral for this term to be nonzero. We take advantage of this
-    // here to lower the operation count.
-    for (size_t i = 1; i < m_kk; i++) {
-        if (charge(i) == 0.0) {
-            for (size_t j = 1; j < m_kk; j++) {
-                size_t n = i * m_kk + j;
-                const double* Lambda_coeff = m_Lambda_nj_coeff.ptrColumn(n);
-                switch (m_formPitzerTemp) {
-                case PITZER_TEMP_CONSTANT:
-                    m_Lambda_nj(i,j) = Lambda_coeff[0];
-                    break;
-                case PITZER_TEMP_LINEAR:
-                    m_Lambda_nj(i,j) = Lambda_coeff[0] + Lambda_coeff[1]*tlin;
-                    m_Lambda_nj_L(i,j) = Lambda_coeff[1];
-                    m_Lambda_nj_LL(i,j) = 0.0;
-                    break;
-                case PITZER_TEMP_COMPLEX1:
-                    m_Lambda_nj(i,j) = Lambda_coeff[0]
-                                       + Lambda_coeff[1]*tlin
-                                       + Lambda_coeff[2]*tquad
-                                       + Lambda_coeff[3]*tinv
-                                       + Lambda_coeff[4]*tln;
-
-                    m_Lambda_nj_L(i,j) = Lambda_coeff[1]
-                                         + Lambda_coeff[2]*twoT
-                                         - Lambda_coeff[3]*invT2
-                                         + Lambda_coeff[4]*invT;
-
-                    m_Lambda_nj_LL(i,j) =
-                        Lambda_coeff[2]*2.0
-                        + Lambda_coeff[3]*twoinvT3
-                        - Lambda_coeff[4]*invT2;
-                }
-
-                if (j == i) {
-                    const double* Mu_coeff = m_Mu_nnn_coeff.ptrColumn(i);
-                    switch (m_formPitzerTemp) {
-                    case PITZER_TEMP_CONSTANT:
-                        m_Mu_nnn[i] = Mu_coeff[0];
-                        break;
-                    case PITZER_TEMP_LINEAR:
-                        m_Mu_nnn[i] = Mu_coeff[0] + Mu_coeff[1]*tlin;
-                        m_Mu_nnn_L[i] = Mu_coeff[1];
-                        m_Mu_nnn_LL[i] = 0.0;
-                        break;
-                    case PITZER_TEMP_COMPLEX1:
-                        m_Mu_nnn[i] = Mu_coeff[0]
-                                      + Mu_coeff[1]*tlin
-                                      + Mu_coeff[2]*tquad
-                                      + Mu_coeff[3]*tinv
-                                      + Mu_coeff[4]*tln;
-                        m_Mu_nnn_L[i] = Mu_coeff[1]
-                                        + Mu_coeff[2]*twoT
-                                        - Mu_coeff[3]*invT2
-                                        + Mu_coeff[4]*invT;
-                        m_Mu_nnn_LL[i] =
-                            Mu_coeff[2]*2.0
-                            + Mu_coeff[3]*twoinvT3
-                            - Mu_coeff[4]*invT2;
-                    }
-                }
-            }
-        }
-    }
-
-    switch(m_formPitzerTemp) {
-    case PITZER_TEMP_CONSTANT:
-      for (size_t i = 1; i < m_kk; i++) {
-          for (size_t j = 1; j < m_kk; j++) {
-              for (size_t k = 1; k < m_kk; k++) {
-                  size_t n = i * m_kk *m_kk + j * m_kk + k;
-                  const double* Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
-                  m_Psi_ijk[n] = Psi_coeff[0];
-              }
-          }
-      }
-      break;
-    case PITZER_TEMP_LINEAR:
-      for (size_t i = 1; i < m_kk; i++) {
-          for (size_t j = 1; j < m_kk; j++) {
-              for (size_t k = 1; k < m_kk; k++) {
-                  size_t n = i * m_kk *m_kk + j * m_kk + k;
-                  const double* Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
-                  m_Psi_ijk[n] = Psi_coeff[0] + Psi_coeff[1]*tlin;
-                  m_Psi_ijk_L[n] = Psi_coeff[1];
-                  m_Psi_ijk_LL[n] = 0.0;
-              }
-          }
-      }
-      break;
-    case PITZER_TEMP_COMPLEX1:
-      for (size_t i = 1; i < m_kk; i++) {
-          for (size_t j = 1; j < m_kk; j++) {
-              for (size_t k = 1; k < m_kk; k++) {
-                  size_t n = i * m_kk *m_kk + j * m_kk + k;
-                  const double* Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
-                  m_Psi_ijk[n] = Psi_coeff[0]
-                                 + Psi_coeff[1]*tlin
-                                 + Psi_coeff[2]*tquad
-                                 + Psi_coeff[3]*tinv
-                                 + Psi_coeff[4]*tln;
-                  m_Psi_ijk_L[n] = Psi_coeff[1]
-                                   + Psi_coeff[2]*twoT
-                                   - Psi_coeff[3]*invT2
-                                   + Psi_coeff[4]*invT;
-                  m_Psi_ijk_LL[n] =
-                      Psi_coeff[2]*2.0
-                      + Psi_coeff[3]*twoinvT3
-                      - Psi_coeff[4]*invT2;
-              }
-          }
-      }
-      break;
+    // Evaluate the parameter with the temperature coefficients *coeff*, and its
+    // first and second temperature derivatives
+    auto evaluate = [&](const double* coeff, double& value, double& value_L,
+                        double& value_LL) {
+        switch (m_formPitzerTemp) {
+        case PITZER_TEMP_CONSTANT:
+            value = coeff[0];
+            break;
+        case PITZER_TEMP_LINEAR:
+            value = coeff[0] + coeff[1]*tlin;
+            value_L = coeff[1];
+            value_LL = 0.0;
+            break;
+        case PITZER_TEMP_COMPLEX1:
+            value = coeff[0]
+                    + coeff[1]*tlin
+                    + coeff[2]*tquad
+                    + coeff[3]*tinv
+                    + coeff[4]*tln;
+            value_L = coeff[1]
+                      + coeff[2]*twoT
+                      - coeff[3]*invT2
+                      + coeff[4]*invT;
+            value_LL = coeff[2]*2.0
+                       + coeff[3]*twoinvT3
+                       - coeff[4]*invT2;
+            break;
+        }
+    };
+
+    // Only the parameters which appear in the interaction lists are evaluated
+    for (const auto& [i, j, c] : m_pairsCA) {
+        evaluate(m_Beta0MX_ij_coeff.ptrColumn(c), m_Beta0MX_ij[c],
+                 m_Beta0MX_ij_L[c], m_Beta0MX_ij_LL[c]);
+        evaluate(m_Beta1MX_ij_coeff.ptrColumn(c), m_Beta1MX_ij[c],
+                 m_Beta1MX_ij_L[c], m_Beta1MX_ij_LL[c]);
+        evaluate(m_Beta2MX_ij_coeff.ptrColumn(c), m_Beta2MX_ij[c],
+                 m_Beta2MX_ij_L[c], m_Beta2MX_ij_LL[c]);
+        evaluate(m_CphiMX_ij_coeff.ptrColumn(c), m_CphiMX_ij[c],
+                 m_CphiMX_ij_L[c], m_CphiMX_ij_LL[c]);
+    }
+    for (const auto& [i, j, c] : m_pairsLike) {
+        evaluate(m_Theta_ij_coeff.ptrColumn(c), m_Theta_ij[c],
+                 m_Theta_ij_L[c], m_Theta_ij_LL[c]);
+    }
+    for (const auto& [i, j, c] : m_lambdaPairs) {
+        evaluate(m_Lambda_nj_coeff.ptrColumn(i * m_kk + j), m_Lambda_nj(i, j),
+                 m_Lambda_nj_L(i, j), m_Lambda_nj_LL(i, j));
+    }
+    for (size_t i : m_neutralSolutes) {
+        evaluate(m_Mu_nnn_coeff.ptrColumn(i), m_Mu_nnn[i], m_Mu_nnn_L[i],
+                 m_Mu_nnn_LL[i]);
+    }
+    for (size_t n : m_psiIndices) {
+        evaluate(m_Psi_ijk_coeff.ptrColumn(n), m_Psi_ijk[n], m_Psi_ijk_L[n],
+                 m_Psi_ijk_LL[n]);
     }
 }
 
@@ -1810,483 +1710,68 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
     // Use the CROPPED molality of the species in solution.
     const vector<double>& molality = m_molalitiesCropped;
 
-    // These are data inputs about the Pitzer correlation. They come from the
-    // input file for the Pitzer model.
-    vector<double>& gamma_Unscaled = m_gamma_tmp;
-
-    // Local variables defined by Coltrin
-    double etheta[5][5], etheta_prime[5][5], sqrtIs;
-
-    // Molality based ionic strength of the solution
+    // Molality based ionic strength of the solution, and the sum of the
+    // molalities over all solutes, even those with zero charge.
     double Is = 0.0;
-
-    // Molar charge of the solution: In Pitzer's notation, this is his variable
-    // called "Z".
-    double molarcharge = 0.0;
-
-    // molalitysum is the sum of the molalities over all solutes, even those
-    // with zero charge.
     double molalitysumUncropped = 0.0;
-
-    // Make sure the counter variables are setup
-    counterIJ_setup();
-
-    // ---------- Calculate common sums over solutes ---------------------
     for (size_t n = 1; n < m_kk; n++) {
-        // ionic strength
         Is += charge(n) * charge(n) * molality[n];
-        // total molar charge
-        molarcharge += fabs(charge(n)) * molality[n];
         molalitysumUncropped += m_molalities[n];
     }
     Is *= 0.5;
 
     // Store the ionic molality in the object for reference.
     m_IionicMolality = Is;
-    sqrtIs = sqrt(Is);
-
-    // The following call to calc_lambdas() calculates all 16 elements of the
-    // elambda and elambda1 arrays, given the value of the ionic strength (Is)
-    calc_lambdas(Is);
-
-    // Step 2: Find the coefficients E-theta and E-thetaprime for all
-    // combinations of positive unlike charges up to 4
-    for (int z1 = 1; z1 <=4; z1++) {
-        for (int z2 =1; z2 <=4; z2++) {
-            calc_thetas(z1, z2, &etheta[z1][z2], &etheta_prime[z1][z2]);
-        }
-    }
+    double sqrtIs = sqrt(Is);
 
     // calculate g(x) and hfunc(x) for each cation-anion pair MX. In the
     // original literature, hfunc, was called gprime. However, it's not the
     // derivative of g(x), so I renamed it.
-    for (size_t i = 1; i < (m_kk - 1); i++) {
-        for (size_t j = (i+1); j < m_kk; j++) {
-            // Find the counterIJ for the symmetric binary interaction
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            // Only loop over oppositely charge species
-            if (charge(i)*charge(j) < 0) {
-                // x is a reduced function variable
-                double x1 = sqrtIs * m_Alpha1MX_ij[counterIJ];
-                if (x1 > 1.0E-100) {
-                    m_gfunc_IJ[counterIJ] = 2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 * x1);
-                    m_hfunc_IJ[counterIJ] = -2.0 *
-                                       (1.0-(1.0 + x1 + 0.5 * x1 * x1) * exp(-x1)) / (x1 * x1);
-                } else {
-                    m_gfunc_IJ[counterIJ] = 0.0;
-                    m_hfunc_IJ[counterIJ] = 0.0;
-                }
-
-                if (m_Beta2MX_ij[counterIJ] != 0.0) {
-                    double x2 = sqrtIs * m_Alpha2MX_ij[counterIJ];
-                    if (x2 > 1.0E-100) {
-                        m_g2func_IJ[counterIJ] = 2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
-                        m_h2func_IJ[counterIJ] = -2.0 *
-                                            (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
-                    } else {
-                        m_g2func_IJ[counterIJ] = 0.0;
-                        m_h2func_IJ[counterIJ] = 0.0;
-                    }
-                }
-            } else {
-                m_gfunc_IJ[counterIJ] = 0.0;
-                m_hfunc_IJ[counterIJ] = 0.0;
-            }
-        }
-    }
-
-    // SUBSECTION TO CALCULATE BMX, BprimeMX, BphiMX
-    // Agrees with Pitzer, Eq. (49), (51), (55)
-    for (size_t i = 1; i < m_kk - 1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            // Find the counterIJ for the symmetric binary interaction
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            // both species have a non-zero charge, and one is positive and the
-            // other is negative
-            if (charge(i)*charge(j) < 0.0) {
-                m_BMX_IJ[counterIJ] = m_Beta0MX_ij[counterIJ]
-                                  + m_Beta1MX_ij[counterIJ] * m_gfunc_IJ[counterIJ]
-                                  + m_Beta2MX_ij[counterIJ] * m_g2func_IJ[counterIJ];
-
-                if (Is > 1.0E-150) {
-                    m_BprimeMX_IJ[counterIJ] = (m_Beta1MX_ij[counterIJ] * m_hfunc_IJ[counterIJ]/Is +
-                                           m_Beta2MX_ij[counterIJ] * m_h2func_IJ[counterIJ]/Is);
-                } else {
-                    m_BprimeMX_IJ[counterIJ] = 0.0;
-                }
-                m_BphiMX_IJ[counterIJ] = m_BMX_IJ[counterIJ] + Is*m_BprimeMX_IJ[counterIJ];
-            } else {
-                m_BMX_IJ[counterIJ] = 0.0;
-                m_BprimeMX_IJ[counterIJ] = 0.0;
-                m_BphiMX_IJ[counterIJ] = 0.0;
-            }
-        }
-    }
-
-    // SUBSECTION TO CALCULATE CMX
-    // Agrees with Pitzer, Eq. (53).
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            // Find the counterIJ for the symmetric binary interaction
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            // both species have a non-zero charge, and one is positive
-            // and the other is negative
-            if (charge(i)*charge(j) < 0.0) {
-                m_CMX_IJ[counterIJ] = m_CphiMX_ij[counterIJ]/
-                                 (2.0* sqrt(fabs(charge(i)*charge(j))));
-            } else {
-                m_CMX_IJ[counterIJ] = 0.0;
-            }
+    for (const auto& [i, j, c] : m_pairsCA) {
+        // x is a reduced function variable
+        double x1 = sqrtIs * m_Alpha1MX_ij[c];
+        if (x1 > 1.0E-100) {
+            m_gfunc_IJ[c] = 2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 * x1);
+            m_hfunc_IJ[c] = -2.0 *
+                (1.0-(1.0 + x1 + 0.5 * x1 * x1) * exp(-x1)) / (x1 * x1);
+        } else {
+            m_gfunc_IJ[c] = 0.0;
+            m_hfunc_IJ[c] = 0.0;
         }
-    }
 
-    // SUBSECTION TO CALCULATE Phi, PhiPrime, and PhiPhi
-    // Agrees with Pitzer, Eq. 72, 73, 74
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            // Find the counterIJ for the symmetric binary interaction
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            // both species have a non-zero charge, and one is positive and the
-            // other is negative
-            if (charge(i)*charge(j) > 0) {
-                int z1 = (int) fabs(charge(i));
-                int z2 = (int) fabs(charge(j));
-                m_Phi_IJ[counterIJ] = m_Theta_ij[counterIJ] + etheta[z1][z2];
-                m_Phiprime_IJ[counterIJ] = etheta_prime[z1][z2];
-                m_PhiPhi_IJ[counterIJ] = m_Phi_IJ[counterIJ] + Is * m_Phiprime_IJ[counterIJ];
-            } else {
-                m_Phi_IJ[counterIJ] = 0.0;
-                m_Phiprime_IJ[counterIJ] = 0.0;
-                m_PhiPhi_IJ[counterIJ] = 0.0;
-            }
+        double x2 = sqrtIs * m_Alpha2MX_ij[c];
+        if (x2 > 1.0E-100 && (m_Beta2MX_ij[c] != 0.0 || m_Beta2MX_ij_L[c] != 0.0
+                              || m_Beta2MX_ij_LL[c] != 0.0)) {
+            m_g2func_IJ[c] = 2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
+            m_h2func_IJ[c] = -2.0 *
+                (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
+        } else {
+            m_g2func_IJ[c] = 0.0;
+            m_h2func_IJ[c] = 0.0;
         }
     }
 
-    // SUBSECTION FOR CALCULATION OF F
-    // Agrees with Pitzer Eqn. (65)
-    double Aphi = A_Debye_TP() / 3.0;
-    double F = -Aphi * (sqrt(Is) / (1.0 + 1.2*sqrt(Is))
-                 + (2.0/1.2) * log(1.0+1.2*(sqrtIs)));
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            // Find the counterIJ for the symmetric binary interaction
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            // both species have a non-zero charge, and one is positive and the
-            // other is negative
-            if (charge(i)*charge(j) < 0) {
-                F += molality[i]*molality[j] * m_BprimeMX_IJ[counterIJ];
-            }
+    // The following call to calc_lambdas() calculates all 16 elements of the
+    // elambda and elambda1 arrays, given the value of the ionic strength (Is)
+    calc_lambdas(Is);
 
-            // Both species have a non-zero charge, and they
-            // have the same sign
-            if (charge(i)*charge(j) > 0) {
-                F += molality[i]*molality[j] * m_Phiprime_IJ[counterIJ];
-            }
-        }
+    // Find the coefficients E-theta and E-thetaprime for all pairs of ions
+    // with charges of the same sign
+    for (const auto& [i, j, c] : m_pairsLike) {
+        calc_thetas(static_cast<int>(charge(i)), static_cast<int>(charge(j)),
+                    &m_Etheta_IJ[c], &m_Etheta_prime_IJ[c]);
     }
 
-    for (size_t i = 1; i < m_kk; i++) {
-
-        // SUBSECTION FOR CALCULATING THE ACTCOEFF FOR CATIONS
-        // equations agree with my notes, Eqn. (118).
-        // Equations agree with Pitzer, eqn.(63)
-        if (charge(i) > 0.0) {
-            // species i is the cation (positive) to calc the actcoeff
-            double zsqF = charge(i)*charge(i)*F;
-            double sum1 = 0.0;
-            double sum2 = 0.0;
-            double sum3 = 0.0;
-            double sum4 = 0.0;
-            double sum5 = 0.0;
-            for (size_t j = 1; j < m_kk; j++) {
-                // Find the counterIJ for the symmetric binary interaction
-                size_t n = m_kk*i + j;
-                size_t counterIJ = m_CounterIJ[n];
-
-                if (charge(j) < 0.0) {
-                    // sum over all anions
-                    sum1 += molality[j] *
-                            (2.0*m_BMX_IJ[counterIJ] + molarcharge*m_CMX_IJ[counterIJ]);
-                    if (j < m_kk-1) {
-                        // This term is the ternary interaction involving the
-                        // non-duplicate sum over double anions, j, k, with
-                        // respect to the cation, i.
-                        for (size_t k = j+1; k < m_kk; k++) {
-                            // an inner sum over all anions
-                            if (charge(k) < 0.0) {
-                                n = k + j * m_kk + i * m_kk * m_kk;
-                                sum3 += molality[j]*molality[k]*m_Psi_ijk[n];
-                            }
-                        }
-                    }
-                }
-
-                if (charge(j) > 0.0) {
-                    // sum over all cations
-                    if (j != i) {
-                        sum2 += molality[j]*(2.0*m_Phi_IJ[counterIJ]);
-                    }
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            // two inner sums over anions
-                            n = k + j * m_kk + i * m_kk * m_kk;
-                            sum2 += molality[j]*molality[k]*m_Psi_ijk[n];
-
-                            // Find the counterIJ for the j,k interaction
-                            n = m_kk*j + k;
-                            size_t counterIJ2 = m_CounterIJ[n];
-                            sum4 += (fabs(charge(i))*
-                                           molality[j]*molality[k]*m_CMX_IJ[counterIJ2]);
-                        }
-                    }
-                }
-
-                // Handle neutral j species
-                if (charge(j) == 0) {
-                    sum5 += molality[j]*2.0*m_Lambda_nj(j,i);
-
-                    // Zeta interaction term
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            size_t izeta = j;
-                            size_t jzeta = i;
-                            n = izeta * m_kk * m_kk + jzeta * m_kk + k;
-                            double zeta = m_Psi_ijk[n];
-                            if (zeta != 0.0) {
-                                sum5 += molality[j]*molality[k]*zeta;
-                            }
-                        }
-                    }
-                }
-            }
-
-            // Add all of the contributions up to yield the log of the solute
-            // activity coefficients (molality scale)
-            m_lnActCoeffMolal_Unscaled[i] = zsqF + sum1 + sum2 + sum3 + sum4 + sum5;
-            gamma_Unscaled[i] = exp(m_lnActCoeffMolal_Unscaled[i]);
-        }
-
-        // SUBSECTION FOR CALCULATING THE ACTCOEFF FOR ANIONS
-        // equations agree with my notes, Eqn. (119).
-        // Equations agree with Pitzer, eqn.(64)
-        if (charge(i) < 0) {
-            // species i is an anion (negative)
-            double zsqF = charge(i)*charge(i)*F;
-            double sum1 = 0.0;
-            double sum2 = 0.0;
-            double sum3 = 0.0;
-            double sum4 = 0.0;
-            double sum5 = 0.0;
-            for (size_t j = 1; j < m_kk; j++) {
-                // Find the counterIJ for the symmetric binary interaction
-                size_t n = m_kk*i + j;
-                size_t counterIJ = m_CounterIJ[n];
-
-                // For Anions, do the cation interactions.
-                if (charge(j) > 0) {
-                    sum1 += molality[j]*
-                           (2.0*m_BMX_IJ[counterIJ]+molarcharge*m_CMX_IJ[counterIJ]);
-                    if (j < m_kk-1) {
-                        for (size_t k = j+1; k < m_kk; k++) {
-                            // an inner sum over all cations
-                            if (charge(k) > 0) {
-                                n = k + j * m_kk + i * m_kk * m_kk;
-                                sum3 += molality[j]*molality[k]*m_Psi_ijk[n];
-                            }
-                        }
-                    }
-                }
-
-                // For Anions, do the other anion interactions.
-                if (charge(j) < 0.0) {
-                    //  sum over all anions
-                    if (j != i) {
-                        sum2 += molality[j]*(2.0*m_Phi_IJ[counterIJ]);
-                    }
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) > 0.0) {
-                            // two inner sums over cations
-                            n = k + j * m_kk + i * m_kk * m_kk;
-                            sum2 += molality[j]*molality[k]*m_Psi_ijk[n];
-                            // Find the counterIJ for the symmetric binary interaction
-                            n = m_kk*j + k;
-                            size_t counterIJ2 = m_CounterIJ[n];
-                            sum4 += fabs(charge(i))*
-                                    molality[j]*molality[k]*m_CMX_IJ[counterIJ2];
-                        }
-                    }
-                }
-
-                // for Anions, do the neutral species interaction
-                if (charge(j) == 0.0) {
-                    sum5 += molality[j]*2.0*m_Lambda_nj(j,i);
-                    // Zeta interaction term
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) > 0.0) {
-                            size_t izeta = j;
-                            size_t jzeta = k;
-                            size_t kzeta = i;
-                            n = izeta * m_kk * m_kk + jzeta * m_kk + kzeta;
-                            double zeta = m_Psi_ijk[n];
-                            if (zeta != 0.0) {
-                                sum5 += molality[j]*molality[k]*zeta;
-                            }
-                        }
-                    }
-                }
-            }
-            m_lnActCoeffMolal_Unscaled[i] = zsqF + sum1 + sum2 + sum3 + sum4 + sum5;
-            gamma_Unscaled[i] = exp(m_lnActCoeffMolal_Unscaled[i]);
-        }
-
-        // SUBSECTION FOR CALCULATING NEUTRAL SOLUTE ACT COEFF
-        // equations agree with my notes,
-        // Equations agree with Pitzer,
-        if (charge(i) == 0.0) {
-            double sum1 = 0.0;
-            double sum3 = 0.0;
-            for (size_t j = 1; j < m_kk; j++) {
-                sum1 += molality[j]*2.0*m_Lambda_nj(i,j);
-                // Zeta term -> we piggyback on the psi term
-                if (charge(j) > 0.0) {
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            size_t n = k + j * m_kk + i * m_kk * m_kk;
-                            sum3 += molality[j]*molality[k]*m_Psi_ijk[n];
-                        }
-                    }
-                }
-            }
-            double sum2 = 3.0 * molality[i]* molality[i] * m_Mu_nnn[i];
-            m_lnActCoeffMolal_Unscaled[i] = sum1 + sum2 + sum3;
-            gamma_Unscaled[i] = exp(m_lnActCoeffMolal_Unscaled[i]);
-        }
-    }
+    PitzerTerms terms{m_Beta0MX_ij.data(), m_Beta1MX_ij.data(),
+        m_Beta2MX_ij.data(), m_CphiMX_ij.data(), m_Theta_ij.data(),
+        m_Psi_ijk.data(), &m_Lambda_nj, m_Mu_nnn.data(), A_Debye_TP() / 3.0,
+        true, m_lnActCoeffMolal_Unscaled.data(), 0.0};
+    calcPitzerTerms(&terms, 1);
 
     // SUBSECTION FOR CALCULATING THE OSMOTIC COEFF
     // equations agree with my notes, Eqn. (117).
     // Equations agree with Pitzer, eqn.(62)
-    double sum1 = 0.0;
-    double sum2 = 0.0;
-    double sum3 = 0.0;
-    double sum4 = 0.0;
-    double sum5 = 0.0;
-    double sum6 = 0.0;
-    double sum7 = 0.0;
-
-    // term1 is the DH term in the osmotic coefficient expression
-    // b = 1.2 sqrt(kg/gmol) <- arbitrarily set in all Pitzer
-    //                          implementations.
-    // Is = Ionic strength on the molality scale (units of (gmol/kg))
-    // Aphi = A_Debye / 3   (units of sqrt(kg/gmol))
-    double term1 = -Aphi * pow(Is,1.5) / (1.0 + 1.2 * sqrt(Is));
-
-    for (size_t j = 1; j < m_kk; j++) {
-        // Loop Over Cations
-        if (charge(j) > 0.0) {
-            for (size_t k = 1; k < m_kk; k++) {
-                if (charge(k) < 0.0) {
-                    // Find the counterIJ for the symmetric j,k binary interaction
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-
-                    sum1 += molality[j]*molality[k]*
-                            (m_BphiMX_IJ[counterIJ] + molarcharge*m_CMX_IJ[counterIJ]);
-                }
-            }
-
-            for (size_t k = j+1; k < m_kk; k++) {
-                if (j == (m_kk-1)) {
-                    // we should never reach this step
-                    throw CanteraError("HMWSoln::s_updatePitzer_lnMolalityActCoeff",
-                                       "logic error 1 in Step 9 of hmw_act");
-                }
-                if (charge(k) > 0.0) {
-                    // Find the counterIJ for the symmetric j,k binary interaction
-                    // between 2 cations.
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-                    sum2 += molality[j]*molality[k]*m_PhiPhi_IJ[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) < 0.0) {
-                            // species m is an anion
-                            n = m + k * m_kk + j * m_kk * m_kk;
-                            sum2 += molality[j]*molality[k]*molality[m]*m_Psi_ijk[n];
-                        }
-                    }
-                }
-            }
-        }
-
-        // Loop Over Anions
-        if (charge(j) < 0) {
-            for (size_t k = j+1; k < m_kk; k++) {
-                if (j == m_kk-1) {
-                    // we should never reach this step
-                    throw CanteraError("HMWSoln::s_updatePitzer_lnMolalityActCoeff",
-                                       "logic error 2 in Step 9 of hmw_act");
-                }
-                if (charge(k) < 0) {
-                    // Find the counterIJ for the symmetric j,k binary interaction
-                    // between two anions
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-                    sum3 += molality[j]*molality[k]*m_PhiPhi_IJ[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) > 0.0) {
-                            n = m + k * m_kk + j * m_kk * m_kk;
-                            sum3 += molality[j]*molality[k]*molality[m]*m_Psi_ijk[n];
-                        }
-                    }
-                }
-            }
-        }
-
-        // Loop Over Neutral Species
-        if (charge(j) == 0) {
-            for (size_t k = 1; k < m_kk; k++) {
-                if (charge(k) < 0.0) {
-                    sum4 += molality[j]*molality[k]*m_Lambda_nj(j,k);
-                }
-                if (charge(k) > 0.0) {
-                    sum5 += molality[j]*molality[k]*m_Lambda_nj(j,k);
-                }
-                if (charge(k) == 0.0) {
-                    if (k > j) {
-                        sum6 += molality[j]*molality[k]*m_Lambda_nj(j,k);
-                    } else if (k == j) {
-                        sum6 += 0.5 * molality[j]*molality[k]*m_Lambda_nj(j,k);
-                    }
-                }
-                if (charge(k) < 0.0) {
-                    size_t izeta = j;
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) > 0.0) {
-                            size_t jzeta = m;
-                            size_t n = k + jzeta * m_kk + izeta * m_kk * m_kk;
-                            double zeta = m_Psi_ijk[n];
-                            if (zeta != 0.0) {
-                                sum7 += molality[izeta]*molality[jzeta]*molality[k]*zeta;
-                            }
-                        }
-                    }
-                }
-            }
-            sum7 += molality[j]*molality[j]*molality[j]*m_Mu_nnn[j];
-        }
-    }
-    double sum_m_phi_minus_1 = 2.0 *
-                        (term1 + sum1 + sum2 + sum3 + sum4 + sum5 + sum6 + sum7);
+    double sum_m_phi_minus_1 = 2.0 * terms.osmoticSum;
     // Calculate the osmotic coefficient from
     //     osmotic_coeff = 1 + dGex/d(M0noRT) / sum(molality_i)
     double osmotic_coef;
@@ -2316,11 +1801,8 @@ void HMWSoln::s_update_dlnMolalityActCoeff_dT() const
         return;
     }
 
-    // Zero the unscaled 2nd derivatives
-    m_dlnActCoeffMolaldT_Unscaled.assign(m_kk, 0.0);
-
     // Do the actual calculation of the unscaled temperature derivatives
-    s_updatePitzer_dlnMolalityActCoeff_dT();
+    s_updatePitzer_dlnMolalityActCoeff();
 
     for (size_t k = 1; k < m_kk; k++) {
         if (CROP_speciesCropped_[k] == 2) {
@@ -2336,498 +1818,55 @@ void HMWSoln::s_update_dlnMolalityActCoeff_dT() const
     s_updateScaling_pHScaling_dT();
 }
 
-void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
+void HMWSoln::s_update_d2lnMolalityActCoeff_dT2() const
 {
-    // It may be assumed that the Pitzer activity coefficient routine is called
-    // immediately preceding the calling of this routine. Therefore, some
-    // quantities do not need to be recalculated in this routine.
-
-    const vector<double>& molality = m_molalitiesCropped;
-    double* d_gamma_dT_Unscaled = m_gamma_tmp.data();
-
-    // Local variables defined by Coltrin
-    double etheta[5][5], etheta_prime[5][5], sqrtIs;
-
-    // Molality based ionic strength of the solution
-    double Is = 0.0;
-
-    // Molar charge of the solution: In Pitzer's notation, this is his variable
-    // called "Z".
-    double molarcharge = 0.0;
-
-    // molalitysum is the sum of the molalities over all solutes, even those
-    // with zero charge.
-    double molalitysum = 0.0;
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if( cached.validate(temperature(), pressure(), stateMFNumber()) ) {
+        return;
+    }
 
-    // Make sure the counter variables are setup
-    counterIJ_setup();
+    //! Calculate the unscaled 2nd derivatives
+    s_updatePitzer_dlnMolalityActCoeff();
 
-    // ---------- Calculate common sums over solutes ---------------------
-    for (size_t n = 1; n < m_kk; n++) {
-        // ionic strength
-        Is += charge(n) * charge(n) * molality[n];
-        // total molar charge
-        molarcharge += fabs(charge(n)) * molality[n];
-        molalitysum += molality[n];
+    for (size_t k = 1; k < m_kk; k++) {
+        if (CROP_speciesCropped_[k] == 2) {
+            m_d2lnActCoeffMolaldT2_Unscaled[k] = 0.0;
+        }
     }
-    Is *= 0.5;
 
-    // Store the ionic molality in the object for reference.
-    m_IionicMolality = Is;
-    sqrtIs = sqrt(Is);
+    if (CROP_speciesCropped_[0]) {
+        m_d2lnActCoeffMolaldT2_Unscaled[0] = 0.0;
+    }
 
-    // The following call to calc_lambdas() calculates all 16 elements of the
-    // elambda and elambda1 arrays, given the value of the ionic strength (Is)
-    calc_lambdas(Is);
+    // Scale the 2nd derivatives
+    s_updateScaling_pHScaling_dT2();
+}
 
-    // Step 2: Find the coefficients E-theta and E-thetaprime for all
-    // combinations of positive unlike charges up to 4
-    for (int z1 = 1; z1 <=4; z1++) {
-        for (int z2 =1; z2 <=4; z2++) {
-            calc_thetas(z1, z2, &etheta[z1][z2], &etheta_prime[z1][z2]);
-        }
+void HMWSoln::s_update_dlnMolalityActCoeff_dP() const
+{
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if( cached.validate(temperature(), pressure(), stateMFNumber()) ) {
+        return;
     }
 
-    // calculate g(x) and hfunc(x) for each cation-anion pair MX
-    // In the original literature, hfunc, was called gprime. However,
-    // it's not the derivative of g(x), so I renamed it.
-    for (size_t i = 1; i < (m_kk - 1); i++) {
-        for (size_t j = (i+1); j < m_kk; j++) {
-            // Find the counterIJ for the symmetric binary interaction
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            // Only loop over oppositely charge species
-            if (charge(i)*charge(j) < 0) {
-                // x is a reduced function variable
-                double x1 = sqrtIs * m_Alpha1MX_ij[counterIJ];
-                if (x1 > 1.0E-100) {
-                    m_gfunc_IJ[counterIJ] = 2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 * x1);
-                    m_hfunc_IJ[counterIJ] = -2.0 *
-                                       (1.0-(1.0 + x1 + 0.5 * x1 *x1) * exp(-x1)) / (x1 * x1);
-                } else {
-                    m_gfunc_IJ[counterIJ] = 0.0;
-                    m_hfunc_IJ[counterIJ] = 0.0;
-                }
+    s_updatePitzer_dlnMolalityActCoeff();
 
-                if (m_Beta2MX_ij_L[counterIJ] != 0.0) {
-                    double x2 = sqrtIs * m_Alpha2MX_ij[counterIJ];
-                    if (x2 > 1.0E-100) {
-                        m_g2func_IJ[counterIJ] = 2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
-                        m_h2func_IJ[counterIJ] = -2.0 *
-                                            (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
-                    } else {
-                        m_g2func_IJ[counterIJ] = 0.0;
-                        m_h2func_IJ[counterIJ] = 0.0;
-                    }
-                }
-            } else {
-                m_gfunc_IJ[counterIJ] = 0.0;
-                m_hfunc_IJ[counterIJ] = 0.0;
-            }
+    for (size_t k = 1; k < m_kk; k++) {
+        if (CROP_speciesCropped_[k] == 2) {
+            m_dlnActCoeffMolaldP_Unscaled[k] = 0.0;
         }
     }
 
-    // SUBSECTION TO CALCULATE BMX_L, BprimeMX_L, BphiMX_L
-    // These are now temperature derivatives of the previously calculated
-    // quantities.
-    for (size_t i = 1; i < m_kk - 1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            // Find the counterIJ for the symmetric binary interaction
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            // both species have a non-zero charge, and one is positive
-            // and the other is negative
-            if (charge(i)*charge(j) < 0.0) {
-                m_BMX_IJ_L[counterIJ] = m_Beta0MX_ij_L[counterIJ]
-                                    + m_Beta1MX_ij_L[counterIJ] * m_gfunc_IJ[counterIJ]
-                                    + m_Beta2MX_ij_L[counterIJ] * m_gfunc_IJ[counterIJ];
-                if (Is > 1.0E-150) {
-                    m_BprimeMX_IJ_L[counterIJ] = (m_Beta1MX_ij_L[counterIJ] * m_hfunc_IJ[counterIJ]/Is +
-                                             m_Beta2MX_ij_L[counterIJ] * m_h2func_IJ[counterIJ]/Is);
-                } else {
-                    m_BprimeMX_IJ_L[counterIJ] = 0.0;
-                }
-                m_BphiMX_IJ_L[counterIJ] = m_BMX_IJ_L[counterIJ] + Is*m_BprimeMX_IJ_L[counterIJ];
-            } else {
-                m_BMX_IJ_L[counterIJ] = 0.0;
-                m_BprimeMX_IJ_L[counterIJ] = 0.0;
-                m_BphiMX_IJ_L[counterIJ] = 0.0;
-            }
-        }
+    if (CROP_speciesCropped_[0]) {
+        m_dlnActCoeffMolaldP_Unscaled[0] = 0.0;
     }
 
-    // --------- SUBSECTION TO CALCULATE CMX_L ----------
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            // Find the counterIJ for the symmetric binary interaction
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            // both species have a non-zero charge, and one is positive
-            // and the other is negative
-            if (charge(i)*charge(j) < 0.0) {
-                m_CMX_IJ_L[counterIJ] = m_CphiMX_ij_L[counterIJ]/
-                                   (2.0* sqrt(fabs(charge(i)*charge(j))));
-            } else {
-                m_CMX_IJ_L[counterIJ] = 0.0;
-            }
-        }
-    }
-
-    // ------- SUBSECTION TO CALCULATE Phi, PhiPrime, and PhiPhi ----------
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            // Find the counterIJ for the symmetric binary interaction
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            // both species have a non-zero charge, and one is positive
-            // and the other is negative
-            if (charge(i)*charge(j) > 0) {
-                m_Phi_IJ_L[counterIJ] = m_Theta_ij_L[counterIJ];
-                m_Phiprime_IJ[counterIJ] = 0.0;
-                m_PhiPhi_IJ_L[counterIJ] = m_Phi_IJ_L[counterIJ] + Is * m_Phiprime_IJ[counterIJ];
-            } else {
-                m_Phi_IJ_L[counterIJ] = 0.0;
-                m_Phiprime_IJ[counterIJ] = 0.0;
-                m_PhiPhi_IJ_L[counterIJ] = 0.0;
-            }
-        }
-    }
-
-    // ----------- SUBSECTION FOR CALCULATION OF dFdT ---------------------
-    double dA_DebyedT = dA_DebyedT_TP();
-    double dAphidT = dA_DebyedT /3.0;
-    double dFdT = -dAphidT * (sqrt(Is) / (1.0 + 1.2*sqrt(Is))
-                       + (2.0/1.2) * log(1.0+1.2*(sqrtIs)));
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            // Find the counterIJ for the symmetric binary interaction
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            // both species have a non-zero charge, and one is positive
-            // and the other is negative
-            if (charge(i)*charge(j) < 0) {
-                dFdT += molality[i]*molality[j] * m_BprimeMX_IJ_L[counterIJ];
-            }
-
-            // Both species have a non-zero charge, and they
-            // have the same sign, that is, both positive or both negative.
-            if (charge(i)*charge(j) > 0) {
-                dFdT += molality[i]*molality[j] * m_Phiprime_IJ[counterIJ];
-            }
-        }
-    }
-
-    for (size_t i = 1; i < m_kk; i++) {
-        // -------- SUBSECTION FOR CALCULATING THE dACTCOEFFdT FOR CATIONS -----
-        if (charge(i) > 0) {
-            // species i is the cation (positive) to calc the actcoeff
-            double zsqdFdT = charge(i)*charge(i)*dFdT;
-            double sum1 = 0.0;
-            double sum2 = 0.0;
-            double sum3 = 0.0;
-            double sum4 = 0.0;
-            double sum5 = 0.0;
-            for (size_t j = 1; j < m_kk; j++) {
-                // Find the counterIJ for the symmetric binary interaction
-                size_t n = m_kk*i + j;
-                size_t counterIJ = m_CounterIJ[n];
-
-                if (charge(j) < 0.0) {
-                    // sum over all anions
-                    sum1 += molality[j]*
-                            (2.0*m_BMX_IJ_L[counterIJ] + molarcharge*m_CMX_IJ_L[counterIJ]);
-                    if (j < m_kk-1) {
-                        // This term is the ternary interaction involving the
-                        // non-duplicate sum over double anions, j, k, with
-                        // respect to the cation, i.
-                        for (size_t k = j+1; k < m_kk; k++) {
-                            // an inner sum over all anions
-                            if (charge(k) < 0.0) {
-                                n = k + j * m_kk + i * m_kk * m_kk;
-                                sum3 += molality[j]*molality[k]*m_Psi_ijk_L[n];
-                            }
-                        }
-                    }
-                }
-
-                if (charge(j) > 0.0) {
-                    // sum over all cations
-                    if (j != i) {
-                        sum2 += molality[j]*(2.0*m_Phi_IJ_L[counterIJ]);
-                    }
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            // two inner sums over anions
-                            n = k + j * m_kk + i * m_kk * m_kk;
-                            sum2 += molality[j]*molality[k]*m_Psi_ijk_L[n];
-
-                            // Find the counterIJ for the j,k interaction
-                            n = m_kk*j + k;
-                            size_t counterIJ2 = m_CounterIJ[n];
-                            sum4 += fabs(charge(i))*
-                                    molality[j]*molality[k]*m_CMX_IJ_L[counterIJ2];
-                        }
-                    }
-                }
-
-                // Handle neutral j species
-                if (charge(j) == 0) {
-                    sum5 += molality[j]*2.0*m_Lambda_nj_L(j,i);
-                }
-
-                // Zeta interaction term
-                for (size_t k = 1; k < m_kk; k++) {
-                    if (charge(k) < 0.0) {
-                        size_t izeta = j;
-                        size_t jzeta = i;
-                        n = izeta * m_kk * m_kk + jzeta * m_kk + k;
-                        double zeta_L = m_Psi_ijk_L[n];
-                        if (zeta_L != 0.0) {
-                            sum5 += molality[j]*molality[k]*zeta_L;
-                        }
-                    }
-                }
-            }
-
-            // Add all of the contributions up to yield the log of the
-            // solute activity coefficients (molality scale)
-            m_dlnActCoeffMolaldT_Unscaled[i] =
-                zsqdFdT + sum1 + sum2 + sum3 + sum4 + sum5;
-            d_gamma_dT_Unscaled[i] = exp(m_dlnActCoeffMolaldT_Unscaled[i]);
-        }
-
-        // ------ SUBSECTION FOR CALCULATING THE dACTCOEFFdT FOR ANIONS ------
-        if (charge(i) < 0) {
-            // species i is an anion (negative)
-            double zsqdFdT = charge(i)*charge(i)*dFdT;
-            double sum1 = 0.0;
-            double sum2 = 0.0;
-            double sum3 = 0.0;
-            double sum4 = 0.0;
-            double sum5 = 0.0;
-            for (size_t j = 1; j < m_kk; j++) {
-                // Find the counterIJ for the symmetric binary interaction
-                size_t n = m_kk*i + j;
-                size_t counterIJ = m_CounterIJ[n];
-
-                // For Anions, do the cation interactions.
-                if (charge(j) > 0) {
-                    sum1 += molality[j]*
-                            (2.0*m_BMX_IJ_L[counterIJ] + molarcharge*m_CMX_IJ_L[counterIJ]);
-                    if (j < m_kk-1) {
-                        for (size_t k = j+1; k < m_kk; k++) {
-                            // an inner sum over all cations
-                            if (charge(k) > 0) {
-                                n = k + j * m_kk + i * m_kk * m_kk;
-                                sum3 += molality[j]*molality[k]*m_Psi_ijk_L[n];
-                            }
-                        }
-                    }
-                }
-
-                // For Anions, do the other anion interactions.
-                if (charge(j) < 0.0) {
-                    //  sum over all anions
-                    if (j != i) {
-                        sum2 += molality[j]*(2.0*m_Phi_IJ_L[counterIJ]);
-                    }
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) > 0.0) {
-                            // two inner sums over cations
-                            n = k + j * m_kk + i * m_kk * m_kk;
-                            sum2 += molality[j]*molality[k]*m_Psi_ijk_L[n];
-                            // Find the counterIJ for the symmetric binary interaction
-                            n = m_kk*j + k;
-                            size_t counterIJ2 = m_CounterIJ[n];
-                            sum4 += fabs(charge(i)) *
-                                    molality[j]*molality[k]*m_CMX_IJ_L[counterIJ2];
-                        }
-                    }
-                }
-
-                // for Anions, do the neutral species interaction
-                if (charge(j) == 0.0) {
-                    sum5 += molality[j]*2.0*m_Lambda_nj_L(j,i);
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) > 0.0) {
-                            size_t izeta = j;
-                            size_t jzeta = k;
-                            size_t kzeta = i;
-                            n = izeta * m_kk * m_kk + jzeta * m_kk + kzeta;
-                            double zeta_L = m_Psi_ijk_L[n];
-                            if (zeta_L != 0.0) {
-                                sum5 += molality[j]*molality[k]*zeta_L;
-                            }
-                        }
-                    }
-                }
-            }
-            m_dlnActCoeffMolaldT_Unscaled[i] =
-                zsqdFdT + sum1 + sum2 + sum3 + sum4 + sum5;
-            d_gamma_dT_Unscaled[i] = exp(m_dlnActCoeffMolaldT_Unscaled[i]);
-        }
-
-        // SUBSECTION FOR CALCULATING NEUTRAL SOLUTE ACT COEFF
-        // equations agree with my notes,
-        // Equations agree with Pitzer,
-        if (charge(i) == 0.0) {
-            double sum1 = 0.0;
-            double sum3 = 0.0;
-            for (size_t j = 1; j < m_kk; j++) {
-                sum1 += molality[j]*2.0*m_Lambda_nj_L(i,j);
-                // Zeta term -> we piggyback on the psi term
-                if (charge(j) > 0.0) {
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            size_t n = k + j * m_kk + i * m_kk * m_kk;
-                            sum3 += molality[j]*molality[k]*m_Psi_ijk_L[n];
-                        }
-                    }
-                }
-            }
-            double sum2 = 3.0 * molality[i] * molality[i] * m_Mu_nnn_L[i];
-            m_dlnActCoeffMolaldT_Unscaled[i] = sum1 + sum2 + sum3;
-            d_gamma_dT_Unscaled[i] = exp(m_dlnActCoeffMolaldT_Unscaled[i]);
-        }
-    }
-
-    // ------ SUBSECTION FOR CALCULATING THE d OSMOTIC COEFF dT ---------
-    double sum1 = 0.0;
-    double sum2 = 0.0;
-    double sum3 = 0.0;
-    double sum4 = 0.0;
-    double sum5 = 0.0;
-    double sum6 = 0.0;
-    double sum7 = 0.0;
-
-    // term1 is the temperature derivative of the DH term in the osmotic
-    // coefficient expression
-    // b = 1.2 sqrt(kg/gmol) <- arbitrarily set in all Pitzer implementations.
-    // Is = Ionic strength on the molality scale (units of (gmol/kg))
-    // Aphi = A_Debye / 3   (units of sqrt(kg/gmol))
-    double term1 = -dAphidT * Is * sqrt(Is) / (1.0 + 1.2 * sqrt(Is));
-
-    for (size_t j = 1; j < m_kk; j++) {
-        // Loop Over Cations
-        if (charge(j) > 0.0) {
-            for (size_t k = 1; k < m_kk; k++) {
-                if (charge(k) < 0.0) {
-                    // Find the counterIJ for the symmetric j,k binary interaction
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-                    sum1 += molality[j]*molality[k]*
-                            (m_BphiMX_IJ_L[counterIJ] + molarcharge*m_CMX_IJ_L[counterIJ]);
-                }
-            }
-
-            for (size_t k = j+1; k < m_kk; k++) {
-                if (j == (m_kk-1)) {
-                    // we should never reach this step
-                    throw CanteraError("HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT",
-                                       "logic error 1 in Step 9 of hmw_act");
-                }
-                if (charge(k) > 0.0) {
-                    // Find the counterIJ for the symmetric j,k binary interaction
-                    // between 2 cations.
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-                    sum2 += molality[j]*molality[k]*m_PhiPhi_IJ_L[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) < 0.0) {
-                            // species m is an anion
-                            n = m + k * m_kk + j * m_kk * m_kk;
-                            sum2 += molality[j]*molality[k]*molality[m]*m_Psi_ijk_L[n];
-                        }
-                    }
-                }
-            }
-        }
-
-        // Loop Over Anions
-        if (charge(j) < 0) {
-            for (size_t k = j+1; k < m_kk; k++) {
-                if (j == m_kk-1) {
-                    // we should never reach this step
-                    throw CanteraError("HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT",
-                                       "logic error 2 in Step 9 of hmw_act");
-                }
-                if (charge(k) < 0) {
-                    // Find the counterIJ for the symmetric j,k binary interaction
-                    // between two anions
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-                    sum3 += molality[j]*molality[k]*m_PhiPhi_IJ_L[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) > 0.0) {
-                            n = m + k * m_kk + j * m_kk * m_kk;
-                            sum3 += molality[j]*molality[k]*molality[m]*m_Psi_ijk_L[n];
-                        }
-                    }
-                }
-            }
-        }
-
-        // Loop Over Neutral Species
-        if (charge(j) == 0) {
-            for (size_t k = 1; k < m_kk; k++) {
-                if (charge(k) < 0.0) {
-                    sum4 += molality[j]*molality[k]*m_Lambda_nj_L(j,k);
-                }
-                if (charge(k) > 0.0) {
-                    sum5 += molality[j]*molality[k]*m_Lambda_nj_L(j,k);
-                }
-                if (charge(k) == 0.0) {
-                    if (k > j) {
-                        sum6 += molality[j]*molality[k]*m_Lambda_nj_L(j,k);
-                    } else if (k == j) {
-                        sum6 += 0.5 * molality[j]*molality[k]*m_Lambda_nj_L(j,k);
-                    }
-                }
-                if (charge(k) < 0.0) {
-                    size_t izeta = j;
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) > 0.0) {
-                            size_t jzeta = m;
-                            size_t n = k + jzeta * m_kk + izeta * m_kk * m_kk;
-                            double zeta_L = m_Psi_ijk_L[n];
-                            if (zeta_L != 0.0) {
-                                sum7 += molality[izeta]*molality[jzeta]*molality[k]*zeta_L;
-                            }
-                        }
-                    }
-                }
-            }
-            sum7 += molality[j]*molality[j]*molality[j]*m_Mu_nnn_L[j];
-        }
-    }
-    double sum_m_phi_minus_1 = 2.0 *
-                        (term1 + sum1 + sum2 + sum3 + sum4 + sum5 + sum6 + sum7);
-    // Calculate the osmotic coefficient from
-    //     osmotic_coeff = 1 + dGex/d(M0noRT) / sum(molality_i)
-    double d_osmotic_coef_dT;
-    if (molalitysum > 1.0E-150) {
-        d_osmotic_coef_dT = 0.0 + (sum_m_phi_minus_1 / molalitysum);
-    } else {
-        d_osmotic_coef_dT = 0.0;
-    }
-
-    double d_lnwateract_dT = -(m_weightSolvent/1000.0) * molalitysum * d_osmotic_coef_dT;
-
-    // In Cantera, we define the activity coefficient of the solvent as
-    //
-    //     act_0 = actcoeff_0 * Xmol_0
-    //
-    // We have just computed act_0. However, this routine returns
-    //     ln(actcoeff[]). Therefore, we must calculate ln(actcoeff_0).
-    m_dlnActCoeffMolaldT_Unscaled[0] = d_lnwateract_dT;
+    s_updateScaling_pHScaling_dP();
 }
 
-void HMWSoln::s_update_d2lnMolalityActCoeff_dT2() const
+void HMWSoln::s_updatePitzer_dlnMolalityActCoeff() const
 {
     static const int cacheId = m_cache.getId();
     CachedScalar cached = m_cache.getScalar(cacheId);
@@ -2835,1016 +1874,159 @@ void HMWSoln::s_update_d2lnMolalityActCoeff_dT2() const
         return;
     }
 
-    // Zero the unscaled 2nd derivatives
-    m_d2lnActCoeffMolaldT2_Unscaled.assign(m_kk, 0.0);
-
-    //! Calculate the unscaled 2nd derivatives
-    s_updatePitzer_d2lnMolalityActCoeff_dT2();
-
-    for (size_t k = 1; k < m_kk; k++) {
-        if (CROP_speciesCropped_[k] == 2) {
-            m_d2lnActCoeffMolaldT2_Unscaled[k] = 0.0;
-        }
-    }
-
-    if (CROP_speciesCropped_[0]) {
-        m_d2lnActCoeffMolaldT2_Unscaled[0] = 0.0;
-    }
-
-    // Scale the 2nd derivatives
-    s_updateScaling_pHScaling_dT2();
-}
+    // The cropped molalities and the functions of the ionic strength are
+    // computed along with the activity coefficients
+    s_update_lnMolalityActCoeff();
 
-void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
-{
+    // Since the functions of the ionic strength do not depend on temperature or
+    // pressure, the derivatives only involve the derivatives of the Pitzer
+    // parameters and of the Debye-Huckel coefficient.
+    PitzerTerms terms[3] = {
+        {m_Beta0MX_ij_L.data(), m_Beta1MX_ij_L.data(), m_Beta2MX_ij_L.data(),
+         m_CphiMX_ij_L.data(), m_Theta_ij_L.data(), m_Psi_ijk_L.data(),
+         &m_Lambda_nj_L, m_Mu_nnn_L.data(), dA_DebyedT_TP() / 3.0, false,
+         m_dlnActCoeffMolaldT_Unscaled.data(), 0.0},
+        {m_Beta0MX_ij_LL.data(), m_Beta1MX_ij_LL.data(), m_Beta2MX_ij_LL.data(),
+         m_CphiMX_ij_LL.data(), m_Theta_ij_LL.data(), m_Psi_ijk_LL.data(),
+         &m_Lambda_nj_LL, m_Mu_nnn_LL.data(), d2A_DebyedT2_TP() / 3.0, false,
+         m_d2lnActCoeffMolaldT2_Unscaled.data(), 0.0},
+        {m_Beta0MX_ij_P.data(), m_Beta1MX_ij_P.data(), m_Beta2MX_ij_P.data(),
+         m_CphiMX_ij_P.data(), m_Theta_ij_P.data(), m_Psi_ijk_P.data(),
+         &m_Lambda_nj_P, m_Mu_nnn_P.data(), dA_DebyedP_TP() / 3.0, false,
+         m_dlnActCoeffMolaldP_Unscaled.data(), 0.0}
+    };
+    calcPitzerTerms(terms, 3);
+
+    // Derivatives of the log of the water activity coefficient. The sum of the
+    // molalities does not depend on temperature or pressure.
+    double factor = -2.0 * m_weightSolvent / 1000.0;
+    m_dlnActCoeffMolaldT_Unscaled[0] = factor * terms[0].osmoticSum;
+    m_d2lnActCoeffMolaldT2_Unscaled[0] = factor * terms[1].osmoticSum;
+    m_dlnActCoeffMolaldP_Unscaled[0] = factor * terms[2].osmoticSum;
+}
+
+void HMWSoln::calcPitzerTerms(PitzerTerms* terms, size_t nTerms) const
+{
+    AssertThrowMsg(nTerms <= 3, "HMWSoln::calcPitzerTerms",
+                   "At most 3 terms may be evaluated in a single pass");
     const double* molality = m_molalitiesCropped.data();
-
-    // Local variables defined by Coltrin
-    double etheta[5][5], etheta_prime[5][5], sqrtIs;
-
-    // Molality based ionic strength of the solution
-    double Is = 0.0;
+    double Is = m_IionicMolality;
+    double sqrtIs = sqrt(Is);
 
     // Molar charge of the solution: In Pitzer's notation, this is his variable
     // called "Z".
     double molarcharge = 0.0;
-
-    // molalitysum is the sum of the molalities over all solutes, even those
-    // with zero charge.
-    double molalitysum = 0.0;
-
-    // Make sure the counter variables are setup
-    counterIJ_setup();
-
-    // ---------- Calculate common sums over solutes ---------------------
-    for (size_t n = 1; n < m_kk; n++) {
-        // ionic strength
-        Is += charge(n) * charge(n) * molality[n];
-        // total molar charge
-        molarcharge += fabs(charge(n)) * molality[n];
-        molalitysum += molality[n];
-    }
-    Is *= 0.5;
-
-    // Store the ionic molality in the object for reference.
-    m_IionicMolality = Is;
-    sqrtIs = sqrt(Is);
-
-    // The following call to calc_lambdas() calculates all 16 elements of the
-    // elambda and elambda1 arrays, given the value of the ionic strength (Is)
-    calc_lambdas(Is);
-
-    // Step 2: Find the coefficients E-theta and E-thetaprime for all
-    // combinations of positive unlike charges up to 4
-    for (int z1 = 1; z1 <=4; z1++) {
-        for (int z2 =1; z2 <=4; z2++) {
-            calc_thetas(z1, z2, &etheta[z1][z2], &etheta_prime[z1][z2]);
-        }
-    }
-
-    // calculate gfunc(x) and hfunc(x) for each cation-anion pair MX. In the
-    // original literature, hfunc, was called gprime. However, it's not the
-    // derivative of gfunc(x), so I renamed it.
-    for (size_t i = 1; i < (m_kk - 1); i++) {
-        for (size_t j = (i+1); j < m_kk; j++) {
-            // Find the counterIJ for the symmetric binary interaction
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            // Only loop over oppositely charge species
-            if (charge(i)*charge(j) < 0) {
-                // x is a reduced function variable
-                double x1 = sqrtIs * m_Alpha1MX_ij[counterIJ];
-                if (x1 > 1.0E-100) {
-                    m_gfunc_IJ[counterIJ] = 2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 *x1);
-                    m_hfunc_IJ[counterIJ] = -2.0*
-                                       (1.0-(1.0 + x1 + 0.5*x1 * x1) * exp(-x1)) / (x1 * x1);
-                } else {
-                    m_gfunc_IJ[counterIJ] = 0.0;
-                    m_hfunc_IJ[counterIJ] = 0.0;
-                }
-
-                if (m_Beta2MX_ij_LL[counterIJ] != 0.0) {
-                    double x2 = sqrtIs * m_Alpha2MX_ij[counterIJ];
-                    if (x2 > 1.0E-100) {
-                        m_g2func_IJ[counterIJ] = 2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
-                        m_h2func_IJ[counterIJ] = -2.0 *
-                                            (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
-                    } else {
-                        m_g2func_IJ[counterIJ] = 0.0;
-                        m_h2func_IJ[counterIJ] = 0.0;
-                    }
-                }
-            } else {
-                m_gfunc_IJ[counterIJ] = 0.0;
-                m_hfunc_IJ[counterIJ] = 0.0;
-            }
-        }
-    }
-
-    // SUBSECTION TO CALCULATE BMX_L, BprimeMX_LL, BphiMX_L
-    // These are now temperature derivatives of the previously calculated
-    // quantities.
-    for (size_t i = 1; i < m_kk - 1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            // Find the counterIJ for the symmetric binary interaction
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            // both species have a non-zero charge, and one is positive
-            // and the other is negative
-            if (charge(i)*charge(j) < 0.0) {
-                m_BMX_IJ_LL[counterIJ] = m_Beta0MX_ij_LL[counterIJ]
-                                     + m_Beta1MX_ij_LL[counterIJ] * m_gfunc_IJ[counterIJ]
-                                     + m_Beta2MX_ij_LL[counterIJ] * m_g2func_IJ[counterIJ];
-                if (Is > 1.0E-150) {
-                    m_BprimeMX_IJ_LL[counterIJ] = (m_Beta1MX_ij_LL[counterIJ] * m_hfunc_IJ[counterIJ]/Is +
-                                              m_Beta2MX_ij_LL[counterIJ] * m_h2func_IJ[counterIJ]/Is);
-                } else {
-                    m_BprimeMX_IJ_LL[counterIJ] = 0.0;
-                }
-                m_BphiMX_IJ_LL[counterIJ] = m_BMX_IJ_LL[counterIJ] + Is*m_BprimeMX_IJ_LL[counterIJ];
-            } else {
-                m_BMX_IJ_LL[counterIJ] = 0.0;
-                m_BprimeMX_IJ_LL[counterIJ] = 0.0;
-                m_BphiMX_IJ_LL[counterIJ] = 0.0;
-            }
-        }
-    }
-
-    // --------- SUBSECTION TO CALCULATE CMX_LL ----------
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            // Find the counterIJ for the symmetric binary interaction
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            // both species have a non-zero charge, and one is positive
-            // and the other is negative
-            if (charge(i)*charge(j) < 0.0) {
-                m_CMX_IJ_LL[counterIJ] = m_CphiMX_ij_LL[counterIJ]/
-                                    (2.0* sqrt(fabs(charge(i)*charge(j))));
-            } else {
-                m_CMX_IJ_LL[counterIJ] = 0.0;
-            }
-        }
-    }
-
-    // ------- SUBSECTION TO CALCULATE Phi, PhiPrime, and PhiPhi ----------
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            // Find the counterIJ for the symmetric binary interaction
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            // both species have a non-zero charge, and one is positive
-            // and the other is negative
-            if (charge(i)*charge(j) > 0) {
-                m_Phi_IJ_LL[counterIJ] = m_Theta_ij_LL[counterIJ];
-                m_Phiprime_IJ[counterIJ] = 0.0;
-                m_PhiPhi_IJ_LL[counterIJ] = m_Phi_IJ_LL[counterIJ];
-            } else {
-                m_Phi_IJ_LL[counterIJ] = 0.0;
-                m_Phiprime_IJ[counterIJ] = 0.0;
-                m_PhiPhi_IJ_LL[counterIJ] = 0.0;
-            }
-        }
-    }
-
-    // ----------- SUBSECTION FOR CALCULATION OF d2FdT2 ---------------------
-    double d2AphidT2 = d2A_DebyedT2_TP() / 3.0;
-    double d2FdT2 = -d2AphidT2 * (sqrt(Is) / (1.0 + 1.2*sqrt(Is))
-                           + (2.0/1.2) * log(1.0+1.2*(sqrtIs)));
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            // Find the counterIJ for the symmetric binary interaction
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            // both species have a non-zero charge, and one is positive
-            // and the other is negative
-            if (charge(i)*charge(j) < 0) {
-                d2FdT2 += molality[i]*molality[j] * m_BprimeMX_IJ_LL[counterIJ];
-            }
-
-            // Both species have a non-zero charge, and they
-            // have the same sign, that is, both positive or both negative.
-            if (charge(i)*charge(j) > 0) {
-                d2FdT2 += molality[i]*molality[j] * m_Phiprime_IJ[counterIJ];
-            }
-        }
-    }
-
-    for (size_t i = 1; i < m_kk; i++) {
-        // -------- SUBSECTION FOR CALCULATING THE dACTCOEFFdT FOR CATIONS -----
-        if (charge(i) > 0) {
-            // species i is the cation (positive) to calc the actcoeff
-            double zsqd2FdT2 = charge(i)*charge(i)*d2FdT2;
-            double sum1 = 0.0;
-            double sum2 = 0.0;
-            double sum3 = 0.0;
-            double sum4 = 0.0;
-            double sum5 = 0.0;
-            for (size_t j = 1; j < m_kk; j++) {
-                // Find the counterIJ for the symmetric binary interaction
-                size_t n = m_kk*i + j;
-                size_t counterIJ = m_CounterIJ[n];
-
-                if (charge(j) < 0.0) {
-                    // sum over all anions
-                    sum1 += molality[j]*
-                            (2.0*m_BMX_IJ_LL[counterIJ] + molarcharge*m_CMX_IJ_LL[counterIJ]);
-                    if (j < m_kk-1) {
-                        // This term is the ternary interaction involving the
-                        // non-duplicate sum over double anions, j, k, with
-                        // respect to the cation, i.
-                        for (size_t k = j+1; k < m_kk; k++) {
-                            // an inner sum over all anions
-                            if (charge(k) < 0.0) {
-                                n = k + j * m_kk + i * m_kk * m_kk;
-                                sum3 += molality[j]*molality[k]*m_Psi_ijk_LL[n];
-                            }
-                        }
-                    }
-                }
-
-                if (charge(j) > 0.0) {
-                    // sum over all cations
-                    if (j != i) {
-                        sum2 += molality[j]*(2.0*m_Phi_IJ_LL[counterIJ]);
-                    }
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            // two inner sums over anions
-                            n = k + j * m_kk + i * m_kk * m_kk;
-                            sum2 += molality[j]*molality[k]*m_Psi_ijk_LL[n];
-
-                            // Find the counterIJ for the j,k interaction
-                            n = m_kk*j + k;
-                            size_t counterIJ2 = m_CounterIJ[n];
-                            sum4 += fabs(charge(i)) *
-                                    molality[j]*molality[k]*m_CMX_IJ_LL[counterIJ2];
-                        }
-                    }
-                }
-
-                // Handle neutral j species
-                if (charge(j) == 0) {
-                    sum5 += molality[j]*2.0*m_Lambda_nj_LL(j,i);
-                    // Zeta interaction term
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            size_t izeta = j;
-                            size_t jzeta = i;
-                            n = izeta * m_kk * m_kk + jzeta * m_kk + k;
-                            double zeta_LL = m_Psi_ijk_LL[n];
-                            if (zeta_LL != 0.0) {
-                                sum5 += molality[j]*molality[k]*zeta_LL;
-                            }
-                        }
-                    }
-                }
-            }
-            // Add all of the contributions up to yield the log of the
-            // solute activity coefficients (molality scale)
-            m_d2lnActCoeffMolaldT2_Unscaled[i] =
-                zsqd2FdT2 + sum1 + sum2 + sum3 + sum4 + sum5;
-        }
-
-        // ------ SUBSECTION FOR CALCULATING THE d2ACTCOEFFdT2 FOR ANIONS ------
-        if (charge(i) < 0) {
-            // species i is an anion (negative)
-            double zsqd2FdT2 = charge(i)*charge(i)*d2FdT2;
-            double sum1 = 0.0;
-            double sum2 = 0.0;
-            double sum3 = 0.0;
-            double sum4 = 0.0;
-            double sum5 = 0.0;
-            for (size_t j = 1; j < m_kk; j++) {
-                // Find the counterIJ for the symmetric binary interaction
-                size_t n = m_kk*i + j;
-                size_t counterIJ = m_CounterIJ[n];
-
-                // For Anions, do the cation interactions.
-                if (charge(j) > 0) {
-                    sum1 += molality[j]*
-                            (2.0*m_BMX_IJ_LL[counterIJ] + molarcharge*m_CMX_IJ_LL[counterIJ]);
-                    if (j < m_kk-1) {
-                        for (size_t k = j+1; k < m_kk; k++) {
-                            // an inner sum over all cations
-                            if (charge(k) > 0) {
-                                n = k + j * m_kk + i * m_kk * m_kk;
-                                sum3 += molality[j]*molality[k]*m_Psi_ijk_LL[n];
-                            }
-                        }
-                    }
-                }
-
-                // For Anions, do the other anion interactions.
-                if (charge(j) < 0.0) {
-                    //  sum over all anions
-                    if (j != i) {
-                        sum2 += molality[j]*(2.0*m_Phi_IJ_LL[counterIJ]);
-                    }
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) > 0.0) {
-                            // two inner sums over cations
-                            n = k + j * m_kk + i * m_kk * m_kk;
-                            sum2 += molality[j]*molality[k]*m_Psi_ijk_LL[n];
-                            // Find the counterIJ for the symmetric binary interaction
-                            n = m_kk*j + k;
-                            size_t counterIJ2 = m_CounterIJ[n];
-                            sum4 += fabs(charge(i)) *
-                                    molality[j]*molality[k]*m_CMX_IJ_LL[counterIJ2];
-                        }
-                    }
-                }
-
-                // for Anions, do the neutral species interaction
-                if (charge(j) == 0.0) {
-                    sum5 += molality[j]*2.0*m_Lambda_nj_LL(j,i);
-                    // Zeta interaction term
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) > 0.0) {
-                            size_t izeta = j;
-                            size_t jzeta = k;
-                            size_t kzeta = i;
-                            n = izeta * m_kk * m_kk + jzeta * m_kk + kzeta;
-                            double zeta_LL = m_Psi_ijk_LL[n];
-                            if (zeta_LL != 0.0) {
-                                sum5 += molality[j]*molality[k]*zeta_LL;
-                            }
-                        }
-                    }
-                }
-            }
-            m_d2lnActCoeffMolaldT2_Unscaled[i] =
-                zsqd2FdT2 + sum1 + sum2 + sum3 + sum4 + sum5;
-        }
-
-        // SUBSECTION FOR CALCULATING NEUTRAL SOLUTE ACT COEFF
-        // equations agree with my notes,
-        // Equations agree with Pitzer,
-        if (charge(i) == 0.0) {
-            double sum1 = 0.0;
-            double sum3 = 0.0;
-            for (size_t j = 1; j < m_kk; j++) {
-                sum1 += molality[j]*2.0*m_Lambda_nj_LL(i,j);
-                // Zeta term -> we piggyback on the psi term
-                if (charge(j) > 0.0) {
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            size_t n = k + j * m_kk + i * m_kk * m_kk;
-                            sum3 += molality[j]*molality[k]*m_Psi_ijk_LL[n];
-                        }
-                    }
-                }
-            }
-            double sum2 = 3.0 * molality[i] * molality[i] * m_Mu_nnn_LL[i];
-            m_d2lnActCoeffMolaldT2_Unscaled[i] = sum1 + sum2 + sum3;
-        }
-    }
-
-    // ------ SUBSECTION FOR CALCULATING THE d2 OSMOTIC COEFF dT2 ---------
-    double sum1 = 0.0;
-    double sum2 = 0.0;
-    double sum3 = 0.0;
-    double sum4 = 0.0;
-    double sum5 = 0.0;
-    double sum6 = 0.0;
-    double sum7 = 0.0;
-
-    // term1 is the temperature derivative of the  DH term in the osmotic
-    // coefficient expression
-    // b = 1.2 sqrt(kg/gmol) <- arbitrarily set in all Pitzer implementations.
-    // Is = Ionic strength on the molality scale (units of (gmol/kg))
-    // Aphi = A_Debye / 3   (units of sqrt(kg/gmol))
-    double term1 = -d2AphidT2 * Is * sqrt(Is) / (1.0 + 1.2 * sqrt(Is));
-
-    for (size_t j = 1; j < m_kk; j++) {
-        // Loop Over Cations
-        if (charge(j) > 0.0) {
-            for (size_t k = 1; k < m_kk; k++) {
-                if (charge(k) < 0.0) {
-                    // Find the counterIJ for the symmetric j,k binary interaction
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-
-                    sum1 += molality[j]*molality[k] *
-                            (m_BphiMX_IJ_LL[counterIJ] + molarcharge*m_CMX_IJ_LL[counterIJ]);
-                }
-            }
-
-            for (size_t k = j+1; k < m_kk; k++) {
-                if (j == (m_kk-1)) {
-                    // we should never reach this step
-                    throw CanteraError("HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2",
-                                       "logic error 1 in Step 9 of hmw_act");
-                }
-                if (charge(k) > 0.0) {
-                    // Find the counterIJ for the symmetric j,k binary interaction
-                    // between 2 cations.
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-                    sum2 += molality[j]*molality[k]*m_PhiPhi_IJ_LL[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) < 0.0) {
-                            // species m is an anion
-                            n = m + k * m_kk + j * m_kk * m_kk;
-                            sum2 += molality[j]*molality[k]*molality[m]*m_Psi_ijk_LL[n];
-                        }
-                    }
-                }
-            }
-        }
-
-        // Loop Over Anions
-        if (charge(j) < 0) {
-            for (size_t k = j+1; k < m_kk; k++) {
-                if (j == m_kk-1) {
-                    // we should never reach this step
-                    throw CanteraError("HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2",
-                                       "logic error 2 in Step 9 of hmw_act");
-                }
-                if (charge(k) < 0) {
-                    // Find the counterIJ for the symmetric j,k binary interaction
-                    // between two anions
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-
-                    sum3 += molality[j]*molality[k]*m_PhiPhi_IJ_LL[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) > 0.0) {
-                            n = m + k * m_kk + j * m_kk * m_kk;
-                            sum3 += molality[j]*molality[k]*molality[m]*m_Psi_ijk_LL[n];
-                        }
-                    }
-                }
-            }
-        }
-
-        // Loop Over Neutral Species
-        if (charge(j) == 0) {
-            for (size_t k = 1; k < m_kk; k++) {
-                if (charge(k) < 0.0) {
-                    sum4 += molality[j]*molality[k]*m_Lambda_nj_LL(j,k);
-                }
-                if (charge(k) > 0.0) {
-                    sum5 += molality[j]*molality[k]*m_Lambda_nj_LL(j,k);
-                }
-                if (charge(k) == 0.0) {
-                    if (k > j) {
-                        sum6 += molality[j]*molality[k]*m_Lambda_nj_LL(j,k);
-                    } else if (k == j) {
-                        sum6 += 0.5 * molality[j]*molality[k]*m_Lambda_nj_LL(j,k);
-                    }
-                }
-                if (charge(k) < 0.0) {
-                    size_t izeta = j;
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) > 0.0) {
-                            size_t jzeta = m;
-                            size_t n = k + jzeta * m_kk + izeta * m_kk * m_kk;
-                            double zeta_LL = m_Psi_ijk_LL[n];
-                            if (zeta_LL != 0.0) {
-                                sum7 += molality[izeta]*molality[jzeta]*molality[k]*zeta_LL;
-                            }
-                        }
-                    }
-                }
-            }
-
-            sum7 += molality[j] * molality[j] * molality[j] * m_Mu_nnn_LL[j];
-        }
-    }
-    double sum_m_phi_minus_1 = 2.0 *
-                        (term1 + sum1 + sum2 + sum3 + sum4 + sum5 + sum6 + sum7);
-    // Calculate the osmotic coefficient from
-    //     osmotic_coeff = 1 + dGex/d(M0noRT) / sum(molality_i)
-    double d2_osmotic_coef_dT2;
-    if (molalitysum > 1.0E-150) {
-        d2_osmotic_coef_dT2 = 0.0 + (sum_m_phi_minus_1 / molalitysum);
-    } else {
-        d2_osmotic_coef_dT2 = 0.0;
-    }
-    double d2_lnwateract_dT2 = -(m_weightSolvent/1000.0) * molalitysum * d2_osmotic_coef_dT2;
-
-    // In Cantera, we define the activity coefficient of the solvent as
-    //
-    //     act_0 = actcoeff_0 * Xmol_0
-    //
-    // We have just computed act_0. However, this routine returns
-    //     ln(actcoeff[]). Therefore, we must calculate ln(actcoeff_0).
-    m_d2lnActCoeffMolaldT2_Unscaled[0] = d2_lnwateract_dT2;
-}
-
-void HMWSoln::s_update_dlnMolalityActCoeff_dP() const
-{
-    static const int cacheId = m_cache.getId();
-    CachedScalar cached = m_cache.getScalar(cacheId);
-    if( cached.validate(temperature(), pressure(), stateMFNumber()) ) {
-        return;
-    }
-
-    m_dlnActCoeffMolaldP_Unscaled.assign(m_kk, 0.0);
-    s_updatePitzer_dlnMolalityActCoeff_dP();
-
     for (size_t k = 1; k < m_kk; k++) {
-        if (CROP_speciesCropped_[k] == 2) {
-            m_dlnActCoeffMolaldP_Unscaled[k] = 0.0;
-        }
-    }
-
-    if (CROP_speciesCropped_[0]) {
-        m_dlnActCoeffMolaldP_Unscaled[0] = 0.0;
-    }
-
-    s_updateScaling_pHScaling_dP();
-}
-
-void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
-{
-    const double* molality = m_molalitiesCropped.data();
-
-    // Local variables defined by Coltrin
-    double etheta[5][5], etheta_prime[5][5], sqrtIs;
-
-    // Molality based ionic strength of the solution
-    double Is = 0.0;
-
-    // Molar charge of the solution: In Pitzer's notation, this is his variable
-    // called "Z".
-    double molarcharge = 0.0;
-
-    // molalitysum is the sum of the molalities over all solutes, even those
-    // with zero charge.
-    double molalitysum = 0.0;
-    double currTemp = temperature();
-    double currPres = pressure();
-
-    // Make sure the counter variables are setup
-    counterIJ_setup();
-
-    // ---------- Calculate common sums over solutes ---------------------
-    for (size_t n = 1; n < m_kk; n++) {
-        // ionic strength
-        Is += charge(n) * charge(n) * molality[n];
-        // total molar charge
-        molarcharge += fabs(charge(n)) * molality[n];
-        molalitysum += molality[n];
-    }
-    Is *= 0.5;
-
-    // Store the ionic molality in the object for reference.
-    m_IionicMolality = Is;
-    sqrtIs = sqrt(Is);
-
-    // The following call to calc_lambdas() calculates all 16 elements of the
-    // elambda and elambda1 arrays, given the value of the ionic strength (Is)
-    calc_lambdas(Is);
-
-    // Step 2: Find the coefficients E-theta and E-thetaprime for all
-    // combinations of positive unlike charges up to 4
-    for (int z1 = 1; z1 <=4; z1++) {
-        for (int z2 =1; z2 <=4; z2++) {
-            calc_thetas(z1, z2, &etheta[z1][z2], &etheta_prime[z1][z2]);
-        }
-    }
-
-    // calculate g(x) and hfunc(x) for each cation-anion pair MX
-    // In the original literature, hfunc, was called gprime. However,
-    // it's not the derivative of g(x), so I renamed it.
-    for (size_t i = 1; i < (m_kk - 1); i++) {
-        for (size_t j = (i+1); j < m_kk; j++) {
-            // Find the counterIJ for the symmetric binary interaction
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            // Only loop over oppositely charge species
-            if (charge(i)*charge(j) < 0) {
-                // x is a reduced function variable
-                double x1 = sqrtIs * m_Alpha1MX_ij[counterIJ];
-                if (x1 > 1.0E-100) {
-                    m_gfunc_IJ[counterIJ] = 2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 * x1);
-                    m_hfunc_IJ[counterIJ] = -2.0*
-                                       (1.0-(1.0 + x1 + 0.5 * x1 * x1) * exp(-x1)) / (x1 * x1);
-                } else {
-                    m_gfunc_IJ[counterIJ] = 0.0;
-                    m_hfunc_IJ[counterIJ] = 0.0;
-                }
-
-                if (m_Beta2MX_ij_P[counterIJ] != 0.0) {
-                    double x2 = sqrtIs * m_Alpha2MX_ij[counterIJ];
-                    if (x2 > 1.0E-100) {
-                        m_g2func_IJ[counterIJ] = 2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
-                        m_h2func_IJ[counterIJ] = -2.0 *
-                                            (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
-                    } else {
-                        m_g2func_IJ[counterIJ] = 0.0;
-                        m_h2func_IJ[counterIJ] = 0.0;
-                    }
-                }
-            } else {
-                m_gfunc_IJ[counterIJ] = 0.0;
-                m_hfunc_IJ[counterIJ] = 0.0;
-            }
-        }
-    }
-
-    // SUBSECTION TO CALCULATE BMX_P, BprimeMX_P, BphiMX_P
-    // These are now temperature derivatives of the previously calculated
-    // quantities.
-    for (size_t i = 1; i < m_kk - 1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            // Find the counterIJ for the symmetric binary interaction
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            // both species have a non-zero charge, and one is positive
-            // and the other is negative
-            if (charge(i)*charge(j) < 0.0) {
-                m_BMX_IJ_P[counterIJ] = m_Beta0MX_ij_P[counterIJ]
-                                    + m_Beta1MX_ij_P[counterIJ] * m_gfunc_IJ[counterIJ]
-                                    + m_Beta2MX_ij_P[counterIJ] * m_g2func_IJ[counterIJ];
-                if (Is > 1.0E-150) {
-                    m_BprimeMX_IJ_P[counterIJ] = (m_Beta1MX_ij_P[counterIJ] * m_hfunc_IJ[counterIJ]/Is +
-                                             m_Beta2MX_ij_P[counterIJ] * m_h2func_IJ[counterIJ]/Is);
-                } else {
-                    m_BprimeMX_IJ_P[counterIJ] = 0.0;
-                }
-                m_BphiMX_IJ_P[counterIJ] = m_BMX_IJ_P[counterIJ] + Is*m_BprimeMX_IJ_P[counterIJ];
-            } else {
-                m_BMX_IJ_P[counterIJ] = 0.0;
-                m_BprimeMX_IJ_P[counterIJ] = 0.0;
-                m_BphiMX_IJ_P[counterIJ] = 0.0;
-            }
-        }
-    }
-
-    // --------- SUBSECTION TO CALCULATE CMX_P ----------
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            // Find the counterIJ for the symmetric binary interaction
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            // both species have a non-zero charge, and one is positive
-            // and the other is negative
-            if (charge(i)*charge(j) < 0.0) {
-                m_CMX_IJ_P[counterIJ] = m_CphiMX_ij_P[counterIJ]/
-                                   (2.0* sqrt(fabs(charge(i)*charge(j))));
-            } else {
-                m_CMX_IJ_P[counterIJ] = 0.0;
-            }
-        }
-    }
-
-    // ------- SUBSECTION TO CALCULATE Phi, PhiPrime, and PhiPhi ----------
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            // Find the counterIJ for the symmetric binary interaction
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            // both species have a non-zero charge, and one is positive
-            // and the other is negative
-            if (charge(i)*charge(j) > 0) {
-                m_Phi_IJ_P[counterIJ] = m_Theta_ij_P[counterIJ];
-                m_Phiprime_IJ[counterIJ] = 0.0;
-                m_PhiPhi_IJ_P[counterIJ] = m_Phi_IJ_P[counterIJ] + Is * m_Phiprime_IJ[counterIJ];
-            } else {
-                m_Phi_IJ_P[counterIJ] = 0.0;
-                m_Phiprime_IJ[counterIJ] = 0.0;
-                m_PhiPhi_IJ_P[counterIJ] = 0.0;
-            }
-        }
-    }
-
-    // ----------- SUBSECTION FOR CALCULATION OF dFdT ---------------------
-    double dA_DebyedP = dA_DebyedP_TP(currTemp, currPres);
-    double dAphidP = dA_DebyedP /3.0;
-    double dFdP = -dAphidP * (sqrt(Is) / (1.0 + 1.2*sqrt(Is))
-                       + (2.0/1.2) * log(1.0+1.2*(sqrtIs)));
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            // Find the counterIJ for the symmetric binary interaction
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            // both species have a non-zero charge, and one is positive
-            // and the other is negative
-            if (charge(i)*charge(j) < 0) {
-                dFdP += molality[i]*molality[j] * m_BprimeMX_IJ_P[counterIJ];
-            }
-
-            // Both species have a non-zero charge, and they
-            // have the same sign, that is, both positive or both negative.
-            if (charge(i)*charge(j) > 0) {
-                dFdP += molality[i]*molality[j] * m_Phiprime_IJ[counterIJ];
-            }
-        }
-    }
-
-    for (size_t i = 1; i < m_kk; i++) {
-        // -------- SUBSECTION FOR CALCULATING THE dACTCOEFFdP FOR CATIONS -----
-        if (charge(i) > 0) {
-            // species i is the cation (positive) to calc the actcoeff
-            double zsqdFdP = charge(i)*charge(i)*dFdP;
-            double sum1 = 0.0;
-            double sum2 = 0.0;
-            double sum3 = 0.0;
-            double sum4 = 0.0;
-            double sum5 = 0.0;
-            for (size_t j = 1; j < m_kk; j++) {
-                // Find the counterIJ for the symmetric binary interaction
-                size_t n = m_kk*i + j;
-                size_t counterIJ = m_CounterIJ[n];
-
-                if (charge(j) < 0.0) {
-                    // sum over all anions
-                    sum1 += molality[j]*
-                            (2.0*m_BMX_IJ_P[counterIJ] + molarcharge*m_CMX_IJ_P[counterIJ]);
-                    if (j < m_kk-1) {
-                        // This term is the ternary interaction involving the
-                        // non-duplicate sum over double anions, j, k, with
-                        // respect to the cation, i.
-                        for (size_t k = j+1; k < m_kk; k++) {
-                            // an inner sum over all anions
-                            if (charge(k) < 0.0) {
-                                n = k + j * m_kk + i * m_kk * m_kk;
-                                sum3 += molality[j]*molality[k]*m_Psi_ijk_P[n];
-                            }
-                        }
-                    }
-                }
-
-                if (charge(j) > 0.0) {
-                    // sum over all cations
-                    if (j != i) {
-                        sum2 += molality[j]*(2.0*m_Phi_IJ_P[counterIJ]);
-                    }
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            // two inner sums over anions
-                            n = k + j * m_kk + i * m_kk * m_kk;
-                            sum2 += molality[j]*molality[k]*m_Psi_ijk_P[n];
-
-                            // Find the counterIJ for the j,k interaction
-                            n = m_kk*j + k;
-                            size_t counterIJ2 = m_CounterIJ[n];
-                            sum4 += fabs(charge(i)) *
-                                    molality[j]*molality[k]*m_CMX_IJ_P[counterIJ2];
-                        }
-                    }
-                }
-
-                // for Anions, do the neutral species interaction
-                if (charge(j) == 0) {
-                    sum5 += molality[j]*2.0*m_Lambda_nj_P(j,i);
-                    // Zeta interaction term
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            size_t izeta = j;
-                            size_t jzeta = i;
-                            n = izeta * m_kk * m_kk + jzeta * m_kk + k;
-                            double zeta_P = m_Psi_ijk_P[n];
-                            if (zeta_P != 0.0) {
-                                sum5 += molality[j]*molality[k]*zeta_P;
-                            }
-                        }
-                    }
-                }
-            }
-
-            // Add all of the contributions up to yield the log of the
-            // solute activity coefficients (molality scale)
-            m_dlnActCoeffMolaldP_Unscaled[i] =
-                zsqdFdP + sum1 + sum2 + sum3 + sum4 + sum5;
-        }
-
-        // ------ SUBSECTION FOR CALCULATING THE dACTCOEFFdP FOR ANIONS ------
-        if (charge(i) < 0) {
-            // species i is an anion (negative)
-            double zsqdFdP = charge(i)*charge(i)*dFdP;
-            double sum1 = 0.0;
-            double sum2 = 0.0;
-            double sum3 = 0.0;
-            double sum4 = 0.0;
-            double sum5 = 0.0;
-            for (size_t j = 1; j < m_kk; j++) {
-                // Find the counterIJ for the symmetric binary interaction
-                size_t n = m_kk*i + j;
-                size_t counterIJ = m_CounterIJ[n];
-
-                // For Anions, do the cation interactions.
-                if (charge(j) > 0) {
-                    sum1 += molality[j] *
-                            (2.0*m_BMX_IJ_P[counterIJ] + molarcharge*m_CMX_IJ_P[counterIJ]);
-                    if (j < m_kk-1) {
-                        for (size_t k = j+1; k < m_kk; k++) {
-                            // an inner sum over all cations
-                            if (charge(k) > 0) {
-                                n = k + j * m_kk + i * m_kk * m_kk;
-                                sum3 += molality[j]*molality[k]*m_Psi_ijk_P[n];
-                            }
-                        }
-                    }
-                }
-
-                // For Anions, do the other anion interactions.
-                if (charge(j) < 0.0) {
-                    //  sum over all anions
-                    if (j != i) {
-                        sum2 += molality[j]*(2.0*m_Phi_IJ_P[counterIJ]);
-                    }
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) > 0.0) {
-                            // two inner sums over cations
-                            n = k + j * m_kk + i * m_kk * m_kk;
-                            sum2 += molality[j]*molality[k]*m_Psi_ijk_P[n];
-                            // Find the counterIJ for the symmetric binary interaction
-                            n = m_kk*j + k;
-                            size_t counterIJ2 = m_CounterIJ[n];
-                            sum4 += fabs(charge(i))*
-                                    molality[j]*molality[k]*m_CMX_IJ_P[counterIJ2];
-                        }
-                    }
-                }
-
-                // for Anions, do the neutral species interaction
-                if (charge(j) == 0.0) {
-                    sum5 += molality[j]*2.0*m_Lambda_nj_P(j,i);
-                    // Zeta interaction term
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) > 0.0) {
-                            size_t izeta = j;
-                            size_t jzeta = k;
-                            size_t kzeta = i;
-                            n = izeta * m_kk * m_kk + jzeta * m_kk + kzeta;
-                            double zeta_P = m_Psi_ijk_P[n];
-                            if (zeta_P != 0.0) {
-                                sum5 += molality[j]*molality[k]*zeta_P;
-                            }
-                        }
-                    }
-                }
-            }
-            m_dlnActCoeffMolaldP_Unscaled[i] =
-                zsqdFdP + sum1 + sum2 + sum3 + sum4 + sum5;
-        }
-
-        // ------ SUBSECTION FOR CALCULATING d NEUTRAL SOLUTE ACT COEFF dP -----
-        if (charge(i) == 0.0) {
-            double sum1 = 0.0;
-            double sum3 = 0.0;
-            for (size_t j = 1; j < m_kk; j++) {
-                sum1 += molality[j]*2.0*m_Lambda_nj_P(i,j);
-                // Zeta term -> we piggyback on the psi term
-                if (charge(j) > 0.0) {
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            size_t n = k + j * m_kk + i * m_kk * m_kk;
-                            sum3 += molality[j]*molality[k]*m_Psi_ijk_P[n];
-                        }
-                    }
-                }
-            }
-            double sum2 = 3.0 * molality[i] * molality[i] * m_Mu_nnn_P[i];
-            m_dlnActCoeffMolaldP_Unscaled[i] = sum1 + sum2 + sum3;
-        }
-    }
-
-    // ------ SUBSECTION FOR CALCULATING THE d OSMOTIC COEFF dP ---------
-    double sum1 = 0.0;
-    double sum2 = 0.0;
-    double sum3 = 0.0;
-    double sum4 = 0.0;
-    double sum5 = 0.0;
-    double sum6 = 0.0;
-    double sum7 = 0.0;
-
-    // term1 is the temperature derivative of the DH term in the osmotic
-    // coefficient expression
-    // b = 1.2 sqrt(kg/gmol) <- arbitrarily set in all Pitzer implementations.
-    // Is = Ionic strength on the molality scale (units of (gmol/kg))
-    // Aphi = A_Debye / 3   (units of sqrt(kg/gmol))
-    double term1 = -dAphidP * Is * sqrt(Is) / (1.0 + 1.2 * sqrt(Is));
-
-    for (size_t j = 1; j < m_kk; j++) {
-        // Loop Over Cations
-        if (charge(j) > 0.0) {
-            for (size_t k = 1; k < m_kk; k++) {
-                if (charge(k) < 0.0) {
-                    // Find the counterIJ for the symmetric j,k binary interaction
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-                    sum1 += molality[j]*molality[k]*
-                            (m_BphiMX_IJ_P[counterIJ] + molarcharge*m_CMX_IJ_P[counterIJ]);
-                }
-            }
-
-            for (size_t k = j+1; k < m_kk; k++) {
-                if (j == (m_kk-1)) {
-                    // we should never reach this step
-                    throw CanteraError("HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP",
-                                       "logic error 1 in Step 9 of hmw_act");
-                }
-                if (charge(k) > 0.0) {
-                    // Find the counterIJ for the symmetric j,k binary interaction
-                    // between 2 cations.
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-                    sum2 += molality[j]*molality[k]*m_PhiPhi_IJ_P[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) < 0.0) {
-                            // species m is an anion
-                            n = m + k * m_kk + j * m_kk * m_kk;
-                            sum2 += molality[j]*molality[k]*molality[m]*m_Psi_ijk_P[n];
-                        }
-                    }
-                }
-            }
-        }
-
-        // Loop Over Anions
-        if (charge(j) < 0) {
-            for (size_t k = j+1; k < m_kk; k++) {
-                if (j == m_kk-1) {
-                    // we should never reach this step
-                    throw CanteraError("HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP",
-                                       "logic error 2 in Step 9 of hmw_act");
-                }
-                if (charge(k) < 0) {
-                    // Find the counterIJ for the symmetric j,k binary interaction
-                    // between two anions
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-
-                    sum3 += molality[j]*molality[k]*m_PhiPhi_IJ_P[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) > 0.0) {
-                            n = m + k * m_kk + j * m_kk * m_kk;
-                            sum3 += molality[j]*molality[k]*molality[m]*m_Psi_ijk_P[n];
-                        }
-                    }
-                }
+        molarcharge += fabs(charge(k)) * molality[k];
+    }
+
+    // Debye-Huckel terms in F, Pitzer Eqn. (65), and in the osmotic coefficient,
+    // with b = 1.2 sqrt(kg/gmol)
+    double fDH = -(sqrtIs / (1.0 + 1.2*sqrtIs) + (2.0/1.2) * log(1.0 + 1.2*sqrtIs));
+    double phiDH = -Is * sqrtIs / (1.0 + 1.2*sqrtIs);
+
+    // F and the sum of m_M m_X C_MX over all cation-anion pairs are added to the
+    // activity coefficients of all ions after the pass over the interactions
+    double F[3], sumC[3];
+    for (size_t t = 0; t < nTerms; t++) {
+        F[t] = terms[t].Aphi * fDH;
+        sumC[t] = 0.0;
+        terms[t].osmoticSum = terms[t].Aphi * phiDH;
+        std::fill(terms[t].lnGamma + 1, terms[t].lnGamma + m_kk, 0.0);
+    }
+
+    // Cation-anion interactions. Agrees with Pitzer, Eq. (49), (51), (53), (55)
+    for (const auto& [i, j, c] : m_pairsCA) {
+        double mij = molality[i] * molality[j];
+        double Cfactor = 1.0 / (2.0 * sqrt(fabs(charge(i) * charge(j))));
+        for (size_t t = 0; t < nTerms; t++) {
+            PitzerTerms& r = terms[t];
+            double BMX = r.beta0[c] + r.beta1[c] * m_gfunc_IJ[c]
+                         + r.beta2[c] * m_g2func_IJ[c];
+            double BprimeMX = 0.0;
+            if (Is > 1.0E-150) {
+                BprimeMX = (r.beta1[c] * m_hfunc_IJ[c]
+                            + r.beta2[c] * m_h2func_IJ[c]) / Is;
+            }
+            double CMX = r.Cphi[c] * Cfactor;
+            double BC = 2.0 * BMX + molarcharge * CMX;
+            r.lnGamma[i] += molality[j] * BC;
+            r.lnGamma[j] += molality[i] * BC;
+            F[t] += mij * BprimeMX;
+            sumC[t] += mij * CMX;
+            r.osmoticSum += mij * (BMX + Is * BprimeMX + molarcharge * CMX);
+        }
+    }
+
+    // Interactions of ions with charges of the same sign. Agrees with Pitzer,
+    // Eq. 72, 73, 74
+    for (const auto& [i, j, c] : m_pairsLike) {
+        double mij = molality[i] * molality[j];
+        for (size_t t = 0; t < nTerms; t++) {
+            PitzerTerms& r = terms[t];
+            double Phi = r.theta[c];
+            double Phiprime = 0.0;
+            if (r.etheta) {
+                Phi += m_Etheta_IJ[c];
+                Phiprime = m_Etheta_prime_IJ[c];
+            }
+            r.lnGamma[i] += 2.0 * molality[j] * Phi;
+            r.lnGamma[j] += 2.0 * molality[i] * Phi;
+            F[t] += mij * Phiprime;
+            r.osmoticSum += mij * (Phi + Is * Phiprime);
+        }
+    }
+
+    // Ternary psi and zeta interactions
+    for (const auto& [i, j, k, n] : m_psiTriplets) {
+        double mij = molality[i] * molality[j];
+        double mik = molality[i] * molality[k];
+        double mjk = molality[j] * molality[k];
+        for (size_t t = 0; t < nTerms; t++) {
+            PitzerTerms& r = terms[t];
+            double psi = r.psi[n];
+            r.lnGamma[i] += mjk * psi;
+            r.lnGamma[j] += mik * psi;
+            r.lnGamma[k] += mij * psi;
+            r.osmoticSum += mij * molality[k] * psi;
+        }
+    }
+
+    // Interactions of neutral species with all solutes
+    for (const auto& [i, j, c] : m_lambdaPairs) {
+        double mij = molality[i] * molality[j];
+        for (size_t t = 0; t < nTerms; t++) {
+            PitzerTerms& r = terms[t];
+            double lambda = (*r.lambda)(i, j);
+            r.lnGamma[i] += 2.0 * molality[j] * lambda;
+            if (charge(j) != 0.0) {
+                r.lnGamma[j] += 2.0 * molality[i] * lambda;
+                r.osmoticSum += mij * lambda;
+            } else if (j > i) {
+                r.osmoticSum += mij * lambda;
+            } else if (j == i) {
+                r.osmoticSum += 0.5 * mij * lambda;
+            }
+        }
+    }
+    for (size_t i : m_neutralSolutes) {
+        double m2 = molality[i] * molality[i];
+        for (size_t t = 0; t < nTerms; t++) {
+            PitzerTerms& r = terms[t];
+            r.lnGamma[i] += 3.0 * m2 * r.mu[i];
+            r.osmoticSum += m2 * molality[i] * r.mu[i];
+        }
+    }
+
+    // Terms in F and C_MX for the ions. Agrees with Pitzer, eqn.(63) and (64)
+    for (size_t k = 1; k < m_kk; k++) {
+        if (charge(k) != 0.0) {
+            for (size_t t = 0; t < nTerms; t++) {
+                terms[t].lnGamma[k] += charge(k) * charge(k) * F[t]
+                                       + fabs(charge(k)) * sumC[t];
             }
         }
-
-        // Loop Over Neutral Species
-        if (charge(j) == 0) {
-            for (size_t k = 1; k < m_kk; k++) {
-                if (charge(k) < 0.0) {
-                    sum4 += molality[j]*molality[k]*m_Lambda_nj_P(j,k);
-                }
-                if (charge(k) > 0.0) {
-                    sum5 += molality[j]*molality[k]*m_Lambda_nj_P(j,k);
-                }
-                if (charge(k) == 0.0) {
-                    if (k > j) {
-                        sum6 += molality[j]*molality[k]*m_Lambda_nj_P(j,k);
-                    } else if (k == j) {
-                        sum6 += 0.5 * molality[j]*molality[k]*m_Lambda_nj_P(j,k);
-                    }
-                }
-                if (charge(k) < 0.0) {
-                    size_t izeta = j;
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) > 0.0) {
-                            size_t jzeta = m;
-                            size_t n = k + jzeta * m_kk + izeta * m_kk * m_kk;
-                            double zeta_P = m_Psi_ijk_P[n];
-                            if (zeta_P != 0.0) {
-                                sum7 += molality[izeta]*molality[jzeta]*molality[k]*zeta_P;
-                            }
-                        }
-                    }
-                }
-            }
-
-            sum7 += molality[j] * molality[j] * molality[j] * m_Mu_nnn_P[j];
-        }
     }
-    double sum_m_phi_minus_1 = 2.0 *
-                        (term1 + sum1 + sum2 + sum3 + sum4 + sum5 + sum6 + sum7);
-
-    // Calculate the osmotic coefficient from
-    //     osmotic_coeff = 1 + dGex/d(M0noRT) / sum(molality_i)
-    double d_osmotic_coef_dP;
-    if (molalitysum > 1.0E-150) {
-        d_osmotic_coef_dP = 0.0 + (sum_m_phi_minus_1 / molalitysum);
-    } else {
-        d_osmotic_coef_dP = 0.0;
-    }
-    double d_lnwateract_dP = -(m_weightSolvent/1000.0) * molalitysum * d_osmotic_coef_dP;
-
-    // In Cantera, we define the activity coefficient of the solvent as
-    //
-    //     act_0 = actcoeff_0 * Xmol_0
-    //
-    // We have just computed act_0. However, this routine returns
-    //     ln(actcoeff[]). Therefore, we must calculate ln(actcoeff_0).
-    m_dlnActCoeffMolaldP_Unscaled[0] = d_lnwateract_dP;
 }
 
 void HMWSoln::calc_lambdas(double is) const
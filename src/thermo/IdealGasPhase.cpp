@@ -11,6 +11,7 @@
 #include "cantera/thermo/IdealGasPhase.h"
 #include "cantera/thermo/ThermoFactory.h"
 #include "cantera/base/utilities.h"
+#include "cantera/thermo/speciesThermoTypes.h"
 
 namespace Cantera
 {
@@ -264,6 +265,169 @@ void IdealGasPhase::setToEquilState(const double* mu_RT)
     setPressure(pres);
 }
 
+size_t IdealGasPhase::solveTemperatures_HY(size_t nStates, const double* h,
+    const double* Y, double* T, int* iterations, double rtol, int maxIter) const
+{
+    return solveTemperatures(nStates, h, Y, T, iterations, rtol, maxIter, false);
+}
+
+size_t IdealGasPhase::solveTemperatures_UY(size_t nStates, const double* u,
+    const double* Y, double* T, int* iterations, double rtol, int maxIter) const
+{
+    return solveTemperatures(nStates, u, Y, T, iterations, rtol, maxIter, true);
+}
+
+size_t IdealGasPhase::solveTemperatures(size_t nStates, const double* e,
+    const double* Y, double* T, int* iterations, double rtol, int maxIter,
+    bool doUV) const
+{
+    // If all species use NASA 7-coefficient polynomials, tabulate the
+    // coefficients a_0 to a_5 used by each species in each of the temperature
+    // intervals bounded by the distinct midpoint temperatures of the species.
+    // Within interval j, species k uses the high temperature polynomial if its
+    // midpoint temperature is less than or equal to mids[j-1].
+    bool nasa = true;
+    vector<double> mids(m_kk);
+    vector<double> c(15);
+    vector<double> coeffs(12 * m_kk); // [a_m for species k] = coeffs[m*m_kk + k]
+    for (size_t k = 0; k < m_kk; k++) {
+        if (m_spthermo.reportType(k) != NASA2) {
+            nasa = false;
+            break;
+        }
+        int type;
+        double tlow, thigh, pref;
+        m_spthermo.reportParams(k, type, c.data(), tlow, thigh, pref);
+        mids[k] = c[0];
+        for (size_t m = 0; m < 6; m++) {
+            coeffs[m * m_kk + k] = c[8 + m]; // low temperature range
+            coeffs[(6 + m) * m_kk + k] = c[1 + m]; // high temperature range
+        }
+    }
+    vector<double> sortedMids;
+    vector<double> table; // [interval j, a_m, species k]
+    if (nasa) {
+        sortedMids = mids;
+        std::sort(sortedMids.begin(), sortedMids.end());
+        sortedMids.erase(std::unique(sortedMids.begin(), sortedMids.end()),
+                         sortedMids.end());
+        size_t nInt = sortedMids.size() + 1;
+        table.resize(nInt * 6 * m_kk);
+        for (size_t j = 0; j < nInt; j++) {
+            for (size_t k = 0; k < m_kk; k++) {
+                size_t offset = (j > 0 && mids[k] <= sortedMids[j-1]) ? 6 : 0;
+                for (size_t m = 0; m < 6; m++) {
+                    table[(j * 6 + m) * m_kk + k] = coeffs[(offset + m) * m_kk + k];
+                }
+            }
+        }
+    }
+
+    const vector<double>& rmw = inverseMolecularWeights();
+    vector<double> yw(m_kk), cp_R(m_kk), h_RT(m_kk), s_R(m_kk);
+    size_t total = 0;
+    for (size_t i = 0; i < nStates; i++) {
+        const double* y = Y + i * m_kk;
+        double sumYw = 0.0; // inverse of the mean molecular weight
+        for (size_t k = 0; k < m_kk; k++) {
+            yw[k] = y[k] * rmw[k];
+            sumYw += yw[k];
+        }
+
+        // Coefficients of the polynomial for the mixture, valid in the current
+        // temperature interval
+        size_t interval = npos;
+        double a[6];
+
+        // Evaluate the residual and its derivative (the specific heat) at *t*
+        auto eval = [&](double t, double& f, double& dfdt) {
+            double hmix, cpmix;
+            if (nasa) {
+                size_t j = std::lower_bound(sortedMids.begin(), sortedMids.end(), t)
+                           - sortedMids.begin();
+                if (j != interval) {
+                    const double* tab = &table[j * 6 * m_kk];
+                    for (size_t m = 0; m < 6; m++) {
+                        double sum = 0.0;
+                        for (size_t k = 0; k < m_kk; k++) {
+                            sum += yw[k] * tab[m * m_kk + k];
+                        }
+                        a[m] = sum;
+                    }
+                    interval = j;
+                }
+                hmix = GasConstant * (((((0.2 * a[4] * t + 0.25 * a[3]) * t
+                        + a[2] / 3.0) * t + 0.5 * a[1]) * t + a[0]) * t + a[5]);
+                cpmix = GasConstant * ((((a[4] * t + a[3]) * t + a[2]) * t
+                        + a[1]) * t + a[0]);
+            } else {
+                m_spthermo.update(t, cp_R.data(), h_RT.data(), s_R.data());
+                hmix = 0.0;
+                cpmix = 0.0;
+                for (size_t k = 0; k < m_kk; k++) {
+                    hmix += yw[k] * h_RT[k];
+                    cpmix += yw[k] * cp_R[k];
+                }
+                hmix *= GasConstant * t;
+                cpmix *= GasConstant;
+            }
+            if (doUV) {
+                hmix -= GasConstant * t * sumYw;
+                cpmix -= GasConstant * sumYw;
+            }
+            f = hmix - e[i];
+            dfdt = cpmix;
+        };
+
+        double t = T[i];
+        if (!(t > 0.0)) {
+            throw CanteraError("IdealGasPhase::solveTemperatures",
+                "Initial temperature for state {} must be positive. T = {}", i, t);
+        }
+        // Bracket for the solution, since the residual increases with temperature
+        double tlow = 0.0;
+        double thigh = std::numeric_limits<double>::infinity();
+        int n = 0;
+        bool converged = false;
+        while (n < maxIter) {
+            n++;
+            double f, dfdt;
+            eval(t, f, dfdt);
+            if (f == 0.0) {
+                converged = true;
+                break;
+            } else if (f > 0.0) {
+                thigh = t;
+            } else {
+                tlow = t;
+            }
+            double tnew = t - f / dfdt;
+            if (!(tnew > tlow && tnew < thigh)) {
+                // Newton step leaves the bracket; use bisection, or expand the
+                // bracket if there is no upper bound yet
+                tnew = std::isinf(thigh) ? 2.0 * t : 0.5 * (tlow + thigh);
+            }
+            double dt = tnew - t;
+            t = tnew;
+            if (std::abs(dt) <= rtol * t) {
+                converged = true;
+                break;
+            }
+        }
+        if (!converged) {
+            throw CanteraError("IdealGasPhase::solveTemperatures",
+                "No convergence in {} iterations for state {}. Last T = {}",
+                maxIter, i, t);
+        }
+        T[i] = t;
+        if (iterations) {
+            iterations[i] = n;
+        }
+        total += n;
+    }
+    return total;
+}
+
 void IdealGasPhase::updateThermo() const
 {
     static const int cacheId = m_cache.getId();
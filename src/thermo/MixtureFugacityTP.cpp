@@ -18,6 +18,98 @@ using namespace std;
 namespace Cantera
 {
 
+namespace {
+
+//! Solve the Rachford-Rice equation for the molar vapor fraction, given the feed
+//! mole fractions *z* and the equilibrium ratios *K*, starting from *beta*. The
+//! root is bracketed by the asymptotes of the Rachford-Rice function, so the result
+//! may lie outside of [0, 1]. If there is no root, 0 is returned if all *K* <= 1 and
+//! 1 if all *K* >= 1.
+double rachfordRice(const vector<double>& z, const vector<double>& K, double beta)
+{
+    double Kmin = BigNumber;
+    double Kmax = 0.0;
+    for (size_t k = 0; k < z.size(); k++) {
+        if (z[k] > 0.0) {
+            Kmin = std::min(Kmin, K[k]);
+            Kmax = std::max(Kmax, K[k]);
+        }
+    }
+    if (Kmax <= 1.0) {
+        return 0.0;
+    } else if (Kmin >= 1.0) {
+        return 1.0;
+    }
+    double lo = 1.0 / (1.0 - Kmax);
+    double hi = 1.0 / (1.0 - Kmin);
+    if (!(beta > lo && beta < hi)) {
+        beta = 0.5 * (lo + hi);
+    }
+    for (int iter = 0; iter < 100; iter++) {
+        // The Rachford-Rice function is monotonically decreasing
+        double f = 0.0, dfdb = 0.0;
+        for (size_t k = 0; k < z.size(); k++) {
+            double t = (K[k] - 1.0) / (1.0 + beta * (K[k] - 1.0));
+            f += z[k] * t;
+            dfdb -= z[k] * t * t;
+        }
+        if (f > 0.0) {
+            lo = beta;
+        } else {
+            hi = beta;
+        }
+        double betaNew = (dfdb < 0.0) ? beta - f / dfdb : 0.5 * (lo + hi);
+        if (betaNew <= lo || betaNew >= hi) {
+            betaNew = 0.5 * (lo + hi);
+        }
+        if (std::abs(betaNew - beta) < 1e-14 * std::max(1.0, std::abs(beta))) {
+            return betaNew;
+        }
+        beta = betaNew;
+    }
+    return beta;
+}
+
+//! Extrapolate the successive substitution iterate *v* using the general dominant
+//! eigenvalue method, given the last three updates *g0* (most recent), *g1* and
+//! *g2*. The eigenvalues of the iteration are estimated from a least squares fit
+//! of the recurrence g0 + c1 g1 + c2 g2 = 0. If the last two updates are nearly
+//! collinear, a single dominant eigenvalue is used instead.
+void gdemStep(vector<double>& v, const vector<double>& g0, const vector<double>& g1,
+              const vector<double>& g2)
+{
+    double b01 = 0.0, b02 = 0.0, b11 = 0.0, b12 = 0.0, b22 = 0.0;
+    for (size_t k = 0; k < v.size(); k++) {
+        b01 += g0[k] * g1[k];
+        b02 += g0[k] * g2[k];
+        b11 += g1[k] * g1[k];
+        b12 += g1[k] * g2[k];
+        b22 += g2[k] * g2[k];
+    }
+    double det = b11 * b22 - b12 * b12;
+    if (det > 1e-10 * b11 * b22) {
+        double c1 = (b02 * b12 - b01 * b22) / det;
+        double c2 = (b01 * b12 - b02 * b11) / det;
+        double denom = 1.0 + c1 + c2; // product of (1 - eigenvalue)
+        if (denom > 1e-3) {
+            for (size_t k = 0; k < v.size(); k++) {
+                v[k] -= ((c1 + c2) * g0[k] + c2 * g1[k]) / denom;
+            }
+            return;
+        }
+    }
+    if (b11 > 0.0) {
+        double lambda = b01 / b11;
+        if (lambda > 0.0 && lambda < 0.999) {
+            for (size_t k = 0; k < v.size(); k++) {
+                v[k] += g0[k] * lambda / (1.0 - lambda);
+            }
+        }
+    }
+}
+
+}
+
 int MixtureFugacityTP::standardStateConvention() const
 {
     return cSS_CONVENTION_TEMPERATURE;
@@ -714,6 +806,334 @@ double MixtureFugacityTP::calculatePsat(double TKelvin, double& molarVolGas,
     return pres;
 }
 
+double MixtureFugacityTP::flashTP(double T, double P, double* xLiquid,
+                                  double* yVapor)
+{
+    setTemperature(T);
+    double h;
+    return flashAtT(P, xLiquid, yVapor, h);
+}
+
+double MixtureFugacityTP::flashHP(double h, double P, double* xLiquid,
+                                  double* yVapor)
+{
+    vector<double> z = moleFractions_;
+    double T = temperature();
+    double Tlow = 0.0, Thigh = 0.0; // bracket, once found
+    double flow = 0.0, fhigh = 0.0;
+    bool haveLow = false, haveHigh = false;
+    double Tlast = 0.0, flast = 0.0;
+    double beta = 0.0;
+    int side = 0; // used to modify the secant method when bracketed (Illinois)
+    for (int iter = 0; iter < 100; iter++) {
+        setMoleFractions(z.data());
+        setTemperature(T);
+        double hmix;
+        beta = flashAtT(P, xLiquid, yVapor, hmix);
+        double f = hmix - h;
+        if (f == 0.0) {
+            return beta;
+        }
+        double Tnew;
+        if (f < 0.0) {
+            Tlow = T;
+            flow = f;
+            haveLow = true;
+            if (side == -1 && haveHigh) {
+                fhigh *= 0.5;
+            }
+            side = -1;
+        } else {
+            Thigh = T;
+            fhigh = f;
+            haveHigh = true;
+            if (side == 1 && haveLow) {
+                flow *= 0.5;
+            }
+            side = 1;
+        }
+        if (haveLow && haveHigh) {
+            // regula falsi with the Illinois modification
+            Tnew = Tlow - flow * (Thigh - Tlow) / (fhigh - flow);
+            if (!(Tnew > Tlow && Tnew < Thigh)) {
+                Tnew = 0.5 * (Tlow + Thigh);
+            }
+        } else {
+            double dhdT;
+            if (iter == 0 || T == Tlast) {
+                dhdT = cp_mole();
+            } else {
+                dhdT = (f - flast) / (T - Tlast);
+            }
+            if (!(dhdT > 0.0)) {
+                dhdT = cp_mole();
+            }
+            // limit the step size until the solution is bracketed
+            double dT = std::max(-0.2 * T, std::min(0.2 * T, -f / dhdT));
+            Tnew = T + dT;
+        }
+        Tlast = T;
+        flast = f;
+        if (std::abs(Tnew - T) < 1e-10 * T) {
+            return beta;
+        }
+        T = Tnew;
+    }
+    throw CanteraError("MixtureFugacityTP::flashHP",
+        "No convergence for h = {}, P = {}; last temperature: {}", h, P, T);
+}
+
+int MixtureFugacityTP::volumeRoots(double P, double Vroot[3]) const
+{
+    throw NotImplementedError("MixtureFugacityTP::volumeRoots");
+}
+
+double MixtureFugacityTP::flashLnPhi(double P, const double* x, int branch,
+                                     double* lnphi)
+{
+    setMoleFractions(x);
+    double Vroot[3];
+    int nroots = volumeRoots(P, Vroot);
+    double mv = Vroot[0];
+    if (nroots == 3 || nroots == -3) {
+        mv = (branch == FLUID_GAS) ? Vroot[2] : Vroot[0];
+    } else if (nroots == 2 || nroots == -2) {
+        mv = (branch == FLUID_GAS) ? std::max(Vroot[0], Vroot[1])
+                                   : std::min(Vroot[0], Vroot[1]);
+    } else if (nroots == 0) {
+        throw CanteraError("MixtureFugacityTP::flashLnPhi",
+            "Unable to find the density at T = {}, P = {}", temperature(), P);
+    }
+    double rho = meanMolecularWeight() / mv;
+    setDensity(rho);
+    getActivityCoefficients(lnphi);
+    for (size_t k = 0; k < m_kk; k++) {
+        lnphi[k] = log(lnphi[k]);
+    }
+    return rho;
+}
+
+double MixtureFugacityTP::flashAtT(double P, double* xLiquid, double* yVapor,
+                                   double& hmole)
+{
+    double T = temperature();
+    vector<double> z = moleFractions_;
+
+    // Select the most stable root for the feed
+    vector<double> lnphiZ(m_kk), lnphiV(m_kk);
+    double rhoZ = flashLnPhi(P, z.data(), FLUID_LIQUID_0, lnphiZ.data());
+    double rhoV = flashLnPhi(P, z.data(), FLUID_GAS, lnphiV.data());
+    if (rhoV != rhoZ && dot(z.begin(), z.end(), lnphiV.begin())
+                        < dot(z.begin(), z.end(), lnphiZ.begin())) {
+        rhoZ = rhoV;
+        lnphiZ = lnphiV;
+    }
+    vector<double> d(m_kk);
+    for (size_t k = 0; k < m_kk; k++) {
+        d[k] = log(std::max(z[k], SmallNumber)) + lnphiZ[k];
+    }
+
+    vector<double> lnK, x(m_kk), y(m_kk);
+    double beta = 0.0;
+    bool twoPhase = false;
+    if (m_flashLnK.size() == m_kk) {
+        lnK = m_flashLnK;
+        twoPhase = flashSplit(P, z, d, lnK, beta, x, y);
+    }
+
+    if (!twoPhase) {
+        // Initial estimate of the equilibrium ratios based on the critical
+        // properties of the pure species
+        if (m_flashTc.size() != m_kk) {
+            m_flashTc.resize(m_kk);
+            m_flashPc.resize(m_kk);
+            vector<double> xpure(m_kk, 0.0);
+            for (size_t k = 0; k < m_kk; k++) {
+                xpure[k] = 1.0;
+                setMoleFractions(xpure.data());
+                m_flashTc[k] = critTemperature();
+                m_flashPc[k] = critPressure();
+                xpure[k] = 0.0;
+            }
+        }
+        lnK.resize(m_kk);
+        for (size_t k = 0; k < m_kk; k++) {
+            // Same correlation as psatEst(), also used for supercritical species
+            double tt = m_flashTc[k] / T;
+            lnK[k] = log(m_flashPc[k] / P) - 0.8734*tt*tt - 3.4522*tt + 4.2918;
+        }
+
+        vector<double> lnWv(m_kk), lnWl(m_kk);
+        for (size_t k = 0; k < m_kk; k++) {
+            lnWv[k] = log(std::max(z[k], SmallNumber)) + lnK[k];
+            lnWl[k] = log(std::max(z[k], SmallNumber)) - lnK[k];
+        }
+        bool vaporUnstable = flashStability(P, z, d, FLUID_GAS, lnWv);
+        bool liquidUnstable = flashStability(P, z, d, FLUID_LIQUID_0, lnWl);
+        if (vaporUnstable || liquidUnstable) {
+            double sumV = 0.0, sumL = 0.0;
+            for (size_t k = 0; k < m_kk; k++) {
+                sumV += exp(lnWv[k]);
+                sumL += exp(lnWl[k]);
+            }
+            for (size_t k = 0; k < m_kk; k++) {
+                double lnz = log(std::max(z[k], SmallNumber));
+                double lnyV = vaporUnstable ? lnWv[k] - log(sumV) : lnz;
+                double lnxL = liquidUnstable ? lnWl[k] - log(sumL) : lnz;
+                lnK[k] = lnyV - lnxL;
+            }
+            beta = 0.5;
+            twoPhase = flashSplit(P, z, d, lnK, beta, x, y);
+        }
+    }
+
+    if (twoPhase) {
+        m_flashLnK = lnK;
+        flashLnPhi(P, x.data(), FLUID_LIQUID_0, lnphiZ.data());
+        double hL = enthalpy_mole();
+        flashLnPhi(P, y.data(), FLUID_GAS, lnphiV.data());
+        double hV = enthalpy_mole();
+        hmole = beta * hV + (1.0 - beta) * hL;
+    } else {
+        m_flashLnK.clear();
+        x = z;
+        y = z;
+    }
+
+    // Restore the feed, using the most stable root
+    setMoleFractions(z.data());
+    setDensity(rhoZ);
+    setTemperature(T);
+    if (!twoPhase) {
+        hmole = enthalpy_mole();
+        beta = (iState_ >= FLUID_LIQUID_0) ? 0.0 : 1.0;
+    }
+    if (xLiquid) {
+        copy(x.begin(), x.end(), xLiquid);
+    }
+    if (yVapor) {
+        copy(y.begin(), y.end(), yVapor);
+    }
+    return beta;
+}
+
+bool MixtureFugacityTP::flashStability(double P, const vector<double>& z,
+                                       const vector<double>& d, int branch,
+                                       vector<double>& lnW)
+{
+    vector<double> w(m_kk), lnphi(m_kk);
+    vector<double> g0(m_kk), g1(m_kk), g2(m_kk);
+    bool unstable = false;
+    for (int iter = 0; iter < 500; iter++) {
+        double sumW = 0.0;
+        for (size_t k = 0; k < m_kk; k++) {
+            w[k] = exp(lnW[k]);
+            sumW += w[k];
+        }
+        scale(w.begin(), w.end(), w.begin(), 1.0 / sumW);
+        flashLnPhi(P, w.data(), branch, lnphi.data());
+
+        // Modified tangent plane distance of the current trial phase, and its
+        // distance from the feed
+        double tm = 1.0;
+        double dist = 0.0;
+        for (size_t k = 0; k < m_kk; k++) {
+            tm += sumW * w[k] * (lnW[k] + lnphi[k] - d[k] - 1.0);
+            double dlnx = log(std::max(w[k], SmallNumber))
+                          - log(std::max(z[k], SmallNumber));
+            dist += dlnx * dlnx;
+        }
+        if (tm < -1e-8) {
+            unstable = true;
+        } else if (dist < 1e-8) {
+            // converging to the trivial solution
+            return false;
+        }
+
+        std::swap(g1, g2);
+        std::swap(g0, g1);
+        double dmax = 0.0;
+        for (size_t k = 0; k < m_kk; k++) {
+            double lnWnew = d[k] - lnphi[k];
+            g0[k] = lnWnew - lnW[k];
+            lnW[k] = lnWnew;
+            dmax = std::max(dmax, std::abs(g0[k]));
+        }
+        if (dmax < 1e-10 || (unstable && dmax < 1e-6)) {
+            // The result is only used as an initial estimate if the feed is unstable
+            break;
+        }
+        if (iter % 5 == 4) {
+            gdemStep(lnW, g0, g1, g2);
+        }
+    }
+    return unstable;
+}
+
+bool MixtureFugacityTP::flashSplit(double P, const vector<double>& z,
+                                   const vector<double>& d, vector<double>& lnK,
+                                   double& beta, vector<double>& x,
+                                   vector<double>& y)
+{
+    vector<double> K(m_kk), lnphiL(m_kk), lnphiV(m_kk);
+    vector<double> g0(m_kk), g1(m_kk), g2(m_kk);
+    bool converged = false;
+    for (int iter = 0; iter < 500; iter++) {
+        for (size_t k = 0; k < m_kk; k++) {
+            K[k] = exp(lnK[k]);
+        }
+        beta = rachfordRice(z, K, beta);
+        double sumX = 0.0, sumY = 0.0;
+        for (size_t k = 0; k < m_kk; k++) {
+            x[k] = z[k] / (1.0 + beta * (K[k] - 1.0));
+            y[k] = K[k] * x[k];
+            sumX += x[k];
+            sumY += y[k];
+        }
+        scale(x.begin(), x.end(), x.begin(), 1.0 / sumX);
+        scale(y.begin(), y.end(), y.begin(), 1.0 / sumY);
+        flashLnPhi(P, x.data(), FLUID_LIQUID_0, lnphiL.data());
+        flashLnPhi(P, y.data(), FLUID_GAS, lnphiV.data());
+
+        std::swap(g1, g2);
+        std::swap(g0, g1);
+        double dmax = 0.0, lnKmax = 0.0;
+        for (size_t k = 0; k < m_kk; k++) {
+            double lnKnew = lnphiL[k] - lnphiV[k];
+            g0[k] = lnKnew - lnK[k];
+            lnK[k] = lnKnew;
+            dmax = std::max(dmax, std::abs(g0[k]));
+            lnKmax = std::max(lnKmax, std::abs(lnKnew));
+        }
+        if (lnKmax < 1e-4) {
+            // converging to the trivial solution
+            return false;
+        }
+        if (dmax < 1e-10) {
+            converged = true;
+            break;
+        }
+        if (iter % 5 == 4) {
+            gdemStep(lnK, g0, g1, g2);
+        }
+    }
+    if (!converged || beta <= 0.0 || beta >= 1.0) {
+        return false;
+    }
+
+    // The split must lower the Gibbs free energy of the feed
+    double dG = 0.0;
+    for (size_t k = 0; k < m_kk; k++) {
+        if (x[k] > 0.0) {
+            dG += (1.0 - beta) * x[k] * (log(x[k]) + lnphiL[k] - d[k]);
+        }
+        if (y[k] > 0.0) {
+            dG += beta * y[k] * (log(y[k]) + lnphiV[k] - d[k]);
+        }
+    }
+    return dG < 0.0;
+}
+
 double MixtureFugacityTP::dpdVCalc(double TKelvin, double molarVol, double& presCalc) const
 {
     throw NotImplementedError("MixtureFugacityTP::dpdVCalc");
@@ -14,6 +14,7 @@
 #include "cantera/base/utilities.h"
 #include "cantera/base/ctexceptions.h"
 #include "cantera/base/global.h"
+#include "cantera/base/Profiler.h"
 
 namespace Cantera
 {
@@ -93,6 +94,7 @@ void MultiSpeciesThermo::update_single(size_t k, double t, double* cp_R,
 
 void MultiSpeciesThermo::update(double t, double* cp_R, double* h_RT, double* s_R) const
 {
+    CT_PROFILE_ZONE("MultiSpeciesThermo::update");
     auto iter = m_sp.begin();
     auto jter = m_tpoly.begin();
     for (; iter != m_sp.end(); iter++, jter++) {
@@ -242,9 +242,21 @@ double PDSS_Water::satPressure(double t)
     return pp;
 }
 
+void PDSS_Water::initThermo()
+{
+    PDSS_Molar::initThermo();
+    if (m_input.getBool("tabulated", false)) {
+        m_sub.setTabulated(true, m_input.getDouble("tabulation-tolerance", 1e-8));
+    }
+}
+
 void PDSS_Water::getParameters(AnyMap& eosNode) const
 {
     eosNode["model"] = "liquid-water-IAPWS95";
+    if (m_sub.tabulated()) {
+        eosNode["tabulated"] = true;
+        eosNode["tabulation-tolerance"] = m_sub.tabulationTolerance();
+    }
 }
 
 }
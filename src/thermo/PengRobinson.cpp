@@ -69,6 +69,8 @@ void PengRobinson::setSpeciesCoeffs(const string& species, double a, double b, d
         }
     }
     m_b_coeffs[k] = b;
+    m_alphaTemp = NAN;
+    resetFlash();
 }
 
 void PengRobinson::setBinaryCoeffs(const string& species_i,
@@ -91,6 +93,8 @@ void PengRobinson::setBinaryCoeffs(const string& species_i,
     // Calculate alpha_ij
     double alpha_ij = m_alpha[ki] * m_alpha[kj];
     m_aAlpha_binary(ki, kj) = m_aAlpha_binary(kj, ki) = a0*alpha_ij;
+    m_alphaTemp = NAN;
+    resetFlash();
 }
 
 // ------------Molar Thermodynamic Properties -------------------------
@@ -141,12 +145,6 @@ void PengRobinson::getActivityCoefficients(double* ac) const
     double vmb = mv - m_b;
     double pres = pressure();
 
-    for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            m_pp[k] += moleFractions_[i] * m_aAlpha_binary(k, i);
-        }
-    }
     double num = 0;
     double denom = 2 * Sqrt2 * m_b * m_b;
     double denom2 = m_b * (mv * mv + 2 * mv * m_b - m_b * m_b);
@@ -180,12 +178,6 @@ void PengRobinson::getChemPotentials(double* mu) const
     double vpb2 = mv + (1 + Sqrt2) * m_b;
     double vmb2 = mv + (1 - Sqrt2) * m_b;
 
-    for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            m_pp[k] += moleFractions_[i] * m_aAlpha_binary(k, i);
-        }
-    }
     double pres = pressure();
     double refP = refPressure();
     double denom = 2 * Sqrt2 * m_b * m_b;
@@ -206,8 +198,6 @@ void PengRobinson::getPartialMolarEnthalpies(double* hbar) const
     // First we get the reference state contributions
     getEnthalpy_RT_ref(hbar);
     scale(hbar, hbar+m_kk, hbar, RT());
-    vector<double> tmp;
-    tmp.resize(m_kk,0.0);
 
     // We calculate m_dpdni
     double T = temperature();
@@ -217,16 +207,6 @@ void PengRobinson::getPartialMolarEnthalpies(double* hbar) const
     double vmb2 = mv + (1 - Sqrt2) * m_b;
     double daAlphadT = daAlpha_dT();
 
-    for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        tmp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            double grad_aAlpha = m_dalphadT[i]/m_alpha[i] + m_dalphadT[k]/m_alpha[k];
-            m_pp[k] += moleFractions_[i] * m_aAlpha_binary(k, i);
-            tmp[k] +=moleFractions_[i] * m_aAlpha_binary(k, i) * grad_aAlpha;
-        }
-    }
-
     double denom = mv * mv + 2 * mv * m_b - m_b * m_b;
     double denom2 = denom * denom;
     double RT_ = RT();
@@ -241,7 +221,8 @@ void PengRobinson::getPartialMolarEnthalpies(double* hbar) const
     double fac3 = 2 * Sqrt2 * m_b * m_b;
     double fac4 = 0;
     for (size_t k = 0; k < m_kk; k++) {
-        fac4 = T*tmp[k] -2 * m_pp[k];
+        // T * sum_i(X_i * aAlpha_ki * (alpha_i'/alpha_i + alpha_k'/alpha_k)) - 2 * m_pp[k]
+        fac4 = T * (m_ppdT[k] + m_dalphadT[k] / m_alpha[k] * m_pp[k]) - 2 * m_pp[k];
         double hE_v = mv * m_dpdni[k] - RT_
                      - m_b_coeffs[k] / fac3 * log(vpb2 / vmb2) * fac
                      + (mv * m_b_coeffs[k]) / (m_b * denom) * fac
@@ -280,13 +261,6 @@ void PengRobinson::getPartialMolarCp(double* cpbar) const
 
 void PengRobinson::getPartialMolarVolumes(double* vbar) const
 {
-    for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            m_pp[k] += moleFractions_[i] * m_aAlpha_binary(k, i);
-        }
-    }
-
     double mv = molarVolume();
     double vmb = mv - m_b;
     double vpb = mv + m_b;
@@ -327,7 +301,9 @@ bool PengRobinson::addSpecies(shared_ptr<Species> spec)
         m_alpha.push_back(0.0);
         m_dalphadT.push_back(0.0);
         m_d2alphadT2.push_back(0.0);
+        m_sqrtAlpha.push_back(0.0);
         m_pp.push_back(0.0);
+        m_ppdT.push_back(0.0);
         m_partialMolarVolumes.push_back(0.0);
         m_dpdni.push_back(0.0);
         m_coeffSource.push_back(CoeffSource::EoS);
@@ -657,88 +633,73 @@ void PengRobinson::updateMixingExpressions()
 {
     double temp = temperature();
 
-    // Update individual alpha
-    for (size_t j = 0; j < m_kk; j++) {
-        double critTemp_j = speciesCritTemperature(m_a_coeffs(j,j), m_b_coeffs[j]);
-        double sqt_alpha = 1 + m_kappa[j] * (1 - sqrt(temp / critTemp_j));
-        m_alpha[j] = sqt_alpha*sqt_alpha;
-    }
-
-    // Update aAlpha_i, j
-    for (size_t i = 0; i < m_kk; i++) {
+    if (temp != m_alphaTemp) {
+        // Update individual alpha and its derivatives
         for (size_t j = 0; j < m_kk; j++) {
-            m_aAlpha_binary(i, j) = sqrt(m_alpha[i] * m_alpha[j]) * m_a_coeffs(i,j);
+            double Tc = speciesCritTemperature(m_a_coeffs(j,j), m_b_coeffs[j]);
+            double sqt_Tr = sqrt(temp / Tc);
+            double sqt_alpha = 1 + m_kappa[j] * (1 - sqt_Tr);
+            double coeff1 = 1 / (Tc*sqt_Tr);
+            double coeff2 = sqt_Tr - 1;
+            double k = m_kappa[j];
+            m_alpha[j] = sqt_alpha*sqt_alpha;
+            m_sqrtAlpha[j] = std::abs(sqt_alpha);
+            m_dalphadT[j] = coeff1 * (k*k*coeff2 - k);
+            m_d2alphadT2[j] = (k*k + k) * coeff1 / (2*sqt_Tr*sqt_Tr*Tc);
         }
-    }
-    calculateAB(m_a,m_b,m_aAlpha_mix);
-}
 
-void PengRobinson::calculateAB(double& aCalc, double& bCalc, double& aAlphaCalc) const
-{
-    bCalc = 0.0;
-    aCalc = 0.0;
-    aAlphaCalc = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        bCalc += moleFractions_[i] * m_b_coeffs[i];
+        // Update aAlpha_i, j
         for (size_t j = 0; j < m_kk; j++) {
-            aCalc += m_a_coeffs(i, j) * moleFractions_[i] * moleFractions_[j];
-            aAlphaCalc += m_aAlpha_binary(i, j) * moleFractions_[i] * moleFractions_[j];
+            const double* a_j = m_a_coeffs.ptrColumn(j);
+            double* aAlpha_j = m_aAlpha_binary.ptrColumn(j);
+            for (size_t i = 0; i < m_kk; i++) {
+                aAlpha_j[i] = m_sqrtAlpha[i] * m_sqrtAlpha[j] * a_j[i];
+            }
         }
+        m_alphaTemp = temp;
     }
-}
 
-double PengRobinson::daAlpha_dT() const
-{
-    double daAlphadT = 0.0, k, Tc, sqtTr, coeff1, coeff2;
-    for (size_t i = 0; i < m_kk; i++) {
-        // Calculate first derivative of alpha for individual species
-        Tc = speciesCritTemperature(m_a_coeffs(i,i), m_b_coeffs[i]);
-        sqtTr = sqrt(temperature() / Tc);
-        coeff1 = 1 / (Tc*sqtTr);
-        coeff2 = sqtTr - 1;
-        k = m_kappa[i];
-        m_dalphadT[i] = coeff1 * (k*k*coeff2 - k);
-    }
-    // Calculate mixture derivative
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j < m_kk; j++) {
-            daAlphadT += moleFractions_[i] * moleFractions_[j] * 0.5
-                         * m_aAlpha_binary(i, j)
-                         * (m_dalphadT[i] / m_alpha[i] + m_dalphadT[j] / m_alpha[j]);
+    // Partial sums over the (symmetric) coefficient matrices, accessed by columns
+    const double* X = moleFractions_.data();
+    m_a = 0.0;
+    m_b = 0.0;
+    for (size_t k = 0; k < m_kk; k++) {
+        const double* a_k = m_a_coeffs.ptrColumn(k);
+        const double* aAlpha_k = m_aAlpha_binary.ptrColumn(k);
+        double sum_a = 0.0, sum_aAlpha = 0.0, sum_daAlpha = 0.0;
+        for (size_t i = 0; i < m_kk; i++) {
+            double term = X[i] * aAlpha_k[i];
+            sum_a += X[i] * a_k[i];
+            sum_aAlpha += term;
+            sum_daAlpha += term * m_dalphadT[i] / m_alpha[i];
         }
+        m_pp[k] = sum_aAlpha;
+        m_ppdT[k] = sum_daAlpha;
+        m_a += X[k] * sum_a;
+        m_b += X[k] * m_b_coeffs[k];
+    }
+
+    // Mixture values of a*alpha and its derivatives. With g_i = alpha_i'/alpha_i and
+    // h_i = alpha_i''/alpha_i, the double sums over X_i X_j (a alpha)_ij reduce to:
+    //     d(a alpha)/dT = sum_k X_k sum_i(X_i (a alpha)_ki g_i)
+    //     d2(a alpha)/dT2 = sum_k X_k [(h_k - g_k^2 / 2) m_pp[k] + g_k m_ppdT[k] / 2]
+    m_aAlpha_mix = 0.0;
+    m_daAlpha_dT = 0.0;
+    m_d2aAlpha_dT2 = 0.0;
+    for (size_t k = 0; k < m_kk; k++) {
+        double g = m_dalphadT[k] / m_alpha[k];
+        double h = m_d2alphadT2[k] / m_alpha[k];
+        m_aAlpha_mix += X[k] * m_pp[k];
+        m_daAlpha_dT += X[k] * m_ppdT[k];
+        m_d2aAlpha_dT2 += X[k] * ((h - 0.5 * g * g) * m_pp[k] + 0.5 * g * m_ppdT[k]);
     }
-    return daAlphadT;
 }
 
-double PengRobinson::d2aAlpha_dT2() const
+void PengRobinson::calculateAB(double& aCalc, double& bCalc, double& aAlphaCalc) const
 {
-    for (size_t i = 0; i < m_kk; i++) {
-        double Tcrit_i = speciesCritTemperature(m_a_coeffs(i, i), m_b_coeffs[i]);
-        double sqt_Tr = sqrt(temperature() / Tcrit_i);
-        double coeff1 = 1 / (Tcrit_i*sqt_Tr);
-        double coeff2 = sqt_Tr - 1;
-        // Calculate first and second derivatives of alpha for individual species
-        double k = m_kappa[i];
-        m_dalphadT[i] = coeff1 * (k*k*coeff2 - k);
-        m_d2alphadT2[i] = (k*k + k) * coeff1 / (2*sqt_Tr*sqt_Tr*Tcrit_i);
-    }
-
-    // Calculate mixture derivative
-    double d2aAlphadT2 = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        double alphai = m_alpha[i];
-        for (size_t j = 0; j < m_kk; j++) {
-            double alphaj = m_alpha[j];
-            double alphaij = alphai * alphaj;
-            double term1 = m_d2alphadT2[i] / alphai + m_d2alphadT2[j] / alphaj;
-            double term2 = 2 * m_dalphadT[i] * m_dalphadT[j] / alphaij;
-            double term3 = m_dalphadT[i] / alphai + m_dalphadT[j] / alphaj;
-            d2aAlphadT2 += 0.5 * moleFractions_[i] * moleFractions_[j]
-                           * m_aAlpha_binary(i, j)
-                           * (term1 + term2 - 0.5 * term3 * term3);
-        }
-    }
-    return d2aAlphadT2;
+    aCalc = m_a;
+    bCalc = m_b;
+    aAlphaCalc = m_aAlpha_mix;
 }
 
 void PengRobinson::calcCriticalConditions(double& pc, double& tc, double& vc) const
@@ -760,6 +721,11 @@ void PengRobinson::calcCriticalConditions(double& pc, double& tc, double& vc) co
     vc = omega_vc * GasConstant * tc / pc;
 }
 
+int PengRobinson::volumeRoots(double P, double Vroot[3]) const
+{
+    return solveCubic(temperature(), P, m_a, m_b, m_aAlpha_mix, Vroot);
+}
+
 int PengRobinson::solveCubic(double T, double pres, double a, double b, double aAlpha,
                              double Vroot[3]) const
 {
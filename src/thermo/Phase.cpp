@@ -340,26 +340,30 @@ void Phase::setMoleFractionsByName(const string& x)
 
 void Phase::setMassFractions(const double* const y)
 {
+    double norm = 0.0;
     for (size_t k = 0; k < m_kk; k++) {
-        m_y[k] = std::max(y[k], 0.0); // Ignore negative mass fractions
+        norm += std::max(y[k], 0.0); // Ignore negative mass fractions
     }
-    double norm = accumulate(m_y.begin(), m_y.end(), 0.0);
-    scale(m_y.begin(), m_y.end(), m_y.begin(), 1.0/norm);
-
-    transform(m_y.begin(), m_y.end(), m_rmolwts.begin(),
-              m_ym.begin(), multiplies<double>());
-    m_mmw = 1.0 / accumulate(m_ym.begin(), m_ym.end(), 0.0);
+    double rnorm = 1.0 / norm;
+    double sum = 0.0;
+    for (size_t k = 0; k < m_kk; k++) {
+        m_y[k] = std::max(y[k], 0.0) * rnorm;
+        m_ym[k] = m_y[k] * m_rmolwts[k];
+        sum += m_ym[k];
+    }
+    m_mmw = 1.0 / sum;
     compositionChanged();
 }
 
 void Phase::setMassFractions_NoNorm(const double* const y)
 {
     double sum = 0.0;
-    copy(y, y + m_kk, m_y.begin());
-    transform(m_y.begin(), m_y.end(), m_rmolwts.begin(), m_ym.begin(),
-              multiplies<double>());
-    sum = accumulate(m_ym.begin(), m_ym.end(), 0.0);
-    m_mmw = 1.0/sum;
+    for (size_t k = 0; k < m_kk; k++) {
+        m_y[k] = y[k];
+        m_ym[k] = y[k] * m_rmolwts[k];
+        sum += m_ym[k];
+    }
+    m_mmw = 1.0 / sum;
     compositionChanged();
 }
 
@@ -380,6 +384,15 @@ void Phase::setState_TD(double t, double rho)
     setDensity(rho);
 }
 
+void Phase::setState_TDY_NoNorm(double t, double rho, const double* y)
+{
+    setMassFractions_NoNorm(y);
+    if (t != temperature()) {
+        setTemperature(t);
+    }
+    setDensity(rho);
+}
+
 double Phase::molecularWeight(size_t k) const
 {
     checkSpeciesIndex(k);
@@ -23,8 +23,12 @@ void PureFluidPhase::initThermo()
     if (m_input.hasKey("pure-fluid-name")) {
         setSubstance(m_input["pure-fluid-name"].asString());
     }
+    if (m_input.hasKey("tabulated")) {
+        m_tabulated = m_input["tabulated"].asBool();
+    }
 
     m_sub.reset(tpx::newSubstance(m_tpx_name));
+    m_table.reset();
 
     m_mw = m_sub->MolWt();
     setMolecularWeight(0,m_mw);
@@ -52,6 +56,9 @@ void PureFluidPhase::getParameters(AnyMap& phaseNode) const
 {
     ThermoPhase::getParameters(phaseNode);
     phaseNode["pure-fluid-name"] = m_sub->name();
+    if (m_tabulated) {
+        phaseNode["tabulated"] = true;
+    }
 }
 
 vector<string> PureFluidPhase::fullStates() const
@@ -90,49 +97,65 @@ double PureFluidPhase::maxTemp(size_t k) const
 
 double PureFluidPhase::enthalpy_mole() const
 {
-    return m_sub->h() * m_mw;
+    return prop(tpx::propertyFlag::H) * m_mw;
 }
 
 double PureFluidPhase::intEnergy_mole() const
 {
-    return m_sub->u() * m_mw;
+    return prop(tpx::propertyFlag::U) * m_mw;
 }
 
 double PureFluidPhase::entropy_mole() const
 {
-    return m_sub->s() * m_mw;
+    return prop(tpx::propertyFlag::S) * m_mw;
 }
 
 double PureFluidPhase::gibbs_mole() const
 {
+    if (propertyTable()) {
+        return (prop(tpx::propertyFlag::H) - m_sub->Temp() * prop(tpx::propertyFlag::S))
+               * m_mw;
+    }
     return m_sub->g() * m_mw;
 }
 
 double PureFluidPhase::cp_mole() const
 {
+    if (auto table = propertyTable()) {
+        double cp = table->cp(m_sub->Temp(), m_sub->rho());
+        if (!std::isnan(cp)) {
+            return cp * m_mw;
+        }
+    }
     return m_sub->cp() * m_mw;
 }
 
 double PureFluidPhase::cv_mole() const
 {
+    if (auto table = propertyTable()) {
+        double cv = table->cv(m_sub->Temp(), m_sub->rho());
+        if (!std::isnan(cv)) {
+            return cv * m_mw;
+        }
+    }
     return m_sub->cv() * m_mw;
 }
 
 double PureFluidPhase::pressure() const
 {
-    return m_sub->P();
+    return prop(tpx::propertyFlag::P);
 }
 
 void PureFluidPhase::setPressure(double p)
 {
     Set(tpx::PropertyPair::TP, temperature(), p);
-    ThermoPhase::setDensity(1.0/m_sub->v());
+    ThermoPhase::setDensity(m_sub->rho());
 }
 
 void PureFluidPhase::setTemperature(double T)
 {
     ThermoPhase::setTemperature(T);
-    Set(tpx::PropertyPair::TV, T, m_sub->v());
+    Set(tpx::PropertyPair::TV, T, 1.0 / m_sub->rho());
 }
 
 void PureFluidPhase::setDensity(double rho)
@@ -143,16 +166,53 @@ void PureFluidPhase::setDensity(double rho)
 
 void PureFluidPhase::Set(tpx::PropertyPair::type n, double x, double y) const
 {
-    m_sub->Set(n, x, y);
+    double T, rho;
+    auto table = propertyTable();
+    if (table && table->solve(n, x, y, T, rho)) {
+        m_sub->Set(tpx::PropertyPair::TV, T, 1.0 / rho);
+    } else {
+        m_sub->Set(n, x, y);
+    }
+}
+
+const tpx::PropertyTable* PureFluidPhase::propertyTable() const
+{
+    if (m_tabulated && !m_table && m_sub) {
+        m_table = make_unique<tpx::PropertyTable>(*m_sub, m_nTableT, m_nTableRho);
+    }
+    return m_table.get();
+}
+
+double PureFluidPhase::prop(tpx::propertyFlag::type ijob) const
+{
+    if (auto table = propertyTable()) {
+        double value = table->prop(ijob, m_sub->Temp(), m_sub->rho());
+        if (!std::isnan(value)) {
+            return value;
+        }
+    }
+    return m_sub->prop(ijob);
 }
 
 double PureFluidPhase::isothermalCompressibility() const
 {
+    if (auto table = propertyTable()) {
+        double kappa = table->isothermalCompressibility(m_sub->Temp(), m_sub->rho());
+        if (!std::isnan(kappa)) {
+            return kappa;
+        }
+    }
     return m_sub->isothermalCompressibility();
 }
 
 double PureFluidPhase::thermalExpansionCoeff() const
 {
+    if (auto table = propertyTable()) {
+        double beta = table->thermalExpansionCoeff(m_sub->Temp(), m_sub->rho());
+        if (!std::isnan(beta)) {
+            return beta;
+        }
+    }
     return m_sub->thermalExpansionCoeff();
 }
 
@@ -161,6 +221,14 @@ tpx::Substance& PureFluidPhase::TPX_Substance()
     return *m_sub;
 }
 
+void PureFluidPhase::setTabulated(bool tabulated, size_t nT, size_t nRho)
+{
+    m_tabulated = tabulated;
+    m_nTableT = nT;
+    m_nTableRho = nRho;
+    m_table.reset();
+}
+
 void PureFluidPhase::getPartialMolarEnthalpies(double* hbar) const
 {
     hbar[0] = enthalpy_mole();
@@ -284,6 +352,12 @@ double PureFluidPhase::critDensity() const
 
 double PureFluidPhase::satTemperature(double p) const
 {
+    if (auto table = propertyTable()) {
+        double Ts = table->Tsat(p);
+        if (!std::isnan(Ts)) {
+            return Ts;
+        }
+    }
     return m_sub->Tsat(p);
 }
 
@@ -295,77 +369,89 @@ double PureFluidPhase::satTemperature(double p) const
 void PureFluidPhase::setState_HP(double h, double p, double tol)
 {
     Set(tpx::PropertyPair::HP, h, p);
-    setState_TD(m_sub->Temp(), 1.0/m_sub->v());
+    setState_TD(m_sub->Temp(), m_sub->rho());
 }
 
 void PureFluidPhase::setState_UV(double u, double v, double tol)
 {
     Set(tpx::PropertyPair::UV, u, v);
-    setState_TD(m_sub->Temp(), 1.0/m_sub->v());
+    setState_TD(m_sub->Temp(), m_sub->rho());
 }
 
 void PureFluidPhase::setState_SV(double s, double v, double tol)
 {
     Set(tpx::PropertyPair::SV, s, v);
-    setState_TD(m_sub->Temp(), 1.0/m_sub->v());
+    setState_TD(m_sub->Temp(), m_sub->rho());
 }
 
 void PureFluidPhase::setState_SP(double s, double p, double tol)
 {
     Set(tpx::PropertyPair::SP, s, p);
-    setState_TD(m_sub->Temp(), 1.0/m_sub->v());
+    setState_TD(m_sub->Temp(), m_sub->rho());
 }
 
 void PureFluidPhase::setState_ST(double s, double t, double tol)
 {
     Set(tpx::PropertyPair::ST, s, t);
-    setState_TD(m_sub->Temp(), 1.0/m_sub->v());
+    setState_TD(m_sub->Temp(), m_sub->rho());
 }
 
 void PureFluidPhase::setState_TV(double t, double v, double tol)
 {
     Set(tpx::PropertyPair::TV, t, v);
-    setState_TD(m_sub->Temp(), 1.0/m_sub->v());
+    setState_TD(m_sub->Temp(), m_sub->rho());
 }
 
 void PureFluidPhase::setState_PV(double p, double v, double tol)
 {
     Set(tpx::PropertyPair::PV, p, v);
-    setState_TD(m_sub->Temp(), 1.0/m_sub->v());
+    setState_TD(m_sub->Temp(), m_sub->rho());
 }
 
 void PureFluidPhase::setState_UP(double u, double p, double tol)
 {
     Set(tpx::PropertyPair::UP, u, p);
-    setState_TD(m_sub->Temp(), 1.0/m_sub->v());
+    setState_TD(m_sub->Temp(), m_sub->rho());
 }
 
 void PureFluidPhase::setState_VH(double v, double h, double tol)
 {
     Set(tpx::PropertyPair::VH, v, h);
-    setState_TD(m_sub->Temp(), 1.0/m_sub->v());
+    setState_TD(m_sub->Temp(), m_sub->rho());
 }
 
 void PureFluidPhase::setState_TH(double t, double h, double tol)
 {
     Set(tpx::PropertyPair::TH, t, h);
-    setState_TD(m_sub->Temp(), 1.0/m_sub->v());
+    setState_TD(m_sub->Temp(), m_sub->rho());
 }
 
 void PureFluidPhase::setState_SH(double s, double h, double tol)
 {
     Set(tpx::PropertyPair::SH, s, h);
-    setState_TD(m_sub->Temp(), 1.0/m_sub->v());
+    setState_TD(m_sub->Temp(), m_sub->rho());
 }
 
 double PureFluidPhase::satPressure(double t)
 {
+    if (auto table = propertyTable()) {
+        double ps = table->Ps(t);
+        if (!std::isnan(ps)) {
+            return ps;
+        }
+    }
     Set(tpx::PropertyPair::TV, t, m_sub->v());
     return m_sub->Ps();
 }
 
 double PureFluidPhase::vaporFraction() const
 {
+    if (auto table = propertyTable()) {
+        double x = table->x(m_sub->Temp(), m_sub->rho());
+        if (!std::isnan(x)) {
+            return x;
+        }
+    }
     return m_sub->x();
 }
 
@@ -373,14 +459,14 @@ void PureFluidPhase::setState_Tsat(double t, double x)
 {
     Set(tpx::PropertyPair::TX, t, x);
     ThermoPhase::setTemperature(t);
-    ThermoPhase::setDensity(1.0/m_sub->v());
+    ThermoPhase::setDensity(m_sub->rho());
 }
 
 void PureFluidPhase::setState_Psat(double p, double x)
 {
     Set(tpx::PropertyPair::PX, p, x);
     ThermoPhase::setTemperature(m_sub->Temp());
-    ThermoPhase::setDensity(1.0/m_sub->v());
+    ThermoPhase::setDensity(m_sub->rho());
 }
 
 string PureFluidPhase::report(bool show_thermo, double threshold) const
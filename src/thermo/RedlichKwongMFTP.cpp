@@ -66,6 +66,8 @@ void RedlichKwongMFTP::setSpeciesCoeffs(const string& species,
     }
     a_coeff_vec.getRow(0, a_vec_Curr_.data());
     b_vec_Curr_[k] = b;
+    m_aTemp = NAN;
+    resetFlash();
 }
 
 void RedlichKwongMFTP::setBinaryCoeffs(const string& species_i, const string& species_j,
@@ -93,6 +95,8 @@ void RedlichKwongMFTP::setBinaryCoeffs(const string& species_i, const string& sp
     a_coeff_vec(0, counter1) = a_coeff_vec(0, counter2) = a0;
     a_coeff_vec(1, counter1) = a_coeff_vec(1, counter2) = a1;
     a_vec_Curr_[counter1] = a_vec_Curr_[counter2] = a0;
+    m_aTemp = NAN;
+    resetFlash();
 }
 
 // ------------Molar Thermodynamic Properties -------------------------
@@ -151,13 +155,6 @@ void RedlichKwongMFTP::getActivityCoefficients(double* ac) const
     double vpb = mv + m_b_current;
     double vmb = mv - m_b_current;
 
-    for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_pp[k] += moleFractions_[i] * a_vec_Curr_[counter];
-        }
-    }
     double pres = pressure();
 
     for (size_t k = 0; k < m_kk; k++) {
@@ -189,13 +186,6 @@ void RedlichKwongMFTP::getChemPotentials(double* mu) const
     double vpb = mv + m_b_current;
     double vmb = mv - m_b_current;
 
-    for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_pp[k] += moleFractions_[i] * a_vec_Curr_[counter];
-        }
-    }
     double pres = pressure();
     double refP = refPressure();
 
@@ -222,13 +212,6 @@ void RedlichKwongMFTP::getPartialMolarEnthalpies(double* hbar) const
     double sqt = sqrt(TKelvin);
     double vpb = mv + m_b_current;
     double vmb = mv - m_b_current;
-    for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_pp[k] += moleFractions_[i] * a_vec_Curr_[counter];
-        }
-    }
     for (size_t k = 0; k < m_kk; k++) {
         dpdni_[k] = RT()/vmb + RT() * b_vec_Curr_[k] / (vmb * vmb) - 2.0 * m_pp[k] / (sqt * mv * vpb)
                     + m_a_current * b_vec_Curr_[k]/(sqt * mv * vpb * vpb);
@@ -237,11 +220,7 @@ void RedlichKwongMFTP::getPartialMolarEnthalpies(double* hbar) const
     double fac = TKelvin * dadt - 3.0 * m_a_current / 2.0;
 
     for (size_t k = 0; k < m_kk; k++) {
-        m_tmpV[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_tmpV[k] += 2.0 * moleFractions_[i] * TKelvin * a_coeff_vec(1,counter) - 3.0 * moleFractions_[i] * a_vec_Curr_[counter];
-        }
+        m_tmpV[k] = 2.0 * TKelvin * m_dppdT[k] - 3.0 * m_pp[k];
     }
 
     pressureDerivatives();
@@ -268,20 +247,6 @@ void RedlichKwongMFTP::getPartialMolarEntropies(double* sbar) const
         double xx = std::max(SmallNumber, moleFraction(k));
         sbar[k] += GasConstant * (- log(xx));
     }
-    for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_pp[k] += moleFractions_[i] * a_vec_Curr_[counter];
-        }
-    }
-    for (size_t k = 0; k < m_kk; k++) {
-        m_tmpV[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_tmpV[k] += moleFractions_[i] * a_coeff_vec(1,counter);
-        }
-    }
 
     double dadt = da_dt();
     double fac = dadt - m_a_current / (2.0 * TKelvin);
@@ -293,7 +258,7 @@ void RedlichKwongMFTP::getPartialMolarEntropies(double* sbar) const
                    + GasConstant * log(mv/vmb)
                    + GasConstant * b_vec_Curr_[k]/vmb
                    + m_pp[k]/(m_b_current * TKelvin * sqt) * log(vpb/mv)
-                   - 2.0 * m_tmpV[k]/(m_b_current * sqt) * log(vpb/mv)
+                   - 2.0 * m_dppdT[k]/(m_b_current * sqt) * log(vpb/mv)
                    + b_vec_Curr_[k] / (m_b_current * m_b_current * sqt) * log(vpb/mv) * fac
                    - 1.0 / (m_b_current * sqt) * b_vec_Curr_[k] / vpb * fac
                   );
@@ -319,21 +284,6 @@ void RedlichKwongMFTP::getPartialMolarIntEnergies(double* ubar) const
 
 void RedlichKwongMFTP::getPartialMolarVolumes(double* vbar) const
 {
-    for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_pp[k] += moleFractions_[i] * a_vec_Curr_[counter];
-        }
-    }
-    for (size_t k = 0; k < m_kk; k++) {
-        m_tmpV[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_tmpV[k] += moleFractions_[i] * a_coeff_vec(1,counter);
-        }
-    }
-
     double sqt = sqrt(temperature());
     double mv = molarVolume();
     double vmb = mv - m_b_current;
@@ -362,6 +312,7 @@ bool RedlichKwongMFTP::addSpecies(shared_ptr<Species> spec)
         a_coeff_vec.resize(2, m_kk * m_kk, NAN);
 
         m_pp.push_back(0.0);
+        m_dppdT.push_back(0.0);
         m_coeffSource.push_back(CoeffSource::EoS);
         m_partialMolarVolumes.push_back(0.0);
         dpdni_.push_back(0.0);
@@ -728,23 +679,45 @@ void RedlichKwongMFTP::pressureDerivatives() const
 void RedlichKwongMFTP::updateMixingExpressions()
 {
     double temp = temperature();
-    if (m_formTempParam == 1) {
+    if (m_formTempParam == 1 && temp != m_aTemp) {
         for (size_t i = 0; i < m_kk; i++) {
             for (size_t j = 0; j < m_kk; j++) {
                 size_t counter = i * m_kk + j;
                 a_vec_Curr_[counter] = a_coeff_vec(0,counter) + a_coeff_vec(1,counter) * temp;
             }
         }
+        m_aTemp = temp;
     }
 
+    // Partial sums over the (symmetric) coefficient matrices, evaluated in a
+    // single pass with contiguous access to a_vec_Curr_
+    const double* X = moleFractions_.data();
     m_b_current = 0.0;
     m_a_current = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        m_b_current += moleFractions_[i] * b_vec_Curr_[i];
-        for (size_t j = 0; j < m_kk; j++) {
-            m_a_current += a_vec_Curr_[i * m_kk + j] * moleFractions_[i] * moleFractions_[j];
+    m_dadT = 0.0;
+    for (size_t k = 0; k < m_kk; k++) {
+        const double* a_k = a_vec_Curr_.data() + m_kk * k;
+        double sum_a = 0.0;
+        for (size_t i = 0; i < m_kk; i++) {
+            sum_a += X[i] * a_k[i];
+        }
+        m_pp[k] = sum_a;
+        m_a_current += X[k] * sum_a;
+        m_b_current += X[k] * b_vec_Curr_[k];
+    }
+    if (m_formTempParam == 1) {
+        for (size_t k = 0; k < m_kk; k++) {
+            double sum_da = 0.0;
+            for (size_t i = 0; i < m_kk; i++) {
+                sum_da += X[i] * a_coeff_vec(1, i + m_kk * k);
+            }
+            m_dppdT[k] = sum_da;
+            m_dadT += X[k] * sum_da;
         }
+    } else {
+        std::fill(m_dppdT.begin(), m_dppdT.end(), 0.0);
     }
+
     if (isnan(m_b_current)) {
         // One or more species do not have specified coefficients.
         fmt::memory_buffer b;
@@ -787,31 +760,12 @@ void RedlichKwongMFTP::calculateAB(double temp, double& aCalc, double& bCalc) co
     }
 }
 
-double RedlichKwongMFTP::da_dt() const
-{
-    double dadT = 0.0;
-    if (m_formTempParam == 1) {
-        for (size_t i = 0; i < m_kk; i++) {
-            for (size_t j = 0; j < m_kk; j++) {
-                size_t counter = i * m_kk + j;
-                dadT+= a_coeff_vec(1,counter) * moleFractions_[i] * moleFractions_[j];
-            }
-        }
-    }
-    return dadT;
-}
-
 void RedlichKwongMFTP::calcCriticalConditions(double& pc, double& tc, double& vc) const
 {
-    double a0 = 0.0;
-    double aT = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j <m_kk; j++) {
-            size_t counter = i + m_kk * j;
-            a0 += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(0, counter);
-            aT += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(1, counter);
-        }
-    }
+    // Temperature-independent and temperature-proportional parts of the mixture
+    // a parameter, from the values computed by updateMixingExpressions()
+    double aT = m_dadT;
+    double a0 = m_a_current - aT * temperature();
     double a = m_a_current;
     double b = m_b_current;
     if (m_formTempParam != 0) {
@@ -854,6 +808,11 @@ void RedlichKwongMFTP::calcCriticalConditions(double& pc, double& tc, double& vc
     vc = omega_vc * GasConstant * tc / pc;
 }
 
+int RedlichKwongMFTP::volumeRoots(double P, double Vroot[3]) const
+{
+    return solveCubic(temperature(), P, m_a_current, m_b_current, Vroot);
+}
+
 int RedlichKwongMFTP::solveCubic(double T, double pres, double a, double b, double Vroot[3]) const
 {
 
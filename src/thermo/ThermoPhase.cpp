@@ -118,6 +118,15 @@ void ThermoPhase::setState_TPY(double t, double p, const string& y)
     setState_TP(t,p);
 }
 
+void ThermoPhase::setState_TPY_NoNorm(double t, double p, const double* y)
+{
+    setMassFractions_NoNorm(y);
+    if (t != temperature()) {
+        setTemperature(t);
+    }
+    setPressure(p);
+}
+
 void ThermoPhase::setState_TP(double t, double p)
 {
     double tsave = temperature();
@@ -1166,16 +1175,20 @@ void ThermoPhase::invalidateCache() {
 
 void ThermoPhase::equilibrate(const string& XY, const string& solver,
                               double rtol, int max_steps, int max_iter,
-                              int estimate_equil, int log_level)
+                              int estimate_equil, int log_level, bool warm_start)
 {
     if (solver == "auto" || solver == "element_potential") {
         vector<double> initial_state;
         saveState(initial_state);
         debuglog("Trying ChemEquil solver\n", log_level);
         try {
-            ChemEquil E;
+            if (!m_chemEquil) {
+                m_chemEquil = make_shared<ChemEquil>();
+            }
+            ChemEquil& E = *m_chemEquil;
             E.options.maxIterations = max_steps;
             E.options.relTolerance = rtol;
+            E.options.contin = warm_start;
             int ret = E.equilibrate(*this, XY.c_str(), log_level-1);
             if (ret < 0) {
                 throw CanteraError("ThermoPhase::equilibrate",
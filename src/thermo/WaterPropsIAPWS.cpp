@@ -26,6 +26,232 @@ const double Rho_c = 322.;
 
 static const double R_water = 461.51805; // J/kg/K (Eq. 6.3)
 
+namespace {
+
+// Cubic Hermite basis functions for the values (h) and derivatives (g) at
+// t = 0 and t = 1
+inline void hermite(double t, double* h, double* g)
+{
+    double t2 = t * t;
+    double t3 = t2 * t;
+    h[0] = 2 * t3 - 3 * t2 + 1;
+    h[1] = -2 * t3 + 3 * t2;
+    g[0] = t3 - 2 * t2 + t;
+    g[1] = t3 - t2;
+}
+
+}
+
+//! Tables of the properties of water used in tabulated mode. See
+//! WaterPropsIAPWS::setTabulated().
+class WaterPropsIAPWS::Table
+{
+public:
+    Table();
+
+    //! Estimate the density [kg/m^3] of the liquid or supercritical fluid at
+    //! temperature *T* and pressure *P*. Returns `false` if the state is not
+    //! covered by the table.
+    bool density(double T, double P, double& rho) const;
+
+    //! Estimate the saturation pressure and the densities of the saturated liquid
+    //! and vapor at temperature *T*. Returns `false` if *T* is not covered by the
+    //! table.
+    bool saturation(double T, double& P, double& rhoLiq, double& rhoGas) const;
+
+private:
+    //! Number of temperatures and pressures of the single-phase table
+    static const size_t nT = 205, nP = 97;
+
+    //! Number of intervals of the saturation table
+    static const size_t nSat = 400;
+
+    const double m_T0 = 253.15; //!< Lowest temperature [K]
+    const double m_dT = 5.0; //!< Temperature spacing [K]
+    const double m_x0 = log(1e3); //!< Lowest value of ln(P)
+    const double m_dx = log(1e6) / (nP - 1); //!< Spacing of ln(P)
+
+    //! For each node, ln(rho) and its derivatives with respect to T and ln(P) and
+    //! the mixed derivative, or NaN if there is no liquid or supercritical state.
+    vector<double> m_data;
+
+    //! Spacing of the variable z = sqrt(1 - T/T_c) of the saturation table
+    double m_dz;
+
+    //! Index of the first valid node (closest to the critical point) of the
+    //! saturation table
+    size_t m_satStart;
+
+    //! For each saturation node, the values of ln(P), ln(rho) of the liquid and
+    //! ln(rho) of the vapor, each followed by its derivative with respect to z
+    vector<double> m_sat;
+};
+
+WaterPropsIAPWS::Table::Table()
+{
+    WaterPropsIAPWS w;
+
+    // Single-phase table. Each isotherm is traced from the highest pressure
+    // downward, using the density at the previous node as the initial guess. Below
+    // the critical temperature, this follows the (possibly metastable) liquid branch
+    // until it ends at the spinodal.
+    m_data.assign(4 * nT * nP, NAN);
+    for (size_t i = 0; i < nT; i++) {
+        double T = m_T0 + i * m_dT;
+        double rho = -1.0;
+        for (size_t j = nP; j-- > 0;) {
+            double P = exp(m_x0 + j * m_dx);
+            bool ok = false;
+            if (rho > 0.0) {
+                double delta = w.m_phi.dnewton(P / (R_water * T * Rho_c), T_c / T,
+                                               rho / Rho_c, 1e-12, 20);
+                rho = delta * Rho_c;
+                ok = delta > 0.0;
+            }
+            if (!ok && (T > T_c || j == nP - 1)) {
+                rho = w.density(T, P, WATER_LIQUID);
+                ok = rho > 0.0;
+            }
+            if (!ok || (T < T_c && rho < Rho_c)) {
+                break;
+            }
+            w.setState_TD(T, rho);
+            double kappa = w.isothermalCompressibility();
+            double* d = &m_data[4 * (i * nP + j)];
+            d[0] = log(rho);
+            d[1] = -kappa * rho * R_water * w.coeffPresExp();
+            d[2] = P * kappa;
+        }
+    }
+    // Mixed derivatives from finite differences of d(ln rho)/d(ln P)
+    auto node = [this](size_t i, size_t j) { return &m_data[4 * (i * nP + j)]; };
+    for (size_t i = 0; i < nT; i++) {
+        for (size_t j = 0; j < nP; j++) {
+            if (std::isnan(node(i, j)[0])) {
+                continue;
+            }
+            size_t lo = (i > 0 && !std::isnan(node(i - 1, j)[0])) ? i - 1 : i;
+            size_t hi = (i < nT - 1 && !std::isnan(node(i + 1, j)[0])) ? i + 1 : i;
+            node(i, j)[3] = (hi == lo) ? 0.0 :
+                (node(hi, j)[2] - node(lo, j)[2]) / ((hi - lo) * m_dT);
+        }
+    }
+
+    // Saturation table, constructed starting from the lowest temperature. The
+    // table ends where the iterative solution fails close to the critical point.
+    m_dz = sqrt(1.0 - m_T0 / T_c) / nSat;
+    m_sat.assign(6 * (nSat + 1), NAN);
+    m_satStart = nSat + 1;
+    for (size_t k = nSat; k > 0; k--) {
+        double z = k * m_dz;
+        double T = (k == nSat) ? m_T0 : T_c * (1.0 - z * z);
+        double P, rhoL, sL, aL, kL, rhoV, sV, aV, kV;
+        try {
+            P = w.psat(T, WATER_LIQUID);
+            rhoL = w.density();
+            sL = w.entropy_mass();
+            aL = w.coeffThermExp();
+            kL = w.isothermalCompressibility();
+            rhoV = w.density(T, P, WATER_GAS);
+            sV = w.entropy_mass();
+            aV = w.coeffThermExp();
+            kV = w.isothermalCompressibility();
+        } catch (CanteraError&) {
+            break;
+        }
+        if (!(rhoV > 0.0 && rhoL > 1.01 * rhoV && sV > sL)) {
+            break;
+        }
+        // Clausius-Clapeyron equation
+        double dPdT = (sV - sL) / (1.0 / rhoV - 1.0 / rhoL);
+        double dTdz = -2.0 * T_c * z;
+        double* d = &m_sat[6 * k];
+        d[0] = log(P);
+        d[1] = dPdT / P * dTdz;
+        d[2] = log(rhoL);
+        d[3] = (kL * dPdT - aL) * dTdz;
+        d[4] = log(rhoV);
+        d[5] = (kV * dPdT - aV) * dTdz;
+        m_satStart = k;
+    }
+}
+
+bool WaterPropsIAPWS::Table::density(double T, double P, double& rho) const
+{
+    // Allow for round-off at the boundaries of the table
+    const double eps = 1e-10;
+    double a = (T - m_T0) / m_dT;
+    double b = (log(P) - m_x0) / m_dx;
+    if (!(a >= -eps && a <= nT - 1 + eps && b >= -eps && b <= nP - 1 + eps)) {
+        return false;
+    }
+    a = std::clamp(a, 0.0, nT - 1.0);
+    b = std::clamp(b, 0.0, nP - 1.0);
+    size_t i = std::min(static_cast<size_t>(a), nT - 2);
+    size_t j = std::min(static_cast<size_t>(b), nP - 2);
+    double ha[2], ga[2], hb[2], gb[2];
+    hermite(a - i, ha, ga);
+    hermite(b - j, hb, gb);
+    double f = 0.0;
+    for (size_t ci = 0; ci < 2; ci++) {
+        for (size_t cj = 0; cj < 2; cj++) {
+            const double* d = &m_data[4 * ((i + ci) * nP + j + cj)];
+            f += d[0] * ha[ci] * hb[cj] + d[1] * m_dT * ga[ci] * hb[cj]
+                 + d[2] * m_dx * ha[ci] * gb[cj] + d[3] * m_dT * m_dx * ga[ci] * gb[cj];
+        }
+    }
+    if (std::isnan(f)) {
+        return false;
+    }
+    rho = exp(f);
+    return true;
+}
+
+bool WaterPropsIAPWS::Table::saturation(double T, double& P, double& rhoLiq,
+                                        double& rhoGas) const
+{
+    if (!(T >= m_T0 - 1e-10 && T < T_c)) {
+        return false;
+    }
+    double s = std::min(sqrt(1.0 - T / T_c) / m_dz, double(nSat));
+    size_t k = std::min(static_cast<size_t>(s), nSat - 1);
+    if (k < m_satStart) {
+        return false;
+    }
+    double h[2], g[2];
+    hermite(s - k, h, g);
+    double f[3] = {0.0, 0.0, 0.0};
+    for (size_t c = 0; c < 2; c++) {
+        const double* d = &m_sat[6 * (k + c)];
+        for (size_t n = 0; n < 3; n++) {
+            f[n] += d[2 * n] * h[c] + d[2 * n + 1] * m_dz * g[c];
+        }
+    }
+    P = exp(f[0]);
+    rhoLiq = exp(f[1]);
+    rhoGas = exp(f[2]);
+    return true;
+}
+
+const WaterPropsIAPWS::Table& WaterPropsIAPWS::table()
+{
+    static const Table tab;
+    return tab;
+}
+
+void WaterPropsIAPWS::setTabulated(bool tabulated, double rtol)
+{
+    if (!(rtol > 0.0)) {
+        throw CanteraError("WaterPropsIAPWS::setTabulated",
+                           "Tolerance must be positive; got {}", rtol);
+    }
+    m_tabulated = tabulated;
+    m_rtol = rtol;
+    if (tabulated) {
+        table();
+    }
+}
+
 void WaterPropsIAPWS::calcDim(double temperature, double rho)
 {
     tau = T_c / temperature;
@@ -60,6 +286,17 @@ double WaterPropsIAPWS::density(double temperature, double pressure,
         setState_TD(temperature, Rho_c);
         return Rho_c;
     }
+    if (m_tabulated && (temperature > T_c || phase == WATER_LIQUID)) {
+        double rho;
+        if (table().density(temperature, pressure, rho)) {
+            double d = m_phi.dnewton(pressure / (R_water * temperature * Rho_c),
+                                     T_c / temperature, rho / Rho_c, m_rtol);
+            if (d > 0.0) {
+                setState_TD(temperature, d * Rho_c);
+                return d * Rho_c;
+            }
+        }
+    }
     double deltaGuess = 0.0;
     if (rhoguess == -1.0) {
         if (phase != -1) {
@@ -298,6 +535,19 @@ double WaterPropsIAPWS::psat(double temperature, int waterState)
         setState_TD(temperature, densGas);
         return P_c;
     }
+    if (m_tabulated && (waterState == WATER_LIQUID || waterState == WATER_GAS)) {
+        double p;
+        if (table().saturation(temperature, p, densLiq, densGas)) {
+            double rho = (waterState == WATER_LIQUID) ? densLiq : densGas;
+            double d = m_phi.dnewton(p / (R_water * temperature * Rho_c),
+                                     T_c / temperature, rho / Rho_c, m_rtol);
+            if (d > 0.0) {
+                setState_TD(temperature, d * Rho_c);
+                return p;
+            }
+            densLiq = densGas = -1.0;
+        }
+    }
     double p = psat_est(temperature);
     for (int i = 0; i < 30; i++) {
         if (method == 1) {
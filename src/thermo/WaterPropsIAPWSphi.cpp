@@ -936,6 +936,29 @@ double WaterPropsIAPWSphi::dfind(double p_red, double tau, double deltaGuess)
     return dd;
 }
 
+double WaterPropsIAPWSphi::dnewton(double p_red, double tau, double deltaGuess,
+                                   double rtol, int maxiter)
+{
+    double dd = deltaGuess;
+    for (int n = 0; n < maxiter; n++) {
+        tdpolycalc(tau, dd);
+        double q1 = phiR_d();
+        double pred0 = dd + dd * dd * q1;
+        double dpddelta = 1.0 + 2.0 * dd * q1 + dd * dd * phiR_dd();
+        if (dpddelta <= 0.0) {
+            return 0.0;
+        }
+        double deldd = (p_red - pred0) / dpddelta;
+        dd += deldd;
+        if (dd <= 0.0) {
+            return 0.0;
+        } else if (fabs(deldd) < rtol * dd) {
+            return dd;
+        }
+    }
+    return 0.0;
+}
+
 double WaterPropsIAPWSphi::gibbs_RT() const
 {
     double delta = DELTAsave;
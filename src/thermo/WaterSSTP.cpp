@@ -80,11 +80,23 @@ void WaterSSTP::initThermo()
     setDensity(rho0);
 
     m_waterProps = make_unique<WaterProps>(&m_sub);
+    if (m_input.getBool("tabulated", false)) {
+        m_sub.setTabulated(true, m_input.getDouble("tabulation-tolerance", 1e-8));
+    }
 
     // Set the flag to say we are ready to calculate stuff
     m_ready = true;
 }
 
+void WaterSSTP::getParameters(AnyMap& phaseNode) const
+{
+    SingleSpeciesTP::getParameters(phaseNode);
+    if (m_sub.tabulated()) {
+        phaseNode["tabulated"] = true;
+        phaseNode["tabulation-tolerance"] = m_sub.tabulationTolerance();
+    }
+}
+
 void WaterSSTP::getEnthalpy_RT(double* hrt) const
 {
     *hrt = (m_sub.enthalpy_mass() * m_mw + EW_Offset) / RT();
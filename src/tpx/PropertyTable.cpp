@@ -0,0 +1,706 @@
+//! @file PropertyTable.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/tpx/PropertyTable.h"
+#include "cantera/base/global.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace Cantera;
+
+namespace {
+
+const double NaN = std::numeric_limits<double>::quiet_NaN();
+
+// Cubic Hermite basis functions for the values at t = 0 and t = 1 (h0, h1) and
+// the derivatives at t = 0 and t = 1 (g0, g1), and their derivatives
+inline void hermite(double t, double* h, double* g, double* dh, double* dg)
+{
+    double t2 = t * t;
+    double t3 = t2 * t;
+    h[0] = 2 * t3 - 3 * t2 + 1;
+    h[1] = 3 * t2 - 2 * t3;
+    g[0] = t3 - 2 * t2 + t;
+    g[1] = t3 - t2;
+    dh[0] = 6 * t2 - 6 * t;
+    dh[1] = -dh[0];
+    dg[0] = 3 * t2 - 4 * t + 1;
+    dg[1] = 3 * t2 - 2 * t;
+}
+
+// Find a root of f in the interval [a, b] using the Illinois variant of the
+// regula falsi method, given the values fa and fb of f at the end points. Returns
+// NaN if the root is not bracketed or cannot be found.
+template <class F>
+double findRoot(F f, double a, double b, double fa, double fb, double xtol)
+{
+    if (!(fa * fb <= 0.0)) {
+        return NaN;
+    } else if (fa == 0.0) {
+        return a;
+    } else if (fb == 0.0) {
+        return b;
+    }
+    int side = 0;
+    for (int n = 0; n < 100; n++) {
+        double c = (a * fb - b * fa) / (fb - fa);
+        double fc = f(c);
+        if (std::isnan(fc)) {
+            return NaN;
+        } else if (fc * fb > 0.0) {
+            b = c;
+            fb = fc;
+            if (side == -1) {
+                fa *= 0.5;
+            }
+            side = -1;
+        } else if (fa * fc > 0.0) {
+            a = c;
+            fa = fc;
+            if (side == 1) {
+                fb *= 0.5;
+            }
+            side = 1;
+        } else {
+            return c;
+        }
+        if (std::abs(b - a) < xtol) {
+            return c;
+        }
+    }
+    return NaN;
+}
+
+}
+
+namespace tpx
+{
+
+PropertyTable::PropertyTable(Substance& sub, double Tlow, double Thigh,
+                             double rhoLow, double rhoHigh, size_t nT, size_t nRho)
+{
+    build(sub, Tlow, Thigh, rhoLow, rhoHigh, nT, nRho);
+}
+
+PropertyTable::PropertyTable(Substance& sub, size_t nT, size_t nRho)
+{
+    double Tsave = sub.Temp();
+    double rhoSave = sub.rho();
+    double rhoLow = 1e-5 / sub.Vcrit();
+    double rhoHigh = 2.0 / sub.Vcrit();
+    double T = lowestSaturationTemp(sub, sub.Tmin());
+    if (T < sub.Tcrit()) {
+        double g[nSatProps];
+        evalSaturation(sub, T, g);
+        rhoLow = std::min(rhoLow, 0.5 * exp(g[iLogRhoV]));
+        rhoHigh = 1.1 * exp(g[iLogRhoF]);
+    }
+    if (Tsave != Undef && rhoSave != Undef) {
+        sub.Set(PropertyPair::TV, Tsave, 1.0 / rhoSave);
+    }
+    build(sub, sub.Tmin(), sub.Tmax(), rhoLow, rhoHigh, nT, nRho);
+}
+
+void PropertyTable::build(Substance& sub, double Tlow, double Thigh, double rhoLow,
+                          double rhoHigh, size_t nT, size_t nRho)
+{
+    if (nT < 2 || nRho < 2) {
+        throw CanteraError("PropertyTable::build",
+                           "At least two grid points are required in each direction.");
+    } else if (Tlow < sub.Tmin() || Thigh > sub.Tmax() || Tlow >= Thigh) {
+        throw CanteraError("PropertyTable::build", "Invalid temperature range "
+            "[{}, {}] for substance '{}'.", Tlow, Thigh, sub.name());
+    } else if (rhoLow <= 0.0 || rhoLow >= rhoHigh) {
+        throw CanteraError("PropertyTable::build",
+                           "Invalid density range [{}, {}].", rhoLow, rhoHigh);
+    }
+    double Tsave = sub.Temp();
+    double rhoSave = sub.rho();
+
+    m_nT = nT;
+    m_nRho = nRho;
+    m_y0 = log(Tlow);
+    m_dy = (log(Thigh) - m_y0) / (nT - 1);
+    m_x0 = log(rhoLow);
+    m_dx = (log(rhoHigh) - m_x0) / (nRho - 1);
+    m_Tc = sub.Tcrit();
+    m_Pc = sub.Pcrit();
+    m_rhoc = 1.0 / sub.Vcrit();
+
+    // Single-phase properties and their derivatives, evaluated using central
+    // differences (one-sided at the limits of the equation of state)
+    m_data.assign(nT * nRho * nProps * 4, NaN);
+    double hx = 1e-3 * m_dx;
+    double f0[nProps], fTp[nProps], fTm[nProps], fxp[nProps], fxm[nProps];
+    double fpp[nProps], fpm[nProps], fmp[nProps], fmm[nProps];
+    for (size_t i = 0; i < nT; i++) {
+        // avoid round-off outside the range of the equation of state
+        double T = std::clamp(exp(m_y0 + i * m_dy), Tlow, Thigh);
+        double Tm = std::max(T * exp(-1e-3 * m_dy), sub.Tmin());
+        double Tp = std::min(T * exp(1e-3 * m_dy), sub.Tmax());
+        double dy = log(Tp / Tm);
+        for (size_t j = 0; j < nRho; j++) {
+            double lr = m_x0 + j * m_dx;
+            try {
+                evalSubstance(sub, T, lr, f0);
+                evalSubstance(sub, Tp, lr, fTp);
+                evalSubstance(sub, Tm, lr, fTm);
+                evalSubstance(sub, T, lr + hx, fxp);
+                evalSubstance(sub, T, lr - hx, fxm);
+                evalSubstance(sub, Tp, lr + hx, fpp);
+                evalSubstance(sub, Tp, lr - hx, fpm);
+                evalSubstance(sub, Tm, lr + hx, fmp);
+                evalSubstance(sub, Tm, lr - hx, fmm);
+            } catch (CanteraError&) {
+                continue;
+            }
+            double* d = &m_data[(i * nRho + j) * nProps * 4];
+            for (size_t k = 0; k < nProps; k++) {
+                d[4*k] = f0[k];
+                d[4*k+1] = (fTp[k] - fTm[k]) / dy;
+                d[4*k+2] = (fxp[k] - fxm[k]) / (2 * hx);
+                d[4*k+3] = (fpp[k] - fpm[k] - fmp[k] + fmm[k]) / (dy * 2 * hx);
+            }
+        }
+    }
+
+    // Saturation properties, tabulated from a temperature close to the critical
+    // point down to the lowest temperature. If the saturation state cannot be
+    // evaluated, the highest temperature is lowered (for failures at the first
+    // node) or the table is truncated at the last successful node.
+    m_nSat = 0;
+    m_sat.clear();
+    m_Ttop = m_Tc;
+    m_Tmin = lowestSaturationTemp(sub, Tlow);
+    double zmax = sqrt(std::max(1.0 - m_Tmin / m_Tc, 0.0));
+    vector<double> g0(nSatProps), gp(nSatProps), gm(nSatProps);
+    auto evalNode = [&](size_t k) {
+        double hz = 1e-3 * m_dz;
+        double z = m_z0 + k * m_dz;
+        double zp = std::min(z + hz, zmax);
+        double zm = std::max(z - hz, m_z0);
+        try {
+            // avoid round-off below the lowest temperature
+            evalSaturation(sub, std::max(m_Tc * (1 - z * z), m_Tmin), g0.data());
+            evalSaturation(sub, std::max(m_Tc * (1 - zp * zp), m_Tmin), gp.data());
+            evalSaturation(sub, std::max(m_Tc * (1 - zm * zm), m_Tmin), gm.data());
+        } catch (CanteraError&) {
+            return false;
+        }
+        for (size_t n = 0; n < nSatProps; n++) {
+            m_sat[(k * nSatProps + n) * 2] = g0[n];
+            m_sat[(k * nSatProps + n) * 2 + 1] = (gp[n] - gm[n]) / (zp - zm);
+        }
+        return true;
+    };
+    for (double zmin = 0.01; zmin < 0.5 * zmax; zmin *= 2) {
+        m_z0 = zmin;
+        m_dz = (zmax - zmin) / (nT - 1);
+        m_sat.assign(nT * nSatProps * 2, NaN);
+        if (evalNode(0)) {
+            m_Ttop = m_Tc * (1.0 - zmin * zmin);
+            m_nSat = 1;
+            break;
+        }
+    }
+    while (m_nSat > 0 && m_nSat < nT && evalNode(m_nSat)) {
+        m_nSat++;
+    }
+    if (m_nSat < 2) {
+        m_nSat = 0;
+        m_sat.clear();
+    } else if (m_nSat < nT) {
+        double z = m_z0 + (m_nSat - 1) * m_dz;
+        m_Tmin = m_Tc * (1 - z * z);
+        m_sat.resize(m_nSat * nSatProps * 2);
+    }
+
+    if (Tsave != Undef && rhoSave != Undef) {
+        sub.Set(PropertyPair::TV, Tsave, 1.0 / rhoSave);
+    }
+}
+
+double PropertyTable::lowestSaturationTemp(Substance& sub, double T)
+{
+    // The saturation state may not converge at the lowest temperatures
+    // supported by the equation of state
+    double g[nSatProps];
+    for (int n = 0; n < 50 && T < sub.Tcrit(); n++) {
+        try {
+            evalSaturation(sub, T, g);
+            return T;
+        } catch (CanteraError&) {
+            T += 0.01 * (sub.Tcrit() - T);
+        }
+    }
+    return std::max(T, sub.Tcrit());
+}
+
+void PropertyTable::evalSubstance(Substance& sub, double T, double lr, double* f)
+{
+    double rho = exp(lr);
+    sub.Set(PropertyPair::TV, T, 1.0 / rho);
+    double P = sub.Pp();
+    double h = sub.hp();
+    f[iP] = P;
+    f[iU] = h - P / rho;
+    f[iS] = (h - sub.gp()) / T;
+}
+
+void PropertyTable::evalSaturation(Substance& sub, double T, double* g)
+{
+    sub.Set(PropertyPair::TX, T, 0.0);
+    g[iLogP] = log(sub.P());
+    g[iLogRhoF] = log(sub.rho());
+    g[iUF] = sub.u();
+    g[iSF] = sub.s();
+    sub.Set(PropertyPair::TX, T, 1.0);
+    g[iLogRhoV] = log(sub.rho());
+    g[iUV] = sub.u();
+    g[iSV] = sub.s();
+}
+
+bool PropertyTable::interpolate(size_t k, double T, double lr, double* out) const
+{
+    // Allow for round-off at the boundaries of the table
+    const double eps = 1e-10;
+    double a = (log(T) - m_y0) / m_dy;
+    double b = (lr - m_x0) / m_dx;
+    if (!(a >= -eps && a <= m_nT - 1 + eps && b >= -eps && b <= m_nRho - 1 + eps)) {
+        return false;
+    }
+    a = std::clamp(a, 0.0, m_nT - 1.0);
+    b = std::clamp(b, 0.0, m_nRho - 1.0);
+    size_t i = std::min(static_cast<size_t>(a), m_nT - 2);
+    size_t j = std::min(static_cast<size_t>(b), m_nRho - 2);
+    double ha[2], ga[2], dha[2], dga[2], hb[2], gb[2], dhb[2], dgb[2];
+    hermite(a - i, ha, ga, dha, dga);
+    hermite(b - j, hb, gb, dhb, dgb);
+    double f = 0.0, fa = 0.0, fb = 0.0;
+    for (size_t ci = 0; ci < 2; ci++) {
+        for (size_t cj = 0; cj < 2; cj++) {
+            const double* d = &m_data[((i + ci) * m_nRho + j + cj) * nProps * 4 + 4 * k];
+            double dT = d[1] * m_dy;
+            double dx = d[2] * m_dx;
+            double dTx = d[3] * m_dy * m_dx;
+            f += d[0] * ha[ci] * hb[cj] + dT * ga[ci] * hb[cj]
+                 + dx * ha[ci] * gb[cj] + dTx * ga[ci] * gb[cj];
+            fa += d[0] * dha[ci] * hb[cj] + dT * dga[ci] * hb[cj]
+                  + dx * dha[ci] * gb[cj] + dTx * dga[ci] * gb[cj];
+            fb += d[0] * ha[ci] * dhb[cj] + dT * ga[ci] * dhb[cj]
+                  + dx * ha[ci] * dgb[cj] + dTx * ga[ci] * dgb[cj];
+        }
+    }
+    out[0] = f;
+    out[1] = fa / (m_dy * T);
+    out[2] = fb / m_dx;
+    return !std::isnan(f);
+}
+
+double PropertyTable::singleProp(propertyFlag::type ijob, double T, double lr) const
+{
+    double f[3], p[3];
+    switch (ijob) {
+    case propertyFlag::P:
+        return interpolate(iP, T, lr, f) ? f[0] : NaN;
+    case propertyFlag::U:
+        return interpolate(iU, T, lr, f) ? f[0] : NaN;
+    case propertyFlag::S:
+        return interpolate(iS, T, lr, f) ? f[0] : NaN;
+    case propertyFlag::H:
+        if (interpolate(iU, T, lr, f) && interpolate(iP, T, lr, p)) {
+            return f[0] + p[0] * exp(-lr);
+        }
+        return NaN;
+    case propertyFlag::V:
+        return exp(-lr);
+    case propertyFlag::T:
+        return T;
+    default:
+        return NaN;
+    }
+}
+
+double PropertyTable::satProp(propertyFlag::type ijob, const double* g, bool vapor)
+{
+    double lr = vapor ? g[iLogRhoV] : g[iLogRhoF];
+    switch (ijob) {
+    case propertyFlag::P:
+        return exp(g[iLogP]);
+    case propertyFlag::U:
+        return vapor ? g[iUV] : g[iUF];
+    case propertyFlag::S:
+        return vapor ? g[iSV] : g[iSF];
+    case propertyFlag::H:
+        return (vapor ? g[iUV] : g[iUF]) + exp(g[iLogP] - lr);
+    case propertyFlag::V:
+        return exp(-lr);
+    default:
+        return NaN;
+    }
+}
+
+bool PropertyTable::saturation(double T, double* g) const
+{
+    if (m_nSat == 0 || !(T >= m_Tmin && T <= m_Ttop)) {
+        return false;
+    }
+    double s = (sqrt(1.0 - T / m_Tc) - m_z0) / m_dz;
+    size_t k = std::min(static_cast<size_t>(std::max(s, 0.0)), m_nSat - 2);
+    double h[2], gg[2], dh[2], dg[2];
+    hermite(s - k, h, gg, dh, dg);
+    for (size_t n = 0; n < nSatProps; n++) {
+        const double* d0 = &m_sat[(k * nSatProps + n) * 2];
+        const double* d1 = &m_sat[((k + 1) * nSatProps + n) * 2];
+        g[n] = h[0] * d0[0] + h[1] * d1[0] + m_dz * (gg[0] * d0[1] + gg[1] * d1[1]);
+    }
+    return true;
+}
+
+bool PropertyTable::checkDome(double T, double rho, bool& twoPhase, double* g) const
+{
+    twoPhase = false;
+    if (T >= m_Tc) {
+        return true;
+    }
+    double lr = log(rho);
+    if (saturation(T, g)) {
+        twoPhase = (lr > g[iLogRhoV] && lr < g[iLogRhoF]);
+        return true;
+    }
+    // Close to the critical point, states outside of the dome at the highest
+    // tabulated saturation temperature are single-phase
+    if (T > m_Ttop && saturation(m_Ttop, g)) {
+        return (lr <= g[iLogRhoV] || lr >= g[iLogRhoF]);
+    }
+    return false;
+}
+
+double PropertyTable::prop(propertyFlag::type ijob, double T, double rho) const
+{
+    if (ijob == propertyFlag::T) {
+        return T;
+    } else if (ijob == propertyFlag::V) {
+        return 1.0 / rho;
+    }
+    bool twoPhase;
+    double g[nSatProps];
+    if (!checkDome(T, rho, twoPhase, g)) {
+        return NaN;
+    } else if (twoPhase) {
+        double vf = exp(-g[iLogRhoF]);
+        double xx = (1.0 / rho - vf) / (exp(-g[iLogRhoV]) - vf);
+        double ff = satProp(ijob, g, false);
+        return ff + xx * (satProp(ijob, g, true) - ff);
+    }
+    return singleProp(ijob, T, log(rho));
+}
+
+double PropertyTable::x(double T, double rho) const
+{
+    bool twoPhase;
+    double g[nSatProps];
+    if (T >= m_Tc) {
+        return (rho > m_rhoc) ? 0.0 : 1.0;
+    } else if (!checkDome(T, rho, twoPhase, g)) {
+        return NaN;
+    } else if (twoPhase) {
+        double vf = exp(-g[iLogRhoF]);
+        return (1.0 / rho - vf) / (exp(-g[iLogRhoV]) - vf);
+    }
+    return (log(rho) >= g[iLogRhoF]) ? 0.0 : 1.0;
+}
+
+double PropertyTable::cv(double T, double rho) const
+{
+    bool twoPhase;
+    double g[nSatProps], u[3];
+    if (!checkDome(T, rho, twoPhase, g) || twoPhase
+        || !interpolate(iU, T, log(rho), u)) {
+        return NaN;
+    }
+    return u[1];
+}
+
+double PropertyTable::cp(double T, double rho) const
+{
+    bool twoPhase;
+    double g[nSatProps], u[3], p[3];
+    if (!checkDome(T, rho, twoPhase, g)) {
+        return NaN;
+    } else if (twoPhase) {
+        return std::numeric_limits<double>::infinity();
+    } else if (!interpolate(iU, T, log(rho), u) || !interpolate(iP, T, log(rho), p)) {
+        return NaN;
+    }
+    return u[1] + T * p[1] * p[1] / (rho * p[2]);
+}
+
+double PropertyTable::thermalExpansionCoeff(double T, double rho) const
+{
+    bool twoPhase;
+    double g[nSatProps], p[3];
+    if (!checkDome(T, rho, twoPhase, g)) {
+        return NaN;
+    } else if (twoPhase) {
+        return std::numeric_limits<double>::infinity();
+    } else if (!interpolate(iP, T, log(rho), p)) {
+        return NaN;
+    }
+    return p[1] / p[2];
+}
+
+double PropertyTable::isothermalCompressibility(double T, double rho) const
+{
+    bool twoPhase;
+    double g[nSatProps], p[3];
+    if (!checkDome(T, rho, twoPhase, g)) {
+        return NaN;
+    } else if (twoPhase) {
+        return std::numeric_limits<double>::infinity();
+    } else if (!interpolate(iP, T, log(rho), p)) {
+        return NaN;
+    }
+    return 1.0 / p[2];
+}
+
+double PropertyTable::Ps(double T) const
+{
+    double g[nSatProps];
+    return saturation(T, g) ? exp(g[iLogP]) : NaN;
+}
+
+double PropertyTable::Tsat(double p) const
+{
+    if (m_nSat == 0 || !(p > 0.0)) {
+        return NaN;
+    }
+    // The saturation pressure decreases with increasing z
+    double lp = log(p);
+    auto logP = [&](size_t k) { return m_sat[k * nSatProps * 2]; };
+    if (lp > logP(0) || lp < logP(m_nSat - 1)) {
+        return NaN;
+    }
+    size_t lo = 0, hi = m_nSat - 1;
+    while (hi - lo > 1) {
+        size_t mid = (lo + hi) / 2;
+        if (logP(mid) >= lp) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    const double* d0 = &m_sat[lo * nSatProps * 2];
+    const double* d1 = &m_sat[hi * nSatProps * 2];
+    auto f = [&](double t) {
+        double h[2], g[2], dh[2], dg[2];
+        hermite(t, h, g, dh, dg);
+        return h[0] * d0[0] + h[1] * d1[0] + m_dz * (g[0] * d0[1] + g[1] * d1[1])
+               - lp;
+    };
+    double t = findRoot(f, 0.0, 1.0, d0[0] - lp, d1[0] - lp, 1e-14);
+    double z = m_z0 + (lo + t) * m_dz;
+    return m_Tc * (1.0 - z * z);
+}
+
+double PropertyTable::rhoTP(double T, double p, double lrlo, double lrhi) const
+{
+    auto f = [&](double lr) {
+        double P[3];
+        return interpolate(iP, T, lr, P) ? P[0] - p : NaN;
+    };
+    lrlo = std::max(lrlo, m_x0);
+    lrhi = std::min(lrhi, m_x0 + m_dx * (m_nRho - 1));
+    double flo = f(lrlo);
+    double fhi = f(lrhi);
+    // Outside of its range of validity, the equation of state may give pressures
+    // which decrease with increasing density
+    for (int n = 0; n < 10 && flo < 0 && !(fhi >= 0); n++) {
+        lrhi = 0.5 * (lrlo + lrhi);
+        fhi = f(lrhi);
+    }
+    return exp(findRoot(f, lrlo, lrhi, flo, fhi, 1e-13));
+}
+
+double PropertyTable::rhoTP(double T, double p) const
+{
+    double lrmin = m_x0;
+    double lrmax = m_x0 + m_dx * (m_nRho - 1);
+    if (T >= m_Tc || (p >= m_Pc && T > m_Ttop)) {
+        return rhoTP(T, p, lrmin, lrmax);
+    }
+    double g[nSatProps];
+    if (!saturation(T, g)) {
+        return NaN;
+    }
+    // Include a small part of the metastable region to make sure that states
+    // close to the saturation curve are bracketed
+    if (p > exp(g[iLogP])) {
+        return rhoTP(T, p, g[iLogRhoF] - 0.01, lrmax);
+    } else {
+        return rhoTP(T, p, lrmin, g[iLogRhoV] + 0.01);
+    }
+}
+
+bool PropertyTable::solve(PropertyPair::type XY, double x0, double y0,
+                          double& T, double& rho) const
+{
+    if (XY < 0) {
+        std::swap(x0, y0);
+        XY = static_cast<PropertyPair::type>(-XY);
+    }
+    double Tlo = Tlow();
+    double Thi = Thigh();
+    double lrlo = m_x0;
+    double lrhi = m_x0 + m_dx * (m_nRho - 1);
+    double g[nSatProps];
+
+    // Solve for the temperature at constant density
+    auto solveV = [&](propertyFlag::type ijob, double val, double v) {
+        if (!(v > 0.0)) {
+            return false;
+        }
+        rho = 1.0 / v;
+        auto f = [&](double t) { return prop(ijob, t, rho) - val; };
+        T = findRoot(f, Tlo, Thi, f(Tlo), f(Thi), 1e-12 * Thi);
+        return !std::isnan(T);
+    };
+
+    // Solve for the temperature at constant pressure
+    auto solveP = [&](propertyFlag::type ijob, double val, double p) {
+        if (m_nSat == 0 && Tlo < m_Tc) {
+            return false;
+        }
+        double Ta = (m_nSat > 0) ? m_Tmin : Tlo;
+        double Tb = Thi;
+        double fa = NaN, fb = NaN;
+        if (p < m_Pc && m_nSat > 0 && p >= Ps(m_Tmin)) {
+            double Ts = Tsat(p);
+            if (std::isnan(Ts) || !saturation(Ts, g)) {
+                return false;
+            }
+            double ff = satProp(ijob, g, false);
+            double fv = satProp(ijob, g, true);
+            if (val >= ff && val <= fv) {
+                double xx = (val - ff) / (fv - ff);
+                T = Ts;
+                rho = 1.0 / ((1 - xx) * exp(-g[iLogRhoF]) + xx * exp(-g[iLogRhoV]));
+                return true;
+            } else if (val < ff) {
+                Tb = Ts;
+                fb = ff - val;
+            } else {
+                Ta = Ts;
+                fa = fv - val;
+            }
+        }
+        auto f = [&](double t) {
+            return singleProp(ijob, t, log(rhoTP(t, p))) - val;
+        };
+        if (std::isnan(fa)) {
+            fa = f(Ta);
+        }
+        if (std::isnan(fb)) {
+            fb = f(Tb);
+        }
+        T = findRoot(f, Ta, Tb, fa, fb, 1e-12 * Thi);
+        if (std::isnan(T)) {
+            return false;
+        }
+        rho = rhoTP(T, p);
+        return !std::isnan(rho);
+    };
+
+    switch (XY) {
+    case PropertyPair::TV:
+        T = x0;
+        rho = 1.0 / y0;
+        return (T >= Tlo && T <= Thi && y0 > 0 && log(rho) >= lrlo
+                && log(rho) <= lrhi);
+    case PropertyPair::TP:
+        if (x0 < m_Tc) {
+            double ps = Ps(x0);
+            if (std::isnan(ps) || std::abs(y0 - ps) / y0 < 1e-6) {
+                // let Substance handle states close to saturation
+                return false;
+            }
+        }
+        T = x0;
+        rho = rhoTP(x0, y0);
+        if (std::isnan(rho)) {
+            return false;
+        }
+        // Interpolation errors near the critical point may result in a density
+        // which lies inside the tabulated saturation dome
+        bool twoPhase;
+        return checkDome(T, rho, twoPhase, g) && !twoPhase;
+    case PropertyPair::TX:
+    case PropertyPair::PX:
+        if (y0 < 0.0 || y0 > 1.0) {
+            return false;
+        }
+        T = (XY == PropertyPair::TX) ? x0 : Tsat(x0);
+        if (!saturation(T, g)) {
+            return false;
+        }
+        rho = 1.0 / ((1 - y0) * exp(-g[iLogRhoF]) + y0 * exp(-g[iLogRhoV]));
+        return true;
+    case PropertyPair::HP:
+        return solveP(propertyFlag::H, x0, y0);
+    case PropertyPair::SP:
+        return solveP(propertyFlag::S, x0, y0);
+    case PropertyPair::UP:
+        return solveP(propertyFlag::U, x0, y0);
+    case PropertyPair::UV:
+        return solveV(propertyFlag::U, x0, y0);
+    case PropertyPair::SV:
+        return solveV(propertyFlag::S, x0, y0);
+    case PropertyPair::PV:
+        return solveV(propertyFlag::P, x0, y0);
+    case PropertyPair::VH:
+        return solveV(propertyFlag::H, y0, x0);
+    case PropertyPair::ST:
+    {
+        // Entropy decreases with increasing density at constant temperature
+        T = y0;
+        double lra = lrlo, lrb = lrhi;
+        double fa = NaN, fb = NaN;
+        if (T < m_Tc) {
+            if (!saturation(T, g)) {
+                return false;
+            }
+            double sf = g[iSF];
+            double sv = g[iSV];
+            if (x0 >= sf && x0 <= sv) {
+                double xx = (x0 - sf) / (sv - sf);
+                rho = 1.0 / ((1 - xx) * exp(-g[iLogRhoF]) + xx * exp(-g[iLogRhoV]));
+                return true;
+            } else if (x0 < sf) {
+                lra = g[iLogRhoF];
+                fa = sf - x0;
+            } else {
+                lrb = g[iLogRhoV];
+                fb = sv - x0;
+            }
+        }
+        auto f = [&](double lr) { return singleProp(propertyFlag::S, T, lr) - x0; };
+        if (std::isnan(fa)) {
+            fa = f(lra);
+        }
+        if (std::isnan(fb)) {
+            fb = f(lrb);
+        }
+        double lr = findRoot(f, lra, lrb, fa, fb, 1e-13);
+        rho = exp(lr);
+        return !std::isnan(lr);
+    }
+    default:
+        return false;
+    }
+}
+
+}
@@ -12,6 +12,7 @@
 #include "cantera/thermo/Species.h"
 #include "cantera/base/utilities.h"
 #include "cantera/base/global.h"
+#include "cantera/base/Profiler.h"
 
 namespace Cantera
 {
@@ -27,6 +28,7 @@ GasTransport::GasTransport() :
 
 void GasTransport::update_T()
 {
+    CT_PROFILE_ZONE("GasTransport::update_T");
     if (m_thermo->nSpecies() != m_nsp) {
         // Rebuild data structures if number of species has changed
         init(m_thermo, m_mode, m_log_level);
@@ -83,6 +85,7 @@ double GasTransport::viscosity()
 
 void GasTransport::updateViscosity_T()
 {
+    CT_PROFILE_ZONE("GasTransport::updateViscosity_T");
     if (!m_spvisc_ok) {
         updateSpeciesViscosities();
     }
@@ -104,6 +107,7 @@ void GasTransport::updateViscosity_T()
 
 void GasTransport::updateSpeciesViscosities()
 {
+    CT_PROFILE_ZONE("GasTransport::updateSpeciesViscosities");
     update_T();
     if (m_mode == CK_Mode) {
         for (size_t k = 0; k < m_nsp; k++) {
@@ -122,6 +126,7 @@ void GasTransport::updateSpeciesViscosities()
 
 void GasTransport::updateDiff_T()
 {
+    CT_PROFILE_ZONE("GasTransport::updateDiff_T");
     update_T();
     // evaluate binary diffusion coefficients at unit pressure
     size_t ic = 0;
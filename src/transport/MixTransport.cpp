@@ -10,6 +10,7 @@
 #include "cantera/base/stringUtils.h"
 #include "cantera/thermo/ThermoPhase.h"
 #include "cantera/base/utilities.h"
+#include "cantera/base/Profiler.h"
 
 namespace Cantera
 {
@@ -99,6 +100,7 @@ void MixTransport::update_T()
 
 void MixTransport::update_C()
 {
+    CT_PROFILE_ZONE("MixTransport::update_C");
     // signal that concentration-dependent quantities will need to be recomputed
     // before use, and update the local mole fractions.
     m_visc_ok = false;
@@ -113,6 +115,7 @@ void MixTransport::update_C()
 
 void MixTransport::updateCond_T()
 {
+    CT_PROFILE_ZONE("MixTransport::updateCond_T");
     if (m_mode == CK_Mode) {
         for (size_t k = 0; k < m_nsp; k++) {
             m_cond[k] = exp(dot4(m_polytempvec, m_condcoeffs[k]));
@@ -10,6 +10,7 @@
 #include "cantera/thermo/IdealGasPhase.h"
 #include "cantera/base/stringUtils.h"
 #include "cantera/base/utilities.h"
+#include "cantera/base/Profiler.h"
 
 using namespace std;
 
@@ -399,6 +400,7 @@ void MultiTransport::update_T()
 
 void MultiTransport::update_C()
 {
+    CT_PROFILE_ZONE("MultiTransport::update_C");
     // Update the local mole fraction array
     m_thermo->getMoleFractions(m_molefracs.data());
 
@@ -416,6 +418,7 @@ void MultiTransport::update_C()
 
 void MultiTransport::updateThermal_T()
 {
+    CT_PROFILE_ZONE("MultiTransport::updateThermal_T");
     if (m_thermal_tlast == m_thermo->temperature()) {
         return;
     }
@@ -119,14 +119,12 @@ void IdealGasConstPressureMoleReactor::eval(double time, double* LHS, double* RH
     }
 }
 
-Eigen::SparseMatrix<double> IdealGasConstPressureMoleReactor::jacobian()
+void IdealGasConstPressureMoleReactor::getJacobianElements(vector<Eigen::Triplet<double>>& trips)
 {
     if (m_nv == 0) {
-        throw CanteraError("IdealGasConstPressureMoleReactor::jacobian",
+        throw CanteraError("IdealGasConstPressureMoleReactor::getJacobianElements",
                            "Reactor must be initialized first.");
     }
-    // clear former jacobian elements
-    m_jac_trips.clear();
     // dnk_dnj represents d(dot(n_k)) / d (n_j) but is first assigned as
     // d (dot(omega)) / d c_j, it is later transformed appropriately.
     Eigen::SparseMatrix<double> dnk_dnj = m_kin->netProductionRates_ddCi();
@@ -172,7 +170,7 @@ Eigen::SparseMatrix<double> IdealGasConstPressureMoleReactor::jacobian()
             if (static_cast<size_t>(it.row()) < m_nsp) {
                 it.valueRef() = it.value() + netProductionRates[it.row()] * molarVol;
             }
-            m_jac_trips.emplace_back(static_cast<int>(it.row() + m_sidx),
+            trips.emplace_back(static_cast<int>(it.row() + m_sidx),
                 static_cast<int>(it.col() + m_sidx), it.value());
         }
     }
@@ -201,7 +199,7 @@ Eigen::SparseMatrix<double> IdealGasConstPressureMoleReactor::jacobian()
         for (size_t j = 0; j < m_nv; j++) {
             double ydotPerturbed = rhsPerturbed[j] / lhsPerturbed[j];
             double ydotCurrent = rhsCurrent[j] / lhsCurrent[j];
-            m_jac_trips.emplace_back(static_cast<int>(j), 0,
+            trips.emplace_back(static_cast<int>(j), 0,
                                      (ydotPerturbed - ydotCurrent) / deltaTemp);
         }
         // d T_dot/dnj
@@ -226,14 +224,24 @@ Eigen::SparseMatrix<double> IdealGasConstPressureMoleReactor::jacobian()
         Eigen::VectorXd hk_dnkdnj_sums = dnk_dnj.transpose() * enthalpy;
         // Add derivatives to jac by spanning columns
         for (size_t j = 0; j < ssize; j++) {
-            m_jac_trips.emplace_back(0, static_cast<int>(j + m_sidx),
+            trips.emplace_back(0, static_cast<int>(j + m_sidx),
                 (specificHeat[j] * qdot - NCp * hk_dnkdnj_sums[j]) * denom);
         }
     }
-    // convert triplets to sparse matrix
-    Eigen::SparseMatrix<double> jac(m_nv, m_nv);
-    jac.setFromTriplets(m_jac_trips.begin(), m_jac_trips.end());
-    return jac;
+}
+
+Eigen::SparseMatrix<double> IdealGasConstPressureMoleReactor::productionRateJacobian()
+{
+    Eigen::SparseMatrix<double> dydot = ConstPressureMoleReactor::productionRateJacobian();
+    if (m_energy) {
+        // energy equation: m cp dT/dt = -V sum_k h_k wdot_k + ...
+        m_thermo->getPartialMolarEnthalpies(m_hk.data());
+        double denom = m_mass * m_thermo->cp_mass();
+        for (size_t k = 0; k < m_nsp; k++) {
+            dydot.coeffRef(0, k) = -m_vol * m_hk[k] / denom;
+        }
+    }
+    return dydot;
 }
 
 size_t IdealGasConstPressureMoleReactor::componentIndex(const string& nm) const
@@ -58,8 +58,7 @@ void IdealGasConstPressureReactor::updateState(double* y)
     // [2...K+2) are the mass fractions of each species, and [K+2...] are the
     // coverages of surface species on each wall.
     m_mass = y[0];
-    m_thermo->setMassFractions_NoNorm(y+2);
-    m_thermo->setState_TP(y[1], m_pressure);
+    m_thermo->setState_TPY_NoNorm(y[1], m_pressure, y+2);
     m_vol = m_mass / m_thermo->density();
     updateConnected(false);
     updateSurfaceState(y + m_nsp + 2);
@@ -130,6 +129,20 @@ void IdealGasConstPressureReactor::eval(double time, double* LHS, double* RHS)
     }
 }
 
+Eigen::SparseMatrix<double> IdealGasConstPressureReactor::productionRateJacobian()
+{
+    Eigen::SparseMatrix<double> dydot = ConstPressureReactor::productionRateJacobian();
+    if (m_energy) {
+        // energy equation: m cp dT/dt = -V sum_k h_k wdot_k + ...
+        m_thermo->getPartialMolarEnthalpies(m_hk.data());
+        double denom = m_mass * m_thermo->cp_mass();
+        for (size_t k = 0; k < m_nsp; k++) {
+            dydot.coeffRef(1, k) = -m_vol * m_hk[k] / denom;
+        }
+    }
+    return dydot;
+}
+
 size_t IdealGasConstPressureReactor::componentIndex(const string& nm) const
 {
     size_t k = speciesIndex(nm);
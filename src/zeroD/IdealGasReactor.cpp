@@ -63,8 +63,7 @@ void IdealGasReactor::updateState(double* y)
     // and [K+3...] are the coverages of surface species on each wall.
     m_mass = y[0];
     m_vol = y[1];
-    m_thermo->setMassFractions_NoNorm(y+3);
-    m_thermo->setState_TD(y[2], m_mass / m_vol);
+    m_thermo->setState_TDY_NoNorm(y[2], m_mass / m_vol, y+3);
     updateConnected(true);
     updateSurfaceState(y + m_nsp + 3);
 }
@@ -135,6 +134,20 @@ void IdealGasReactor::eval(double time, double* LHS, double* RHS)
     }
 }
 
+Eigen::SparseMatrix<double> IdealGasReactor::productionRateJacobian()
+{
+    Eigen::SparseMatrix<double> dydot = Reactor::productionRateJacobian();
+    if (m_energy) {
+        // energy equation: m cv dT/dt = -V sum_k u_k wdot_k + ...
+        m_thermo->getPartialMolarIntEnergies(m_uk.data());
+        double denom = m_mass * m_thermo->cv_mass();
+        for (size_t k = 0; k < m_nsp; k++) {
+            dydot.coeffRef(2, k) = -m_vol * m_uk[k] / denom;
+        }
+    }
+    return dydot;
+}
+
 size_t IdealGasReactor::componentIndex(const string& nm) const
 {
     size_t k = speciesIndex(nm);
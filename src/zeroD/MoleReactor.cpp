@@ -281,6 +281,22 @@ void MoleReactor::eval(double time, double* LHS, double* RHS)
 }
 
 
+Eigen::SparseMatrix<double> MoleReactor::productionRateJacobian()
+{
+    if (m_nv == 0) {
+        throw CanteraError("MoleReactor::productionRateJacobian",
+                           "Reactor must be initialized first.");
+    }
+    // species equations: dn_k/dt = V wdot_k + ...
+    size_t k0 = componentIndex(m_thermo->speciesName(0));
+    Eigen::SparseMatrix<double> dydot(m_nv, m_nsp);
+    dydot.reserve(Eigen::VectorXi::Constant(m_nsp, 2));
+    for (size_t k = 0; k < m_nsp; k++) {
+        dydot.insert(k0 + k, k) = m_vol;
+    }
+    return dydot;
+}
+
 size_t MoleReactor::componentIndex(const string& nm) const
 {
     size_t k = speciesIndex(nm);
@@ -316,6 +316,15 @@ void Reactor::evalSurfaces(double* LHS, double* RHS, double* sdot)
     }
 }
 
+Eigen::SparseMatrix<double> Reactor::jacobian()
+{
+    m_jac_trips.clear();
+    getJacobianElements(m_jac_trips);
+    Eigen::SparseMatrix<double> jac(m_nv, m_nv);
+    jac.setFromTriplets(m_jac_trips.begin(), m_jac_trips.end());
+    return jac;
+}
+
 Eigen::SparseMatrix<double> Reactor::finiteDifferenceJacobian()
 {
     if (m_nv == 0) {
@@ -490,6 +499,53 @@ string Reactor::componentName(size_t k) {
     throw CanteraError("Reactor::componentName", "Index is out of bounds.");
 }
 
+Eigen::SparseMatrix<double> Reactor::productionRateJacobian()
+{
+    if (m_nv == 0) {
+        throw CanteraError("Reactor::productionRateJacobian",
+                           "Reactor must be initialized first.");
+    }
+    // species equations: m dY_k/dt = V W_k wdot_k + ...
+    size_t k0 = componentIndex(m_thermo->speciesName(0));
+    const vector<double>& mw = m_thermo->molecularWeights();
+    Eigen::SparseMatrix<double> dydot(m_nv, m_nsp);
+    dydot.reserve(Eigen::VectorXi::Constant(m_nsp, 2));
+    for (size_t k = 0; k < m_nsp; k++) {
+        dydot.insert(k0 + k, k) = m_vol * mw[k] / m_mass;
+    }
+    return dydot;
+}
+
+size_t Reactor::nReactions() const
+{
+    return m_kin ? m_kin->nReactions() : 0;
+}
+
+void Reactor::getMultiplierDerivatives(const double* lambda, double* dmult)
+{
+    size_t nr = nReactions();
+    if (!m_chem) {
+        std::fill(dmult, dmult + nr, 0.0);
+        return;
+    } else if (nr == 0) {
+        return;
+    }
+    m_thermo->restoreState(m_state);
+    // The derivative of the right-hand side with respect to the multiplier of
+    // reaction i is B nu_i q_i, where B = d(ydot)/d(wdot), nu_i is the vector of
+    // net stoichiometric coefficients and q_i is the net rate of progress
+    Eigen::SparseMatrix<double> B = productionRateJacobian();
+    Eigen::Map<const Eigen::VectorXd> lam(lambda, m_nv);
+    Eigen::VectorXd w = B.transpose() * lam;
+    w.conservativeResize(m_kin->nTotalSpecies());
+    Eigen::SparseMatrix<double> nu = m_kin->productStoichCoeffs()
+                                     - m_kin->reactantStoichCoeffs();
+    Eigen::VectorXd rop(nr);
+    m_kin->getNetRatesOfProgress(rop.data());
+    Eigen::Map<Eigen::VectorXd> out(dmult, nr);
+    out = (nu.transpose() * w).cwiseProduct(rop);
+}
+
 void Reactor::applySensitivity(double* params)
 {
     if (!params) {
@@ -0,0 +1,206 @@
+//! @file ReactorISAT.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/zeroD/ReactorISAT.h"
+#include "cantera/zeroD/ReactorNet.h"
+#include "cantera/thermo/ThermoPhase.h"
+
+namespace Cantera
+{
+
+ReactorISAT::ReactorISAT(ReactorNet& net)
+    : m_net(net)
+{
+    if (m_net.nReactors() != 1) {
+        throw CanteraError("ReactorISAT::ReactorISAT",
+            "Tabulation requires a network containing exactly one reactor, "
+            "but the network contains {}.", m_net.nReactors());
+    }
+    size_t nsp = m_net.reactor(0).contents().nSpecies();
+    m_scale.setOnes(nsp + 2);
+    m_scale[0] = 1e-3;
+    m_scale[1] = 1.0 / OneAtm;
+}
+
+void ReactorISAT::setTolerance(double tol)
+{
+    if (tol <= 0.0) {
+        throw CanteraError("ReactorISAT::setTolerance",
+                           "Tolerance must be positive; got {}.", tol);
+    }
+    m_tol = tol;
+    clear();
+}
+
+void ReactorISAT::setScales(double Tscale, double Pscale)
+{
+    if (Tscale <= 0.0 || Pscale <= 0.0) {
+        throw CanteraError("ReactorISAT::setScales",
+                           "Scale factors must be positive.");
+    }
+    m_scale[0] = Tscale;
+    m_scale[1] = Pscale;
+    clear();
+}
+
+void ReactorISAT::clear()
+{
+    m_root.reset();
+    m_leaves.clear();
+    m_nRetrieve = 0;
+    m_nGrow = 0;
+    m_nAdd = 0;
+    m_nDirect = 0;
+}
+
+void ReactorISAT::getComposition(Eigen::VectorXd& phi)
+{
+    ThermoPhase& thermo = m_net.reactor(0).contents();
+    phi.resize(m_scale.size());
+    phi[0] = thermo.temperature();
+    phi[1] = thermo.pressure();
+    thermo.getMassFractions(phi.data() + 2);
+}
+
+void ReactorISAT::setComposition(const Eigen::VectorXd& phi)
+{
+    Reactor& r = m_net.reactor(0);
+    ThermoPhase& thermo = r.contents();
+    thermo.setMassFractions_NoNorm(phi.data() + 2);
+    thermo.setState_TP(phi[0], phi[1]);
+    r.syncState();
+}
+
+void ReactorISAT::integrate(const Eigen::VectorXd& phi, Eigen::VectorXd& R)
+{
+    setComposition(phi);
+    m_net.setInitialTime(0.0);
+    m_net.advance(m_dt);
+    getComposition(R);
+}
+
+ReactorISAT::Node* ReactorISAT::findLeaf(const Eigen::VectorXd& phi)
+{
+    Node* node = m_root.get();
+    while (!node->leaf) {
+        node = (node->v.dot(phi) > node->a) ? node->right.get() : node->left.get();
+    }
+    return node;
+}
+
+void ReactorISAT::addEntry(const Eigen::VectorXd& phi, const Eigen::VectorXd& R,
+                           Node* sibling)
+{
+    size_t n = phi.size();
+    auto leaf = make_unique<Leaf>();
+    leaf->phi = phi;
+    leaf->R = R;
+
+    // Mapping gradient by forward differences
+    leaf->A.resize(n, n);
+    double delta = sqrt(m_net.rtol());
+    Eigen::VectorXd phiPert, Rpert;
+    for (size_t j = 0; j < n; j++) {
+        phiPert = phi;
+        double h = delta * std::max(std::abs(phi[j]), 1e-3 / m_scale[j]);
+        phiPert[j] += h;
+        integrate(phiPert, Rpert);
+        leaf->A.col(j) = (Rpert - R) / h;
+    }
+
+    // Initial ellipsoid of accuracy, {x : |B x| <= tol} in scaled coordinates, where
+    // B is the scaled mapping gradient. Eigenvalues of B^T B are bounded from below
+    // so that the EOA remains bounded in directions where the mapping is flat.
+    Eigen::MatrixXd B = m_scale.asDiagonal() * leaf->A
+                        * m_scale.cwiseInverse().asDiagonal();
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eig(B.transpose() * B);
+    Eigen::VectorXd lambda = eig.eigenvalues().cwiseMax(0.25);
+    leaf->M = eig.eigenvectors() * lambda.asDiagonal()
+              * eig.eigenvectors().transpose() / (m_tol * m_tol);
+
+    m_leaves.push_back(leaf.get());
+    if (!sibling) {
+        m_root = make_unique<Node>();
+        m_root->leaf = std::move(leaf);
+        return;
+    }
+
+    // Replace the sibling leaf by a node with a cutting plane that bisects the
+    // segment between the two tabulation points in scaled coordinates
+    Eigen::VectorXd& phiOld = sibling->leaf->phi;
+    sibling->v = m_scale.cwiseProduct(m_scale).cwiseProduct(phi - phiOld);
+    sibling->a = 0.5 * sibling->v.dot(phi + phiOld);
+    sibling->left = make_unique<Node>();
+    sibling->left->leaf = std::move(sibling->leaf);
+    sibling->right = make_unique<Node>();
+    sibling->right->leaf = std::move(leaf);
+}
+
+void ReactorISAT::advance(double dt)
+{
+    if (dt != m_dt) {
+        clear();
+        m_dt = dt;
+    }
+    getComposition(m_phi);
+    if (!m_root) {
+        integrate(m_phi, m_R);
+        addEntry(m_phi, m_R, nullptr);
+        m_nAdd++;
+        setComposition(m_R);
+        return;
+    }
+
+    Node* node = findLeaf(m_phi);
+    Leaf& leaf = *node->leaf;
+    Eigen::VectorXd dphi = m_phi - leaf.phi;
+    Eigen::VectorXd x = m_scale.cwiseProduct(dphi);
+    Eigen::VectorXd Mx = leaf.M * x;
+    double r2 = x.dot(Mx);
+    if (r2 <= 1.0) {
+        // Retrieve: the query point is within the ellipsoid of accuracy
+        m_R = leaf.R + leaf.A * dphi;
+        m_nRetrieve++;
+        setComposition(m_R);
+        return;
+    }
+
+    integrate(m_phi, m_R);
+    double err = m_scale.cwiseProduct(m_R - leaf.R - leaf.A * dphi).norm();
+    if (err <= m_tol) {
+        // Grow: minimum-volume ellipsoid centered at the tabulation point that
+        // contains both the current EOA and the query point
+        leaf.M += (1.0 / r2 - 1.0) / r2 * Mx * Mx.transpose();
+        m_nGrow++;
+    } else if (m_leaves.size() < m_maxEntries) {
+        addEntry(m_phi, m_R, node);
+        m_nAdd++;
+    } else {
+        m_nDirect++;
+    }
+    setComposition(m_R);
+}
+
+size_t ReactorISAT::depth(const Node* node) const
+{
+    if (!node || node->leaf) {
+        return 0;
+    }
+    return 1 + std::max(depth(node->left.get()), depth(node->right.get()));
+}
+
+AnyMap ReactorISAT::stats() const
+{
+    AnyMap stats;
+    stats["retrieves"] = static_cast<long int>(m_nRetrieve);
+    stats["grows"] = static_cast<long int>(m_nGrow);
+    stats["adds"] = static_cast<long int>(m_nAdd);
+    stats["direct_evals"] = static_cast<long int>(m_nDirect);
+    stats["entries"] = static_cast<long int>(m_leaves.size());
+    stats["tree_depth"] = static_cast<long int>(depth(m_root.get()));
+    return stats;
+}
+
+}
@@ -8,14 +8,435 @@
 #include "cantera/zeroD/Wall.h"
 #include "cantera/base/utilities.h"
 #include "cantera/base/Array.h"
+#include "cantera/base/Profiler.h"
 #include "cantera/numerics/Integrator.h"
+#include "cantera/numerics/eigen_dense.h"
 #include "cantera/zeroD/FlowReactor.h"
 
+#include <algorithm>
 #include <cstdio>
+#include <limits>
 
 namespace Cantera
 {
 
+namespace {
+
+//! Function returning the elements of the analytic Jacobian of a reactor network
+//! at its current state
+typedef function<const vector<Eigen::Triplet<double>>&()> JacobianElements;
+
+//! The adjoint equations of a reactor network, @f$ d\lambda / ds = J^T \lambda @f$,
+//! written in terms of the reversed time @f$ s = t_f - t @f$. The solution of the
+//! network is interpolated from values and derivatives stored for the interval
+//! between two checkpoints of the forward integration.
+class AdjointSystem : public FuncEval
+{
+public:
+    //! If *jacElements* is empty, the Jacobian is evaluated by finite differences.
+    AdjointSystem(ReactorNet& net, double tf, const vector<double>& times,
+                  const vector<double>& states, const vector<double>& rates,
+                  const vector<double>& lambda0, const vector<double>& atol,
+                  double rtol, const JacobianElements& jacElements)
+        : m_net(net), m_tf(tf), m_times(times), m_states(states), m_rates(rates)
+        , m_lambda0(lambda0), m_atol(atol), m_rtol(rtol), m_n(net.neq())
+        , m_jacElements(jacElements), m_y(m_n)
+    {
+        if (m_jacElements) {
+            m_sparseJac.resize(m_n, m_n);
+        } else {
+            m_ydot.resize(m_n);
+            m_ypert.resize(m_n);
+            m_ydotpert.resize(m_n);
+            m_jac.resize(m_n, m_n);
+        }
+    }
+
+    size_t neq() const override {
+        return m_n;
+    }
+
+    void eval(double s, double* lambda, double* lambdadot, double* p) override {
+        updateJacobian(m_tf - s);
+        Eigen::Map<const Eigen::VectorXd> x(lambda, m_n);
+        Eigen::Map<Eigen::VectorXd> xdot(lambdadot, m_n);
+        if (m_jacElements) {
+            xdot.noalias() = m_sparseJac.transpose() * x;
+        } else {
+            xdot.noalias() = m_jac.transpose() * x;
+        }
+    }
+
+    bool hasJacobian() const override {
+        return true;
+    }
+
+    void getJacobian(double s, double* lambda, double* jac) override {
+        updateJacobian(m_tf - s);
+        MappedMatrix J(jac, m_n, m_n);
+        if (m_jacElements) {
+            J.setZero();
+            for (int k = 0; k < m_sparseJac.outerSize(); k++) {
+                for (Eigen::SparseMatrix<double>::InnerIterator it(m_sparseJac, k);
+                     it; ++it)
+                {
+                    J(it.col(), it.row()) = it.value();
+                }
+            }
+        } else {
+            J = m_jac.transpose();
+        }
+    }
+
+    //! Discard the current Jacobian after the stored solution has been replaced
+    void invalidateJacobian() {
+        m_tJac = NAN;
+    }
+
+    void getState(double* lambda) override {
+        std::copy(m_lambda0.begin(), m_lambda0.end(), lambda);
+    }
+
+    //! Set the state of the network to the solution at time *t*, using cubic
+    //! Hermite interpolation between the stored solution points.
+    void setNetworkState(double t) {
+        size_t i = std::upper_bound(m_times.begin(), m_times.end(), t)
+                   - m_times.begin();
+        i = std::min(std::max<size_t>(i, 1), m_times.size() - 1) - 1;
+        double h = m_times[i+1] - m_times[i];
+        double r = (t - m_times[i]) / h;
+        double r2 = r * r;
+        double r3 = r2 * r;
+        const double* y0 = &m_states[i * m_n];
+        const double* y1 = y0 + m_n;
+        const double* f0 = &m_rates[i * m_n];
+        const double* f1 = f0 + m_n;
+        for (size_t j = 0; j < m_n; j++) {
+            m_y[j] = (2 * r3 - 3 * r2 + 1) * y0[j] + (r3 - 2 * r2 + r) * h * f0[j]
+                     + (3 * r2 - 2 * r3) * y1[j] + (r3 - r2) * h * f1[j];
+        }
+        m_net.updateState(m_y.data());
+    }
+
+    //! Evaluate the Jacobian of the network at time *t*, unless it is already
+    //! available for this time. If the analytic Jacobian is not used, central
+    //! differences are used since errors in the Jacobian vary between evaluation
+    //! times, which would otherwise limit the accuracy that can be achieved by the
+    //! integrator.
+    void updateJacobian(double t) {
+        if (t == m_tJac) {
+            return;
+        }
+        setNetworkState(t);
+        if (m_jacElements) {
+            const auto& elements = m_jacElements();
+            m_sparseJac.setFromTriplets(elements.begin(), elements.end());
+            m_tJac = t;
+            return;
+        }
+        double* p = m_net.m_sens_params.data();
+        double delta = cbrt(std::numeric_limits<double>::epsilon());
+        m_ypert = m_y;
+        for (size_t j = 0; j < m_n; j++) {
+            double inc = delta * std::max(std::abs(m_y[j]), m_atol[j] / m_rtol);
+            m_ypert[j] = m_y[j] + inc;
+            double incp = m_ypert[j] - m_y[j];
+            m_net.eval(t, m_ypert.data(), m_ydotpert.data(), p);
+            m_ypert[j] = m_y[j] - inc;
+            double incm = m_y[j] - m_ypert[j];
+            m_net.eval(t, m_ypert.data(), m_ydot.data(), p);
+            m_jac.col(j) = (m_ydotpert - m_ydot) / (incp + incm);
+            m_ypert[j] = m_y[j];
+        }
+        m_tJac = t;
+    }
+
+private:
+    ReactorNet& m_net;
+    double m_tf; //!< Final time of the forward integration
+    const vector<double>& m_times; //!< Times of the stored solution points
+    const vector<double>& m_states; //!< Stored solution points
+    const vector<double>& m_rates; //!< Time derivatives at the stored points
+    const vector<double>& m_lambda0; //!< Adjoint variables at the final time
+    const vector<double>& m_atol; //!< Absolute tolerances of the network
+    double m_rtol; //!< Relative tolerance of the network
+    size_t m_n; //!< Number of equations
+    JacobianElements m_jacElements; //!< Analytic Jacobian, if used
+    double m_tJac = NAN; //!< Time at which the Jacobian was evaluated
+    Eigen::VectorXd m_y, m_ydot, m_ypert, m_ydotpert;
+    Eigen::SparseMatrix<double> m_sparseJac; //!< Analytic Jacobian of the network
+    Eigen::MatrixXd m_jac; //!< Finite difference Jacobian of the network
+};
+
+//! Damped Newton solver for the steady-state and pseudo-transient equations of a
+//! reactor network. If a function setting a parameter of the network is given, the
+//! unknowns are augmented with the logarithm of the parameter and the equations
+//! are augmented with a pseudo-arclength condition. The damping strategy follows
+//! MultiNewton.
+class SteadySolver
+{
+public:
+    SteadySolver(ReactorNet& net, double rtol, double atol,
+                 const function<void(double)>* setParameter=nullptr)
+        : m_net(net), m_setParameter(setParameter), m_n(net.neq())
+        , m_N(setParameter ? m_n + 1 : m_n), m_rtol(rtol), m_atol(atol)
+        , m_t(net.time()), m_y(m_n), m_ypert(m_n), m_f(m_n), m_fpert(m_n)
+        , m_yold(m_n), m_jac(m_n, m_n + 1), m_r(m_N), m_dx(m_N), m_x1(m_N)
+        , m_dx1(m_N)
+    {
+        for (size_t n = 0; n < net.nReactors(); n++) {
+            Reactor& r = net.reactor(static_cast<int>(n));
+            for (size_t i = 0; i < r.neq(); i++) {
+                string name = r.componentName(i);
+                m_positive.push_back(name == "mass" || name == "volume"
+                                     || name == "temperature");
+            }
+        }
+    }
+
+    //! Use the pseudo-transient equations for a backward Euler step of size *dt*
+    //! starting from *yold*, or the steady-state equations if *dt* is zero.
+    void setTimeStep(double dt, const Eigen::VectorXd& yold) {
+        m_rdt = (dt > 0) ? 1.0 / dt : 0.0;
+        m_yold = yold;
+        m_factored = false;
+    }
+
+    //! Set the arclength condition for a step of size *ds* from the solution
+    //! *xc* in the direction of the unit *tangent*, using the error *weights*.
+    void setArclength(const Eigen::VectorXd& xc, const Eigen::VectorXd& tangent,
+                      const Eigen::VectorXd& weights, double ds) {
+        m_xc = xc;
+        m_arc = weights.cwiseAbs2().cwiseProduct(tangent);
+        m_ds = ds;
+        m_factored = false;
+    }
+
+    //! Set the parameter of the network to `exp(q)`, if it is not already set.
+    void applyParameter(double q) {
+        if (q != m_q) {
+            (*m_setParameter)(exp(q));
+            m_q = q;
+        }
+    }
+
+    //! Error weights for the unknowns *x*.
+    void weights(const Eigen::VectorXd& x, Eigen::VectorXd& w) const {
+        w.resize(m_N);
+        for (size_t j = 0; j < m_n; j++) {
+            w[j] = 1.0 / (m_rtol * std::abs(x[j]) + m_atol);
+        }
+        if (m_N > m_n) {
+            w[m_n] = 1.0 / m_rtol;
+        }
+    }
+
+    //! Weighted RMS norm of the step *dx* from *x*.
+    double norm(const Eigen::VectorXd& x, const Eigen::VectorXd& dx) {
+        weights(x, m_w);
+        return m_w.cwiseProduct(dx).norm() / sqrt(static_cast<double>(m_N));
+    }
+
+    //! Evaluate the residual *r* at *x*. Returns `false` if the governing
+    //! equations cannot be evaluated.
+    bool residual(const Eigen::VectorXd& x, Eigen::VectorXd& r) {
+        if (!evalRHS(x, m_f)) {
+            return false;
+        }
+        r.head(m_n) = -m_f;
+        if (m_rdt != 0.0) {
+            r.head(m_n) += m_rdt * (x.head(m_n) - m_yold);
+        }
+        if (m_N > m_n) {
+            r[m_n] = m_arc.dot(x - m_xc) - m_ds;
+        }
+        return r.allFinite();
+    }
+
+    //! Evaluate the Jacobian of the steady-state equations at *x* by finite
+    //! differences, including the derivative with respect to the parameter.
+    bool updateJacobian(const Eigen::VectorXd& x) {
+        if (!evalRHS(x, m_f)) {
+            return false;
+        }
+        double delta = sqrt(std::numeric_limits<double>::epsilon());
+        double* p = m_net.m_sens_params.data();
+        try {
+            m_ypert = x.head(m_n);
+            for (size_t j = 0; j < m_n; j++) {
+                double inc = delta * std::max(std::abs(x[j]), m_atol / m_rtol);
+                m_ypert[j] = x[j] + inc;
+                inc = m_ypert[j] - x[j];
+                m_net.eval(m_t, m_ypert.data(), m_fpert.data(), p);
+                m_jac.col(j) = (m_fpert - m_f) / inc;
+                m_ypert[j] = x[j];
+            }
+            if (m_N > m_n) {
+                double q = x[m_n];
+                applyParameter(q + delta);
+                m_net.eval(m_t, m_ypert.data(), m_fpert.data(), p);
+                m_jac.col(m_n) = (m_fpert - m_f) / (m_q - q);
+                applyParameter(q);
+            } else {
+                m_jac.col(m_n).setZero();
+            }
+        } catch (CanteraError&) {
+            return false;
+        }
+        if (!m_jac.allFinite()) {
+            return false;
+        }
+        m_age = 0;
+        m_hasJacobian = true;
+        m_factored = false;
+        return true;
+    }
+
+    //! Compute the tangent to the solution branch at *x*, scaled such that the
+    //! component corresponding to the parameter is one.
+    bool tangent(const Eigen::VectorXd& x, Eigen::VectorXd& t) {
+        if (!updateJacobian(x)) {
+            return false;
+        }
+        Eigen::MatrixXd A = -m_jac.leftCols(m_n);
+        Eigen::VectorXd b = m_jac.col(m_n);
+        for (size_t j = 0; j < m_n; j++) {
+            if (m_jac.row(j).isZero(0.0)) {
+                A(j, j) = 1.0;
+            }
+        }
+        t.resize(m_N);
+        t.head(m_n) = A.partialPivLu().solve(b);
+        t[m_n] = 1.0;
+        return t.allFinite();
+    }
+
+    //! Solve the equations using the damped Newton method, starting from *x*.
+    //! @returns the number of iterations, or -1 if the iteration failed.
+    int newton(Eigen::VectorXd& x, int loglevel) {
+        bool fresh = false;
+        for (int iter = 1; iter <= m_maxIterations; iter++) {
+            if (!m_hasJacobian || m_age >= m_maxAge) {
+                if (!updateJacobian(x)) {
+                    return -1;
+                }
+                fresh = true;
+            }
+            if (!m_factored) {
+                factor();
+            }
+            if (!residual(x, m_r)) {
+                return -1;
+            }
+            m_dx = -m_lu.solve(m_r);
+            double norm0 = m_dx.allFinite() ? norm(x, m_dx) : Undef;
+            if (norm0 != Undef && norm0 < 1.0) {
+                x += m_dx;
+                return iter;
+            }
+
+            // Limit the step such that positive components are at most halved,
+            // then damp the step until the next undamped step is smaller
+            double s = 1.0;
+            for (size_t j = 0; j < m_n; j++) {
+                if (m_positive[j] && m_dx[j] < -0.5 * x[j]) {
+                    s = std::min(s, -0.5 * x[j] / m_dx[j]);
+                }
+            }
+            bool accepted = false;
+            for (int m = 0; norm0 != Undef && m < m_maxDampIterations; m++) {
+                m_x1 = x + s * m_dx;
+                if (residual(m_x1, m_r)) {
+                    m_dx1 = -m_lu.solve(m_r);
+                    if (m_dx1.allFinite() && norm(m_x1, m_dx1) < norm0) {
+                        accepted = true;
+                        break;
+                    }
+                }
+                s /= sqrt(2.0);
+            }
+            if (loglevel > 1) {
+                writelog("    Newton iteration {:2d}: step norm {:10.4g}, damping "
+                         "{:10.4g}{}\n", iter, norm0, accepted ? s : 0.0,
+                         fresh ? " (new Jacobian)" : "");
+            }
+            m_age++;
+            if (accepted) {
+                x = m_x1;
+                fresh = false;
+            } else if (fresh) {
+                return -1;
+            } else {
+                m_age = m_maxAge;
+            }
+        }
+        return -1;
+    }
+
+protected:
+    //! Evaluate the right-hand side of the governing equations at *x*.
+    bool evalRHS(const Eigen::VectorXd& x, Eigen::VectorXd& f) {
+        m_y = x.head(m_n);
+        try {
+            if (m_N > m_n) {
+                applyParameter(x[m_n]);
+            }
+            m_net.eval(m_t, m_y.data(), f.data(), m_net.m_sens_params.data());
+        } catch (CanteraError&) {
+            return false;
+        }
+        return true;
+    }
+
+    //! Factorize the Newton iteration matrix. Components whose equations do not
+    //! depend on the state of the network are held fixed in steady state.
+    void factor() {
+        Eigen::MatrixXd A = Eigen::MatrixXd::Zero(m_N, m_N);
+        A.topLeftCorner(m_n, m_n) = -m_jac.leftCols(m_n);
+        A.diagonal().head(m_n).array() += m_rdt;
+        if (m_N > m_n) {
+            A.col(m_n).head(m_n) = -m_jac.col(m_n);
+            A.row(m_n) = m_arc.transpose();
+        }
+        if (m_rdt == 0.0) {
+            for (size_t j = 0; j < m_n; j++) {
+                if (m_jac.row(j).isZero(0.0)) {
+                    A(j, j) = 1.0;
+                }
+            }
+        }
+        m_lu.compute(A);
+        m_factored = true;
+    }
+
+    ReactorNet& m_net;
+    const function<void(double)>* m_setParameter; //!< Sets the parameter, if any
+    size_t m_n; //!< Number of equations of the network
+    size_t m_N; //!< Number of unknowns, including the parameter
+    double m_rtol, m_atol; //!< Tolerances used for the error weights
+    double m_t; //!< Time at which the governing equations are evaluated
+    double m_rdt = 0.0; //!< Reciprocal of the pseudo-transient time step
+    double m_q = Undef; //!< Logarithm of the current value of the parameter
+    double m_ds = 0.0; //!< Arclength step
+    vector<bool> m_positive; //!< Components constrained to positive values
+
+    int m_age = 0; //!< Number of Newton iterations using the current Jacobian
+    bool m_hasJacobian = false;
+    bool m_factored = false;
+    int m_maxAge = 5;
+    int m_maxIterations = 50;
+    int m_maxDampIterations = 8;
+
+    Eigen::VectorXd m_y, m_ypert, m_f, m_fpert, m_yold, m_xc, m_arc, m_w;
+    //! Derivatives of the right-hand side with respect to the state of the network
+    //! and the logarithm of the parameter (last column)
+    Eigen::MatrixXd m_jac;
+    Eigen::PartialPivLU<Eigen::MatrixXd> m_lu;
+    Eigen::VectorXd m_r, m_dx, m_x1, m_dx1;
+};
+
+}
+
 ReactorNet::ReactorNet()
 {
     suppressErrors(true);
@@ -30,6 +451,9 @@ void ReactorNet::setInitialTime(double time)
     m_time = time;
     m_initial_time = time;
     m_integrator_init = false;
+    for (auto& event : m_events) {
+        event.times.clear();
+    }
 }
 
 void ReactorNet::setMaxTimeStep(double maxstep)
@@ -40,6 +464,7 @@ void ReactorNet::setMaxTimeStep(double maxstep)
 
 void ReactorNet::setMaxErrTestFails(int nmax)
 {
+    m_maxErrTestFails = nmax;
     integrator().setMaxErrTestFails(nmax);
 }
 
@@ -109,6 +534,11 @@ void ReactorNet::initialize()
         }
     }
 
+    if (!m_events.empty() && !m_reactors[0]->isOde()) {
+        throw CanteraError("ReactorNet::initialize",
+                           "Events are not supported for DAE systems.");
+    }
+
     m_ydot.resize(m_nv,0.0);
     m_yest.resize(m_nv,0.0);
     m_advancelimits.resize(m_nv,-1.0);
@@ -129,6 +559,8 @@ void ReactorNet::initialize()
     }
     if (m_integ->preconditionerSide() != PreconditionerSide::NO_PRECONDITION) {
         checkPreconditionerSupported();
+        // Size the Jacobian work array using the sparsity at the initial state
+        updateJacobianElements();
     }
     m_integrator_init = true;
     m_init = true;
@@ -154,6 +586,33 @@ void ReactorNet::setLinearSolverType(const string& linSolverType)
     m_integrator_init = false;
 }
 
+void ReactorNet::setIntegratorType(const string& integratorType)
+{
+    if (m_reactors.empty()) {
+        // integrator is created when the first reactor is added
+        m_integratorType = integratorType;
+        return;
+    }
+    m_integ.reset(newIntegrator(integratorType));
+    m_integratorType = integratorType;
+    // use backward differencing, with a full Jacobian computed
+    // numerically, and use a Newton linear iterator
+    m_integ->setMethod(BDF_Method);
+    m_integ->setLinearSolverType("DENSE");
+    // carry over settings applied to a previous integrator
+    if (m_maxstep > 0.0) {
+        m_integ->setMaxStepSize(m_maxstep);
+    }
+    if (m_maxSteps > 0) {
+        m_integ->setMaxSteps(m_maxSteps);
+    }
+    if (m_maxErrTestFails > 0) {
+        m_integ->setMaxErrTestFails(m_maxErrTestFails);
+    }
+    m_init = false;
+    m_integrator_init = false;
+}
+
 void ReactorNet::setPreconditioner(shared_ptr<PreconditionerBase> preconditioner)
 {
     m_precon = preconditioner;
@@ -162,6 +621,7 @@ void ReactorNet::setPreconditioner(shared_ptr<PreconditionerBase> preconditioner
 
 void ReactorNet::setMaxSteps(int nmax)
 {
+    m_maxSteps = nmax;
     integrator().setMaxSteps(nmax);
 }
 
@@ -177,8 +637,19 @@ void ReactorNet::advance(double time)
     } else if (!m_integrator_init) {
         reinitialize();
     }
-    m_integ->integrate(time);
-    m_time = time;
+    m_lastEvent = npos;
+    while (true) {
+        m_integ->integrate(time);
+        if (m_integ->rootInfo().empty()) {
+            m_time = time;
+            break;
+        }
+        // The integrator stopped at an event, which may end the integration
+        m_time = m_integ->currentTime();
+        if (handleEvents()) {
+            break;
+        }
+    }
     updateState(m_integ->solution());
 }
 
@@ -193,13 +664,13 @@ double ReactorNet::advance(double time, bool applylimit)
     if (!applylimit) {
         // take full step
         advance(time);
-        return time;
+        return m_time;
     }
 
     if (!hasAdvanceLimits()) {
         // take full step
         advance(time);
-        return time;
+        return m_time;
     }
 
     getAdvanceLimits(m_advancelimits.data());
@@ -234,7 +705,7 @@ double ReactorNet::advance(double time, bool applylimit)
         t = .5 * (m_time + t);
     }
     advance(t);
-    return t;
+    return m_time;
 }
 
 double ReactorNet::step()
@@ -244,11 +715,276 @@ double ReactorNet::step()
     } else if (!m_integrator_init) {
         reinitialize();
     }
+    m_lastEvent = npos;
     m_time = m_integ->step(m_time + 1.0);
+    if (!m_integ->rootInfo().empty()) {
+        handleEvents();
+    }
     updateState(m_integ->solution());
     return m_time;
 }
 
+void ReactorNet::solveSteady(int loglevel)
+{
+    if (!m_init) {
+        initialize();
+    }
+    if (!m_reactors[0]->isOde()) {
+        throw CanteraError("ReactorNet::solveSteady",
+                           "Steady-state solution is not supported for DAE systems.");
+    }
+    SteadySolver solver(*this, m_rtolSteady, m_atolSteady);
+    Eigen::VectorXd y(m_nv), y1(m_nv);
+    getState(y.data());
+
+    // Alternate between Newton iterations on the steady-state equations and
+    // groups of pseudo-transient (backward Euler) steps
+    double dt = 1.0e-6;
+    int nTimeSteps = 10;
+    int maxTimeSteps = 1000;
+    int nsteps = 0;
+    while (true) {
+        solver.setTimeStep(0.0, y);
+        y1 = y;
+        int iter = solver.newton(y1, loglevel);
+        if (iter > 0) {
+            y = y1;
+            if (loglevel > 0) {
+                writelog("Steady state found after {} Newton iterations and {} "
+                         "time steps.\n", iter, nsteps);
+            }
+            break;
+        }
+        if (loglevel > 0) {
+            writelog("Newton iteration failed. Taking {} time steps, starting "
+                     "with dt = {:10.4g} s.\n", nTimeSteps, dt);
+        }
+        for (int i = 0; i < nTimeSteps;) {
+            solver.setTimeStep(dt, y);
+            y1 = y;
+            if (solver.newton(y1, loglevel) > 0) {
+                y = y1;
+                dt *= 2.0;
+                i++;
+                if (++nsteps >= maxTimeSteps) {
+                    throw CanteraError("ReactorNet::solveSteady", "Failed to "
+                        "find a steady state after {} time steps.", nsteps);
+                }
+            } else {
+                dt *= 0.5;
+                if (dt < 1.0e-20) {
+                    throw CanteraError("ReactorNet::solveSteady",
+                                       "Time step became too small.");
+                }
+            }
+        }
+    }
+    updateState(y.data());
+    m_integrator_init = false;
+}
+
+size_t ReactorNet::solveSteadyContinuation(const function<void(double)>& setParameter,
+    double p0, double p1, double pmin, double pmax,
+    const function<bool(double)>& callback, size_t maxPoints)
+{
+    if (p0 <= 0.0 || p1 <= 0.0 || p0 == p1) {
+        throw CanteraError("ReactorNet::solveSteadyContinuation",
+            "Parameter values must be positive and distinct; got {} and {}.",
+            p0, p1);
+    } else if (p0 < pmin || p0 > pmax) {
+        throw CanteraError("ReactorNet::solveSteadyContinuation",
+            "Initial parameter value {} is outside the range [{}, {}].",
+            p0, pmin, pmax);
+    }
+    setParameter(p0);
+    solveSteady();
+    size_t npoints = 1;
+    if (!callback(p0) || maxPoints < 2) {
+        return npoints;
+    }
+
+    SteadySolver solver(*this, m_rtolSteady, m_atolSteady, &setParameter);
+    Eigen::VectorXd xc(m_nv + 1), x(m_nv + 1), tangent, w;
+    getState(xc.data());
+    xc[m_nv] = log(p0);
+    if (!solver.tangent(xc, tangent)) {
+        throw CanteraError("ReactorNet::solveSteadyContinuation",
+                           "Unable to evaluate the initial tangent.");
+    }
+    double dq0 = log(p1 / p0);
+    tangent *= dq0;
+    solver.weights(xc, w);
+    double ds0 = w.cwiseProduct(tangent).norm();
+    double ds = ds0;
+    tangent /= ds0;
+
+    while (npoints < maxPoints) {
+        solver.setArclength(xc, tangent, w, ds);
+        x = xc + ds * tangent;
+        int iter = solver.newton(x, 0);
+        if (iter < 0) {
+            ds *= 0.5;
+            if (ds < 1e-6 * ds0) {
+                solver.applyParameter(xc[m_nv]);
+                updateState(xc.data());
+                throw CanteraError("ReactorNet::solveSteadyContinuation",
+                    "Continuation failed at parameter value {}.", exp(xc[m_nv]));
+            }
+            continue;
+        }
+        double p = exp(x[m_nv]);
+        if (p < pmin || p > pmax) {
+            break;
+        }
+
+        // Secant approximation of the tangent at the new solution
+        tangent = x - xc;
+        solver.weights(x, w);
+        tangent /= w.cwiseProduct(tangent).norm();
+        xc = x;
+        if (iter < 5) {
+            ds *= 1.5;
+        }
+        if (tangent[m_nv] != 0.0) {
+            ds = std::min(ds, std::abs(dq0 / tangent[m_nv]));
+        }
+
+        solver.applyParameter(xc[m_nv]);
+        updateState(xc.data());
+        npoints++;
+        if (!callback(p)) {
+            break;
+        }
+    }
+    solver.applyParameter(xc[m_nv]);
+    updateState(xc.data());
+    m_integrator_init = false;
+    return npoints;
+}
+
+void ReactorNet::setSteadyTolerances(double rtol, double atol)
+{
+    if (rtol >= 0.0) {
+        m_rtolSteady = rtol;
+    }
+    if (atol >= 0.0) {
+        m_atolSteady = atol;
+    }
+}
+
+size_t ReactorNet::addEvent(const string& name,
+    const function<double(double, const double*, const double*)>& func,
+    int direction, bool terminal)
+{
+    Event event;
+    event.name = name;
+    event.func = func;
+    event.direction = direction;
+    event.terminal = terminal;
+    m_events.push_back(event);
+    // The integrator needs to be set up for the new number of root functions
+    m_init = false;
+    return m_events.size() - 1;
+}
+
+size_t ReactorNet::addRateMaximumEvent(const string& name, size_t k, bool terminal)
+{
+    Event event;
+    event.name = name;
+    event.component = k;
+    // At a maximum, the second derivative decreases through zero
+    event.direction = -1;
+    event.terminal = terminal;
+    m_events.push_back(event);
+    m_init = false;
+    return m_events.size() - 1;
+}
+
+void ReactorNet::clearEvents()
+{
+    m_events.clear();
+    m_lastEvent = npos;
+    m_init = false;
+}
+
+void ReactorNet::getRootDirections(int* dirs) const
+{
+    for (size_t i = 0; i < m_events.size(); i++) {
+        dirs[i] = m_events[i].direction;
+    }
+}
+
+void ReactorNet::evalRootFunctions(double t, double* y, double* gout)
+{
+    eval(t, y, m_ydot.data(), m_sens_params.data());
+    bool rateEvents = false;
+    for (size_t i = 0; i < m_events.size(); i++) {
+        if (m_events[i].component == npos) {
+            gout[i] = m_events[i].func(t, y, m_ydot.data());
+        } else {
+            rateEvents = true;
+        }
+    }
+    if (!rateEvents) {
+        return;
+    }
+
+    // Second derivatives are approximated by differencing the right-hand side
+    // along the solution trajectory, with a step that changes the component of
+    // interest by a small fraction of its magnitude.
+    m_yevent.resize(m_nv);
+    m_ydotevent.resize(m_nv);
+    double sqrtEps = sqrt(std::numeric_limits<double>::epsilon());
+    for (size_t i = 0; i < m_events.size(); i++) {
+        size_t k = m_events[i].component;
+        if (k == npos) {
+            continue;
+        } else if (k >= m_nv) {
+            throw IndexError("ReactorNet::evalRootFunctions", "state vector",
+                             k, m_nv - 1);
+        }
+        double h;
+        if (m_ydot[k] != 0.0) {
+            h = sqrtEps * (std::abs(y[k]) + m_atol[k] / m_rtol) / std::abs(m_ydot[k]);
+        } else {
+            h = sqrtEps * std::max(std::abs(t), 1.0);
+        }
+        for (size_t j = 0; j < m_nv; j++) {
+            m_yevent[j] = y[j] + h * m_ydot[j];
+        }
+        eval(t + h, m_yevent.data(), m_ydotevent.data(), m_sens_params.data());
+        gout[i] = (m_ydotevent[k] - m_ydot[k]) / h;
+    }
+    // Restore the state of the reactors
+    m_time = t;
+    updateState(y);
+}
+
+bool ReactorNet::handleEvents()
+{
+    const vector<int>& info = m_integ->rootInfo();
+    // Crossings in the wrong direction only need to be skipped for integrators
+    // which do not handle the directions set by getRootDirections()
+    bool filter = !m_integ->rootDirectionsSupported();
+    bool stop = false;
+    for (size_t i = 0; i < m_events.size(); i++) {
+        Event& event = m_events[i];
+        if (info[i] == 0 ||
+            (filter && event.direction != 0 && info[i] != event.direction)) {
+            continue;
+        }
+        event.times.push_back(m_time);
+        if (m_verbose) {
+            writelog("Event '{}' at t = {:.10g}\n", event.name, m_time);
+        }
+        if (event.terminal && !stop) {
+            m_lastEvent = i;
+            stop = true;
+        }
+    }
+    return stop;
+}
+
 void ReactorNet::getEstimate(double time, int k, double* yest)
 {
     if (!m_init) {
@@ -299,11 +1035,10 @@ void ReactorNet::addReactor(Reactor& r)
     r.setNetwork(this);
     m_reactors.push_back(&r);
     if (!m_integ) {
-        m_integ.reset(newIntegrator(r.isOde() ? "CVODE" : "IDA"));
-        // use backward differencing, with a full Jacobian computed
-        // numerically, and use a Newton linear iterator
-        m_integ->setMethod(BDF_Method);
-        m_integ->setLinearSolverType("DENSE");
+        if (m_integratorType.empty()) {
+            m_integratorType = r.isOde() ? "CVODE" : "IDA";
+        }
+        setIntegratorType(m_integratorType);
     }
 }
 
@@ -317,6 +1052,7 @@ Integrator& ReactorNet::integrator() {
 
 void ReactorNet::eval(double t, double* y, double* ydot, double* p)
 {
+    CT_PROFILE_ZONE("ReactorNet::eval");
     m_time = t;
     updateState(y);
     m_LHS.assign(m_nv, 1);
@@ -340,6 +1076,7 @@ void ReactorNet::eval(double t, double* y, double* ydot, double* p)
 
 void ReactorNet::evalDae(double t, double* y, double* ydot, double* p, double* residual)
 {
+    CT_PROFILE_ZONE("ReactorNet::evalDae");
     m_time = t;
     updateState(y);
     for (size_t n = 0; n < m_reactors.size(); n++) {
@@ -357,6 +1094,190 @@ void ReactorNet::getConstraints(double* constraints)
     }
 }
 
+bool ReactorNet::hasJacobian() const
+{
+    for (auto reactor : m_reactors) {
+        if (!reactor->preconditionerSupported()) {
+            return false;
+        }
+    }
+    return !m_reactors.empty();
+}
+
+void ReactorNet::getJacobian(double t, double* y, double* jac)
+{
+    m_time = t;
+    updateState(y);
+    MappedMatrix J(jac, m_nv, m_nv);
+    J.setZero();
+    updateJacobianElements();
+    for (const auto& elem : m_jacElements) {
+        J(elem.row(), elem.col()) += elem.value();
+    }
+}
+
+void ReactorNet::updateJacobianElements()
+{
+    m_jacElements.clear();
+    for (size_t n = 0; n < m_reactors.size(); n++) {
+        size_t first = m_jacElements.size();
+        m_reactors[n]->getJacobianElements(m_jacElements);
+        int offset = static_cast<int>(m_start[n]);
+        for (size_t i = first; i < m_jacElements.size(); i++) {
+            auto& elem = m_jacElements[i];
+            elem = Eigen::Triplet<double>(elem.row() + offset, elem.col() + offset,
+                                          elem.value());
+        }
+    }
+}
+
+vector<double> ReactorNet::adjointSensitivities(
+    double tf, const function<void(const double*, double*)>& dgdy,
+    size_t checkpointSteps, bool finiteDifferences)
+{
+    if (!m_init) {
+        initialize();
+    } else if (!m_integrator_init) {
+        reinitialize();
+    }
+    if (!m_reactors[0]->isOde()) {
+        throw CanteraError("ReactorNet::adjointSensitivities",
+                           "Adjoint sensitivities are not supported for DAE systems.");
+    } else if (tf < m_time) {
+        throw CanteraError("ReactorNet::adjointSensitivities",
+            "Final time {} precedes the current time {}.", tf, m_time);
+    } else if (checkpointSteps == 0) {
+        throw CanteraError("ReactorNet::adjointSensitivities",
+                           "Number of steps between checkpoints must be positive.");
+    }
+
+    // Forward integration, storing the solution every 'checkpointSteps' steps and
+    // at the final time
+    vector<double> checkTimes{m_time};
+    vector<double> checkStates(m_integ->solution(), m_integ->solution() + m_nv);
+    vector<double> yprev(m_nv);
+    size_t nSteps = 0;
+    while (m_time < tf) {
+        double tprev = m_time;
+        std::copy(m_integ->solution(), m_integ->solution() + m_nv, yprev.begin());
+        step();
+        if (m_time > tf) {
+            // Repeat the last step, stopping at the final time
+            m_time = tprev;
+            updateState(yprev.data());
+            reinitialize();
+            advance(tf);
+        }
+        if (++nSteps % checkpointSteps == 0 || m_time >= tf) {
+            checkTimes.push_back(m_time);
+            checkStates.insert(checkStates.end(), m_integ->solution(),
+                               m_integ->solution() + m_nv);
+        }
+    }
+
+    // Recompute the solution and its derivative at each step between checkpoints
+    // c-1 and c, starting from the stored solution at checkpoint c-1
+    vector<double> times, states, rates;
+    auto store = [&]() {
+        times.push_back(m_time);
+        size_t i = states.size();
+        states.resize(i + m_nv);
+        rates.resize(i + m_nv);
+        std::copy(m_integ->solution(), m_integ->solution() + m_nv, &states[i]);
+        eval(m_time, &states[i], &rates[i], m_sens_params.data());
+    };
+    auto recompute = [&](size_t c) {
+        times.clear();
+        states.clear();
+        rates.clear();
+        m_time = checkTimes[c-1];
+        updateState(&checkStates[(c-1) * m_nv]);
+        reinitialize();
+        store();
+        while (m_time < checkTimes[c]) {
+            step();
+            if (m_time > checkTimes[c]) {
+                m_time = times.back();
+                updateState(&states[states.size() - m_nv]);
+                reinitialize();
+                advance(checkTimes[c]);
+            }
+            store();
+        }
+    };
+
+    vector<double> lambda0(m_nv);
+    dgdy(&checkStates[checkStates.size() - m_nv], lambda0.data());
+    double scale = 0.0;
+    for (double v : lambda0) {
+        scale = std::max(scale, std::abs(v));
+    }
+    JacobianElements jacElements;
+    if (!finiteDifferences && hasJacobian()) {
+        jacElements = [this]() -> const vector<Eigen::Triplet<double>>& {
+            updateJacobianElements();
+            return m_jacElements;
+        };
+    }
+    AdjointSystem adjoint(*this, tf, times, states, rates, lambda0, m_atol, m_rtol,
+                          jacElements);
+    adjoint.suppressErrors(true);
+    unique_ptr<Integrator> integ(newIntegrator(m_integratorType));
+    integ->setMethod(BDF_Method);
+    integ->setLinearSolverType("DENSE");
+    integ->setTolerances(m_rtolsens, m_atolsens * (scale > 0 ? scale : 1.0));
+    integ->initialize(0.0, adjoint);
+
+    // Simpson's rule quadrature of lambda^T d(ydot)/dp over each step of the
+    // forward solution, integrating the adjoint equations backward in time
+    size_t np = 0;
+    vector<size_t> offsets;
+    for (auto r : m_reactors) {
+        offsets.push_back(np);
+        np += r->nReactions();
+    }
+    vector<double> sens(np, 0.0);
+    vector<double> dmult(np);
+    vector<double> dmultEnd(np); // integrand at the end of the current step
+    auto integrand = [&](double t, vector<double>& out) {
+        adjoint.setNetworkState(t);
+        double* lambda = integ->solution();
+        for (size_t n = 0; n < m_reactors.size(); n++) {
+            m_reactors[n]->getMultiplierDerivatives(lambda + m_start[n],
+                                                    out.data() + offsets[n]);
+        }
+    };
+    auto accumulate = [&](double weight, const vector<double>& values) {
+        for (size_t i = 0; i < np; i++) {
+            sens[i] += weight * values[i];
+        }
+    };
+    for (size_t c = checkTimes.size() - 1; c > 0; c--) {
+        recompute(c);
+        adjoint.invalidateJacobian();
+        if (c == checkTimes.size() - 1) {
+            integrand(tf, dmultEnd);
+        }
+        for (size_t i = times.size() - 1; i > 0; i--) {
+            double h = times[i] - times[i-1];
+            accumulate(h / 6, dmultEnd);
+            double tmid = times[i-1] + 0.5 * h;
+            integ->integrate(tf - tmid);
+            integrand(tmid, dmult);
+            accumulate(4 * h / 6, dmult);
+            integ->integrate(tf - times[i-1]);
+            integrand(times[i-1], dmultEnd);
+            accumulate(h / 6, dmultEnd);
+        }
+    }
+
+    // Restore the state of the network at the final time
+    m_time = tf;
+    updateState(&checkStates[checkStates.size() - m_nv]);
+    m_integrator_init = false;
+    return sens;
+}
+
 double ReactorNet::sensitivity(size_t k, size_t p)
 {
     if (!m_init) {
@@ -544,14 +1465,9 @@ void ReactorNet::preconditionerSetup(double t, double* y, double gamma)
     // update network with adjusted state
     updateState(yCopy.data());
     // Get jacobians and give elements to preconditioners
-    for (size_t i = 0; i < m_reactors.size(); i++) {
-        Eigen::SparseMatrix<double> rJac = m_reactors[i]->jacobian();
-        for (int k=0; k<rJac.outerSize(); ++k) {
-            for (Eigen::SparseMatrix<double>::InnerIterator it(rJac, k); it; ++it) {
-                precon->setValue(it.row() + m_start[i], it.col() + m_start[i],
-                    it.value());
-            }
-        }
+    updateJacobianElements();
+    for (const auto& elem : m_jacElements) {
+        precon->setValue(elem.row(), elem.col(), elem.value());
     }
     // post reactor setup operations
     precon->setup();
@@ -0,0 +1,90 @@
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "benchmarks.h"
+#include "cantera/kinetics/Reaction.h"
+
+using namespace Cantera;
+
+//! Evaluate a single rate expression of the given type (or falloff sub-type), taken
+//! from the first matching reaction in the input file.
+static void rateConstant(benchmark::State& state, const string& infile,
+                         const string& type)
+{
+    auto sol = newSolution(infile, "", "none");
+    auto kin = sol->kinetics();
+    shared_ptr<ReactionRate> rate;
+    for (size_t i = 0; i < kin->nReactions(); i++) {
+        auto candidate = kin->reaction(i)->rate();
+        if (candidate->type() == type || candidate->subType() == type) {
+            rate = candidate;
+            break;
+        }
+    }
+    if (!rate) {
+        state.SkipWithError(("No reaction of type " + type).c_str());
+        return;
+    }
+    // Rates depending on pressure or third-body concentration take an extra argument
+    bool pressure = (type == "pressure-dependent-Arrhenius" || type == "Chebyshev");
+    bool falloff = (rate->type() == "falloff");
+    double T = 1000.0;
+    for (auto _ : state) {
+        T = (T < 2000.0) ? T + 0.1 : 1000.0;
+        if (pressure) {
+            benchmark::DoNotOptimize(rate->eval(T, OneAtm));
+        } else if (falloff) {
+            benchmark::DoNotOptimize(rate->eval(T, 0.01));
+        } else {
+            benchmark::DoNotOptimize(rate->eval(T));
+        }
+    }
+}
+BENCHMARK_CAPTURE(rateConstant, Arrhenius, "gri30.yaml", "Arrhenius");
+BENCHMARK_CAPTURE(rateConstant, Troe, "gri30.yaml", "Troe");
+BENCHMARK_CAPTURE(rateConstant, Lindemann, "gri30.yaml", "Lindemann");
+BENCHMARK_CAPTURE(rateConstant, SRI, "sri-falloff.yaml", "SRI");
+BENCHMARK_CAPTURE(rateConstant, Plog, "pdep-test.yaml", "pressure-dependent-Arrhenius");
+BENCHMARK_CAPTURE(rateConstant, Chebyshev, "pdep-test.yaml", "Chebyshev");
+
+//! Evaluate forward rate constants of all reactions in a mechanism
+static void fwdRateConstants(benchmark::State& state, const string& mech)
+{
+    auto sol = benchmarkSolution(mech);
+    auto gas = sol->thermo();
+    auto kin = sol->kinetics();
+    vector<double> kf(kin->nReactions());
+    double T = gas->temperature();
+    double P = gas->pressure();
+    size_t n = 0;
+    for (auto _ : state) {
+        // Perturb the state to bypass caching of rate constants
+        gas->setState_TP(T + 1e-5 * (n++ % 1000), P);
+        kin->getFwdRateConstants(kf.data());
+        benchmark::DoNotOptimize(kf.data());
+    }
+    state.counters["reactions"] = kin->nReactions();
+}
+BENCHMARK_CAPTURE(fwdRateConstants, gri30, "gri30");
+BENCHMARK_CAPTURE(fwdRateConstants, large, "large");
+
+//! Evaluate net rates of progress (BulkKinetics::updateROP) of all reactions in a
+//! mechanism
+static void updateROP(benchmark::State& state, const string& mech)
+{
+    auto sol = benchmarkSolution(mech);
+    auto gas = sol->thermo();
+    auto kin = sol->kinetics();
+    vector<double> ropnet(kin->nReactions());
+    double T = gas->temperature();
+    double P = gas->pressure();
+    size_t n = 0;
+    for (auto _ : state) {
+        gas->setState_TP(T + 1e-5 * (n++ % 1000), P);
+        kin->getNetRatesOfProgress(ropnet.data());
+        benchmark::DoNotOptimize(ropnet.data());
+    }
+    state.counters["reactions"] = kin->nReactions();
+}
+BENCHMARK_CAPTURE(updateROP, gri30, "gri30");
+BENCHMARK_CAPTURE(updateROP, large, "large");
@@ -0,0 +1,66 @@
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "benchmarks.h"
+#include "cantera/onedim.h"
+#include "cantera/oneD/DomainFactory.h"
+
+using namespace Cantera;
+
+//! Solve a freely propagating, stoichiometric methane/air flame at 1 atm, starting
+//! from a coarse initial grid and using grid refinement
+static void freeFlame(benchmark::State& state)
+{
+    auto sol = benchmarkSolution("gri30", "mixture-averaged");
+    auto gas = sol->thermo();
+    size_t nsp = gas->nSpecies();
+    double T0 = 300.0;
+    double uin = 0.3;
+    gas->setState_TP(T0, OneAtm);
+    vector<double> X(nsp), Yin(nsp), Yout(nsp);
+    gas->getMoleFractions(X.data());
+    gas->getMassFractions(Yin.data());
+    double rhoIn = gas->density();
+    gas->equilibrate("HP");
+    gas->getMassFractions(Yout.data());
+    double rhoOut = gas->density();
+    double Tad = gas->temperature();
+
+    size_t points = 0;
+    double flameSpeed = 0.0;
+    for (auto _ : state) {
+        gas->setState_TPX(T0, OneAtm, X.data());
+        auto flow = newDomain<StFlow>("gas-flow", sol, "flow");
+        flow->setFreeFlow();
+        vector<double> z{0.0, 0.02, 0.04, 0.06, 0.08, 0.1};
+        flow->setupGrid(z.size(), z.data());
+        auto inlet = newDomain<Inlet1D>("inlet", sol);
+        auto outlet = newDomain<Outlet1D>("outlet", sol);
+        vector<shared_ptr<Domain1D>> domains{inlet, flow, outlet};
+        Sim1D flame(domains);
+
+        vector<double> locs{0.0, 0.3, 0.7, 1.0};
+        double uout = uin * rhoIn / rhoOut;
+        vector<double> values{uin, uin, uout, uout};
+        flame.setInitialGuess("velocity", locs, values);
+        values = {T0, T0, Tad, Tad};
+        flame.setInitialGuess("T", locs, values);
+        for (size_t k = 0; k < nsp; k++) {
+            values = {Yin[k], Yin[k], Yout[k], Yout[k]};
+            flame.setInitialGuess(gas->speciesName(k), locs, values);
+        }
+        // Inlet conditions are set after the initial guess, which overwrites them
+        inlet->setMoleFractions(X.data());
+        inlet->setMdot(uin * rhoIn);
+        inlet->setTemperature(T0);
+        flame.setRefineCriteria(1, 3.0, 0.1, 0.2);
+        flame.setFixedTemperature(0.5 * (T0 + Tad));
+        flow->solveEnergyEqn();
+        flame.solve(0, true);
+        points = flow->nPoints();
+        flameSpeed = flame.value(1, flow->componentIndex("velocity"), 0);
+    }
+    state.counters["points"] = points;
+    state.counters["flame-speed"] = flameSpeed;
+}
+BENCHMARK(freeFlame)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,41 @@
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "benchmarks.h"
+
+using namespace Cantera;
+
+//! Update temperature-dependent species properties (MultiSpeciesThermo::update)
+static void thermoUpdate(benchmark::State& state, const string& mech)
+{
+    auto sol = benchmarkSolution(mech);
+    auto gas = sol->thermo();
+    vector<double> h_RT(gas->nSpecies());
+    double T = gas->temperature();
+    size_t n = 0;
+    for (auto _ : state) {
+        gas->setTemperature(T + 1e-5 * (n++ % 1000));
+        gas->getEnthalpy_RT(h_RT.data());
+        benchmark::DoNotOptimize(h_RT.data());
+    }
+    state.counters["species"] = gas->nSpecies();
+}
+BENCHMARK_CAPTURE(thermoUpdate, gri30, "gri30");
+BENCHMARK_CAPTURE(thermoUpdate, large, "large");
+
+//! Equilibrate a stoichiometric fuel/air mixture at constant enthalpy and pressure
+static void equilibrate(benchmark::State& state, const string& mech)
+{
+    auto sol = benchmarkSolution(mech);
+    auto gas = sol->thermo();
+    vector<double> X(gas->nSpecies());
+    gas->setTemperature(300.0);
+    gas->getMoleFractions(X.data());
+    for (auto _ : state) {
+        gas->setState_TPX(300.0, OneAtm, X.data());
+        gas->equilibrate("HP");
+    }
+    state.counters["species"] = gas->nSpecies();
+}
+BENCHMARK_CAPTURE(equilibrate, gri30, "gri30")->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(equilibrate, large, "large")->Unit(benchmark::kMillisecond);
@@ -0,0 +1,45 @@
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "benchmarks.h"
+
+using namespace Cantera;
+
+//! Evaluate viscosity, thermal conductivity and diffusion coefficients
+static void transportProperties(benchmark::State& state, const string& mech,
+                                const string& model)
+{
+    if (mech == "large" && !customMechanism(mech)) {
+        state.SkipWithError("Default large mechanism has no transport data");
+        return;
+    }
+    auto sol = benchmarkSolution(mech, model);
+    auto gas = sol->thermo();
+    auto tran = sol->transport();
+    size_t nsp = gas->nSpecies();
+    bool multi = (model == "multicomponent");
+    vector<double> D(multi ? nsp * nsp : nsp);
+    double T = gas->temperature();
+    size_t n = 0;
+    for (auto _ : state) {
+        // Perturb the state to bypass caching of temperature-dependent properties
+        gas->setTemperature(T + 1e-5 * (n++ % 1000));
+        benchmark::DoNotOptimize(tran->viscosity());
+        benchmark::DoNotOptimize(tran->thermalConductivity());
+        if (multi) {
+            tran->getMultiDiffCoeffs(nsp, D.data());
+        } else {
+            tran->getMixDiffCoeffs(D.data());
+        }
+        benchmark::DoNotOptimize(D.data());
+    }
+    state.counters["species"] = nsp;
+}
+BENCHMARK_CAPTURE(transportProperties, mixture_averaged_gri30,
+                  "gri30", "mixture-averaged");
+BENCHMARK_CAPTURE(transportProperties, multicomponent_gri30,
+                  "gri30", "multicomponent");
+BENCHMARK_CAPTURE(transportProperties, mixture_averaged_large,
+                  "large", "mixture-averaged");
+BENCHMARK_CAPTURE(transportProperties, multicomponent_large,
+                  "large", "multicomponent");
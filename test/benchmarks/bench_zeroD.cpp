@@ -0,0 +1,36 @@
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "benchmarks.h"
+#include "cantera/zerodim.h"
+
+using namespace Cantera;
+
+//! Integrate the ignition of a stoichiometric fuel/air mixture in a constant pressure
+//! reactor
+static void ignition(benchmark::State& state, const string& mech, double T0,
+                     double P0, double tEnd)
+{
+    auto sol = benchmarkSolution(mech);
+    auto gas = sol->thermo();
+    vector<double> X(gas->nSpecies());
+    gas->getMoleFractions(X.data());
+    size_t steps = 0;
+    for (auto _ : state) {
+        gas->setState_TPX(T0, P0, X.data());
+        IdealGasConstPressureReactor reactor(sol);
+        ReactorNet net;
+        net.addReactor(reactor);
+        while (net.time() < tEnd) {
+            net.step();
+            steps++;
+        }
+    }
+    state.counters["steps"] = benchmark::Counter(
+        static_cast<double>(steps), benchmark::Counter::kAvgIterations);
+    state.counters["species"] = gas->nSpecies();
+}
+BENCHMARK_CAPTURE(ignition, gri30, "gri30", 1200.0, OneAtm, 0.1)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ignition, large, "large", 1000.0, 20 * OneAtm, 0.01)
+    ->Unit(benchmark::kMillisecond);
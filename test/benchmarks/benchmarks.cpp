@@ -0,0 +1,46 @@
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "benchmarks.h"
+#include <cstdlib>
+
+namespace Cantera
+{
+
+namespace {
+
+string getEnv(const char* name, const string& fallback)
+{
+    const char* value = std::getenv(name);
+    return (value && *value) ? value : fallback;
+}
+
+}
+
+bool customMechanism(const string& mech)
+{
+    return mech == "large" && std::getenv("CT_BENCHMARK_MECHANISM");
+}
+
+shared_ptr<Solution> benchmarkSolution(const string& mech, const string& transport)
+{
+    shared_ptr<Solution> sol;
+    string composition;
+    if (mech == "gri30") {
+        sol = newSolution("gri30.yaml", "gri30", transport);
+        composition = "CH4:1.0, O2:2.0, N2:7.52";
+    } else if (mech == "large") {
+        sol = newSolution(getEnv("CT_BENCHMARK_MECHANISM", "nDodecane_Reitz.yaml"),
+                          getEnv("CT_BENCHMARK_PHASE", "nDodecane_IG"), transport);
+        composition = getEnv("CT_BENCHMARK_COMPOSITION",
+                             "c12h26:1.0, o2:18.5, n2:69.56");
+    } else {
+        throw CanteraError("benchmarkSolution", "Unknown mechanism '{}'", mech);
+    }
+    sol->thermo()->setState_TPX(1000.0, OneAtm, composition);
+    return sol;
+}
+
+}
+
+BENCHMARK_MAIN();
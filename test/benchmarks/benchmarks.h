@@ -0,0 +1,33 @@
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_BENCHMARKS_H
+#define CT_BENCHMARKS_H
+
+#include "benchmark/benchmark.h"
+#include "cantera/core.h"
+
+namespace Cantera
+{
+
+//! Create a Solution for one of the mechanisms used by the benchmark suite.
+//!
+//! Available mechanisms are `"gri30"` (GRI-Mech 3.0, methane/air) and `"large"`. By
+//! default, the latter is a reduced n-dodecane mechanism; a different mechanism (for
+//! example, a production mechanism) can be selected using the environment variables
+//! `CT_BENCHMARK_MECHANISM` (input file), `CT_BENCHMARK_PHASE` (phase name) and
+//! `CT_BENCHMARK_COMPOSITION` (mole fractions of a stoichiometric fuel/air mixture).
+//! The returned Solution is set to the stoichiometric mixture at 1000 K and 1 atm.
+//!
+//! @param mech  Name of the mechanism
+//! @param transport  Transport model
+shared_ptr<Solution> benchmarkSolution(const string& mech,
+                                       const string& transport="none");
+
+//! Return `true` if the mechanism is a user-supplied mechanism selected using
+//! `CT_BENCHMARK_MECHANISM`.
+bool customMechanism(const string& mech);
+
+}
+
+#endif
@@ -5,6 +5,8 @@
 #include "cantera/thermo/IdealGasPhase.h"
 #include "cantera/thermo/Species.h"
 #include "cantera/equil/MultiPhase.h"
+#include "cantera/equil/ChemEquil.h"
+#include "cantera/equil/vcs_MultiPhaseEquil.h"
 #include "cantera/base/global.h"
 #include "cantera/base/utilities.h"
 
@@ -310,6 +312,85 @@ TEST_F(PropertyPairs, ChemEquil_UV) { check_UV("element_potential"); }
 // TEST_F(PropertyPairs, MultiPhase_UV) { check_UV("gibbs"); } // not implemented
 TEST_F(PropertyPairs, VcsNonideal_UV) { check_UV("vcs"); }
 
+TEST(ChemEquilWarmStart, adiabatic_flame_sequence)
+{
+    auto gas = newThermo("gri30.yaml");
+    auto ref = newThermo("gri30.yaml");
+    ChemEquil cold;
+    ChemEquil warm;
+    warm.options.contin = true;
+    int coldIters = 0;
+    int warmIters = 0;
+    for (int i = 0; i < 20; i++) {
+        double phi = 0.7 + 0.03 * i;
+        gas->setState_TP(300, OneAtm);
+        gas->setEquivalenceRatio(phi, "CH4:1.0", "O2:1.0, N2:3.76");
+        ref->setState_TPY(300, OneAtm, gas->massFractions());
+        cold.equilibrate(*ref, "HP");
+        coldIters += cold.options.iterations;
+        warm.equilibrate(*gas, "HP");
+        warmIters += warm.options.iterations;
+        EXPECT_TRUE(warm.hasStartSolution());
+        EXPECT_NEAR(gas->temperature(), ref->temperature(), 1e-6 * ref->temperature());
+        EXPECT_NEAR(gas->moleFraction("CO"), ref->moleFraction("CO"), 1e-8);
+    }
+    EXPECT_LT(warmIters, coldIters);
+
+    // Warm start through ThermoPhase::equilibrate
+    gas->setState_TP(300, OneAtm);
+    gas->setEquivalenceRatio(1.0, "CH4:1.0", "O2:1.0, N2:3.76");
+    gas->equilibrate("HP", "element_potential");
+    gas->setState_TP(300, OneAtm);
+    gas->setEquivalenceRatio(1.05, "CH4:1.0", "O2:1.0, N2:3.76");
+    ref->setState_TPY(300, OneAtm, gas->massFractions());
+    gas->equilibrate("HP", "element_potential", 1e-9, 50000, 100, 0, 0, true);
+    ref->equilibrate("HP", "element_potential");
+    EXPECT_NEAR(gas->temperature(), ref->temperature(), 1e-6 * ref->temperature());
+
+    // Warm start with different elements present falls back to a cold start
+    gas->setState_TPX(1500, OneAtm, "H2:1.0, O2:0.5");
+    ref->setState_TPX(1500, OneAtm, "H2:1.0, O2:0.5");
+    gas->equilibrate("TP", "element_potential", 1e-9, 50000, 100, 0, 0, true);
+    ref->equilibrate("TP", "element_potential");
+    EXPECT_NEAR(gas->moleFraction("H2O"), ref->moleFraction("H2O"), 1e-8);
+}
+
+TEST(MultiPhaseEquil, vcs_solver_reuse)
+{
+    vector<string> names = {"KOH_plasma", "K_solid", "K_liquid", "KOH_a", "KOH_b",
+        "KOH_liquid", "K2O2_solid", "K2O_solid", "KO2_solid", "ice", "liquid_water"};
+    vector<shared_ptr<ThermoPhase>> phases;
+    MultiPhase mix, ref;
+    for (const auto& name : names) {
+        phases.push_back(newThermo("KOH.yaml", name));
+        mix.addPhase(phases.back().get(), 0.0);
+        phases.push_back(newThermo("KOH.yaml", name));
+        ref.addPhase(phases.back().get(), 0.0);
+    }
+    mix.init();
+    ref.init();
+    vector<string> comps = {"K:1.03, H2:2.12, O2:0.9", "K:0.5, H2:2.0, O2:1.5",
+                            "K:2, H2:1, O2:0.3"};
+    for (int i = 0; i < 24; i++) {
+        for (auto* m : {&mix, &ref}) {
+            m->setTemperature(350 + 100 * i);
+            m->setPressure(OneAtm);
+            m->setMolesByName(comps[i % 3]);
+        }
+        // The solver held by 'mix' is reused, while 'ref' uses a new one each time
+        mix.equilibrate("TP", "vcs", 1e-9, 1000);
+        vcs_MultiPhaseEquil eq(&ref, 0);
+        ASSERT_EQ(eq.equilibrate(TP, 0, 0, 1e-9, 1000), 0);
+        for (size_t k = 0; k < mix.nSpecies(); k++) {
+            EXPECT_NEAR(mix.speciesMoles(k), ref.speciesMoles(k), 1e-10);
+        }
+    }
+    AnyMap stats = mix.solverStats();
+    EXPECT_EQ(stats["solves"].asInt(), 24);
+    EXPECT_GT(stats["iterations"].asInt(), 24);
+    EXPECT_GE(stats["TP_time"].asDouble(), 0.0);
+}
+
 int main(int argc, char** argv)
 {
     printf("Running main() from equil_gas.cpp\n");
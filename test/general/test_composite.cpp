@@ -1,6 +1,9 @@
 #include "gtest/gtest.h"
 #include "cantera/base/Interface.h"
 #include "cantera/base/SolutionArray.h"
+#include "cantera/base/Storage.h"
+#include <fstream>
+#include <thread>
 
 using namespace Cantera;
 
@@ -29,6 +32,44 @@ TEST(Interface, from_AnyMap_and_Solution)
     ASSERT_EQ(surf->kinetics()->nReactions(), 24u);
 }
 
+TEST(Interface, concurrent_newSolution)
+{
+    auto ref = newSolution("gri30.yaml", "", "none");
+    ref->thermo()->setState_TPX(1200., OneAtm, "CH4:1, O2:2, N2:7.52");
+    vector<double> ropRef(ref->kinetics()->nReactions());
+    ref->kinetics()->getFwdRatesOfProgress(ropRef.data());
+
+    // Each thread reads the same cached input file
+    size_t nThreads = 4;
+    vector<vector<double>> rop(nThreads);
+    vector<std::exception_ptr> failures(nThreads);
+    vector<std::thread> workers;
+    for (size_t i = 0; i < nThreads; i++) {
+        workers.emplace_back([&, i]() {
+            try {
+                for (int j = 0; j < 3; j++) {
+                    auto sol = newSolution("gri30.yaml", "", "none");
+                    sol->thermo()->setState_TPX(1200., OneAtm,
+                                                "CH4:1, O2:2, N2:7.52");
+                    rop[i].resize(sol->kinetics()->nReactions());
+                    sol->kinetics()->getFwdRatesOfProgress(rop[i].data());
+                }
+            } catch (...) {
+                failures[i] = std::current_exception();
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    for (size_t i = 0; i < nThreads; i++) {
+        if (failures[i]) {
+            std::rethrow_exception(failures[i]);
+        }
+        EXPECT_EQ(rop[i], ropRef);
+    }
+}
+
 TEST(SolutionArray, empty)
 {
     shared_ptr<Solution> gas;
@@ -126,6 +167,284 @@ TEST(SolutionArray, normalize)
     }
 }
 
+TEST(SolutionArray, equilibrate)
+{
+    auto gas = newSolution("gri30.yaml", "", "none");
+    auto phase = gas->thermo();
+    int n = 12;
+    auto arr = SolutionArray::create(gas, n);
+    vector<vector<double>> expected(n);
+    for (int loc = 0; loc < n; loc++) {
+        phase->setState_TP(300.0, OneAtm);
+        phase->setEquivalenceRatio(0.5 + 0.1 * loc, "CH4", "O2:1.0, N2:3.76");
+        arr->updateState(loc);
+    }
+
+    // Reference solutions obtained serially
+    auto ref = newSolution("gri30.yaml", "", "none")->thermo();
+    for (int loc = 0; loc < n; loc++) {
+        ref->restoreState(arr->getState(loc));
+        ref->equilibrate("HP");
+        ref->saveState(expected[loc]);
+    }
+
+    auto errors = arr->equilibrate("HP", "auto", 1e-9, 50000, 100, 0, 3);
+    ASSERT_EQ(errors.size(), static_cast<size_t>(n));
+    for (int loc = 0; loc < n; loc++) {
+        EXPECT_EQ(errors[loc], "");
+        auto state = arr->getState(loc);
+        EXPECT_NEAR(state[0], expected[loc][0], 1e-6 * expected[loc][0]);
+        EXPECT_NEAR(state[1], expected[loc][1], 1e-6 * expected[loc][1]);
+        for (size_t k = 0; k < phase->nSpecies(); k++) {
+            EXPECT_NEAR(state[k+2], expected[loc][k+2], 1e-8);
+        }
+    }
+
+    // Failures are reported for each entry, leaving the state unchanged
+    auto before = arr->getState(2);
+    errors = arr->equilibrate("HP", "foo", 1e-9, 50000, 100, 0, 2);
+    for (int loc = 0; loc < n; loc++) {
+        EXPECT_NE(errors[loc].find("Invalid solver"), string::npos);
+    }
+    auto after = arr->getState(2);
+    for (size_t i = 0; i < before.size(); i++) {
+        EXPECT_EQ(after[i], before[i]);
+    }
+}
+
+TEST(SolutionArray, componentView)
+{
+    auto gas = newSolution("h2o2.yaml", "", "none");
+    auto arr = SolutionArray::create(gas, 5);
+    auto T = arr->componentView("T");
+    auto H2 = arr->componentView("H2");
+    ASSERT_EQ(T.size(), 5u);
+    for (size_t k = 0; k < T.size(); k++) {
+        T[k] = 300.0 + 100.0 * k;
+        H2[k] = 0.1 * k;
+    }
+    auto temperature = arr->getComponent("T").asVector<double>();
+    auto massFraction = arr->getComponent("H2").asVector<double>();
+    for (size_t k = 0; k < T.size(); k++) {
+        EXPECT_DOUBLE_EQ(temperature[k], 300.0 + 100.0 * k);
+        EXPECT_DOUBLE_EQ(massFraction[k], 0.1 * k);
+    }
+
+    // Views of sliced arrays refer to the shared data
+    auto sliced = arr->share({1, 3});
+    auto T2 = sliced->componentView("T");
+    ASSERT_EQ(T2.size(), 2u);
+    EXPECT_DOUBLE_EQ(T2[1], 600.0);
+    T2[1] = 650.0;
+    EXPECT_DOUBLE_EQ(T[3], 650.0);
+
+    EXPECT_THROW(arr->componentView("Y"), CanteraError);
+    EXPECT_THROW(arr->componentView("spam"), CanteraError);
+}
+
+TEST(SolutionArray, getProperty)
+{
+    auto gas = newSolution("h2o2.yaml", "", "none");
+    auto phase = gas->thermo();
+    auto kin = gas->kinetics();
+    int n = 20;
+    auto arr = SolutionArray::create(gas, n);
+    for (int loc = 0; loc < n; loc++) {
+        phase->setState_TPX(800.0 + 50.0 * loc, OneAtm, "H2:2, O2:1, AR:5, OH:0.01");
+        arr->updateState(loc);
+    }
+    arr->setLoc(3);
+
+    size_t nsp = phase->nSpecies();
+    size_t nr = kin->nReactions();
+    for (size_t nThreads : {1, 3}) {
+        auto rho = arr->getProperty("density", nThreads);
+        auto cp = arr->getProperty("cp_mass", nThreads);
+        auto X = arr->getProperty("X", nThreads);
+        auto wdot = arr->getProperty("net_production_rates", nThreads);
+        auto rop = arr->getProperty("net_rates_of_progress", nThreads);
+        auto hrr = arr->getProperty("heat_release_rate", nThreads);
+        ASSERT_EQ(rho.size(), static_cast<size_t>(n));
+        ASSERT_EQ(X.size(), n * nsp);
+        ASSERT_EQ(wdot.size(), n * nsp);
+        ASSERT_EQ(rop.size(), n * nr);
+        ASSERT_EQ(hrr.size(), static_cast<size_t>(n));
+
+        vector<double> Xref(nsp), wdotRef(nsp), ropRef(nr), dH(nr);
+        for (int loc = 0; loc < n; loc++) {
+            arr->setLoc(loc);
+            EXPECT_DOUBLE_EQ(rho[loc], phase->density());
+            EXPECT_DOUBLE_EQ(cp[loc], phase->cp_mass());
+            phase->getMoleFractions(Xref.data());
+            kin->getNetProductionRates(wdotRef.data());
+            kin->getNetRatesOfProgress(ropRef.data());
+            kin->getDeltaEnthalpy(dH.data());
+            double hrrRef = 0.0;
+            for (size_t i = 0; i < nr; i++) {
+                EXPECT_DOUBLE_EQ(rop[loc * nr + i], ropRef[i]);
+                hrrRef -= ropRef[i] * dH[i];
+            }
+            for (size_t k = 0; k < nsp; k++) {
+                EXPECT_DOUBLE_EQ(X[loc * nsp + k], Xref[k]);
+                EXPECT_DOUBLE_EQ(wdot[loc * nsp + k], wdotRef[k]);
+            }
+            EXPECT_NEAR(hrr[loc], hrrRef, 1e-12 * std::abs(hrrRef));
+        }
+        // The phase is left in the state of the buffered location
+        arr->setLoc(3);
+        arr->getProperty("T", nThreads);
+        EXPECT_DOUBLE_EQ(phase->temperature(), 950.0);
+    }
+
+    EXPECT_THROW(arr->getProperty("spam"), CanteraError);
+    auto noKinetics = SolutionArray::create(newSolution("h2o2.yaml", "", "none"), 2);
+    noKinetics->solution()->setKinetics(nullptr);
+    EXPECT_THROW(noKinetics->getProperty("net_production_rates"), CanteraError);
+}
+
+#if CT_USE_HDF5
+
+TEST(SolutionArray, appendEntry)
+{
+    const string fname = "appendEntry.h5";
+    if (std::ifstream(fname).good()) {
+        std::remove(fname.c_str());
+    }
+    auto gas = newSolution("h2o2.yaml", "", "none");
+    auto phase = gas->thermo();
+    auto arr = SolutionArray::create(gas, 0);
+    arr->addExtra("time");
+    arr->meta()["spam"] = "eggs";
+    vector<double> state;
+    AnyMap extra;
+    for (int batch = 0; batch < 3; batch++) {
+        for (int i = 0; i < 4; i++) {
+            phase->setState_TP(300. + 10. * (4 * batch + i), OneAtm);
+            phase->saveState(state);
+            extra["time"] = 0.1 * (4 * batch + i);
+            arr->append(state, extra);
+        }
+        arr->appendEntry(fname, "history", "", 5, 3);
+        arr->resize(0);
+        if (batch == 1) {
+            // rows left behind by an interrupted append are overwritten
+            Storage file(fname, true);
+            AnyValue stray;
+            stray = vector<double>({-1., -2.});
+            file.appendData("history/data", "T", stray);
+        }
+    }
+
+    auto restored = SolutionArray::create(gas);
+    restored->readEntry(fname, "history", "");
+    ASSERT_EQ(restored->size(), 12);
+    EXPECT_EQ(restored->meta()["spam"].asString(), "eggs");
+    auto T = restored->getComponent("T").asVector<double>();
+    auto time = restored->getComponent("time").asVector<double>();
+    for (size_t i = 0; i < 12; i++) {
+        EXPECT_DOUBLE_EQ(T[i], 300. + 10. * i);
+        EXPECT_DOUBLE_EQ(time[i], 0.1 * i);
+    }
+
+    // components need to match
+    auto other = SolutionArray::create(gas, 2);
+    EXPECT_THROW(other->appendEntry(fname, "history", ""), CanteraError);
+}
+
+TEST(SolutionArray, partialRead)
+{
+    const string fname = "partialRead.h5";
+    if (std::ifstream(fname).good()) {
+        std::remove(fname.c_str());
+    }
+    auto gas = newSolution("h2o2.yaml", "", "none");
+    auto phase = gas->thermo();
+    int n = 10;
+    auto arr = SolutionArray::create(gas, n);
+    vector<double> time(n);
+    vector<long int> step(n);
+    for (int loc = 0; loc < n; loc++) {
+        phase->setState_TPX(300. + 10. * loc, OneAtm, "H2:1, O2:1");
+        arr->updateState(loc);
+        time[loc] = 0.1 * loc;
+        step[loc] = loc;
+    }
+    AnyValue any;
+    arr->addExtra("time");
+    any = time;
+    arr->setComponent("time", any);
+    arr->addExtra("step");
+    any = step;
+    arr->setComponent("step", any);
+    arr->save(fname, "solution", "data");
+
+    auto restored = SolutionArray::create(gas);
+    restored->readEntry(fname, "solution", "data", 3, 4, {"time"});
+    ASSERT_EQ(restored->size(), 4);
+    EXPECT_TRUE(restored->hasExtra("time"));
+    EXPECT_FALSE(restored->hasExtra("step"));
+    auto T = restored->getComponent("T").asVector<double>();
+    auto t = restored->getComponent("time").asVector<double>();
+    for (size_t i = 0; i < 4; i++) {
+        EXPECT_DOUBLE_EQ(T[i], 300. + 10. * (i + 3));
+        EXPECT_DOUBLE_EQ(t[i], 0.1 * (i + 3));
+    }
+
+    // all remaining entries and all auxiliary components
+    restored->readEntry(fname, "solution", "data", 7);
+    ASSERT_EQ(restored->size(), 3);
+    EXPECT_EQ(restored->getComponent("step").asVector<long int>()[0], 7);
+
+    EXPECT_THROW(restored->readEntry(fname, "solution", "data", 11), IndexError);
+    EXPECT_THROW(restored->readEntry(fname, "solution", "data", 0, 2, {"spam"}),
+                 CanteraError);
+
+    // selection via restore
+    auto header = restored->restore(fname, "solution", "data", 8, 1, {"step"});
+    ASSERT_EQ(restored->size(), 1);
+    EXPECT_FALSE(restored->hasExtra("time"));
+    EXPECT_EQ(restored->getComponent("step").asVector<long int>()[0], 8);
+    EXPECT_DOUBLE_EQ(restored->getComponent("T").asVector<double>()[0], 380.);
+    EXPECT_TRUE(header.hasKey("generator"));
+}
+
+#endif
+
+TEST(SolutionArray, saveBinaryYaml)
+{
+    auto gas = newSolution("h2o2.yaml", "", "none");
+    auto phase = gas->thermo();
+    size_t n = 2 * SolutionArray::s_binaryThreshold;
+    auto arr = SolutionArray::create(gas, n);
+    for (size_t loc = 0; loc < n; loc++) {
+        phase->setState_TPX(300. + 1.1 * loc, OneAtm, "H2:1, O2:1");
+        arr->updateState(loc);
+    }
+    auto readFile = [](const string& fname) {
+        std::ifstream in(fname);
+        return string(std::istreambuf_iterator<char>(in), {});
+    };
+
+    // compression level does not affect YAML output
+    const string fname = "saveBinaryYaml.yaml";
+    arr->save(fname, "solution", "", "", true, 5);
+    EXPECT_EQ(readFile(fname).find("!binary"), npos);
+
+    arr->save(fname, "solution", "", "", true, 0, "", true);
+    EXPECT_NE(readFile(fname).find("!binary-float64"), npos);
+    auto restored = SolutionArray::create(gas);
+    restored->restore(fname, "solution");
+    ASSERT_EQ(restored->size(), n);
+    auto T = arr->getComponent("T").asVector<double>();
+    auto T2 = restored->getComponent("T").asVector<double>();
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_EQ(T2[i], T[i]);
+    }
+    // partial restore is only supported for HDF
+    EXPECT_THROW(restored->restore(fname, "solution", "", 1, 2), NotImplementedError);
+    std::remove(fname.c_str());
+}
+
 TEST(SolutionArray, meta)
 {
     auto gas = newSolution("h2o2.yaml",  "", "none");
@@ -1,6 +1,8 @@
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 #include "cantera/base/AnyMap.h"
+#include <thread>
+#include <fstream>
 
 using namespace Cantera;
 
@@ -387,6 +389,99 @@ TEST(AnyMap, missingKeyAt)
     }
 }
 
+TEST(AnyMap, cachedFileCopies)
+{
+    AnyMap first = AnyMap::fromYamlFile("h2o2.yaml");
+    first["description"] = "modified";
+    first["species"].getMapWhere("name", "OH")["composition"]["O"].asDouble();
+    first.erase("reactions");
+
+    vector<AnyMap> loaded(4);
+    vector<std::thread> threads;
+    for (size_t i = 0; i < loaded.size(); i++) {
+        threads.emplace_back([&loaded, i]() {
+            loaded[i] = AnyMap::fromYamlFile("h2o2.yaml");
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    for (auto& root : loaded) {
+        EXPECT_NE(root["description"].asString(), "modified");
+        EXPECT_TRUE(root.hasKey("reactions"));
+        auto& O = root["species"].getMapWhere("name", "OH")["composition"]["O"];
+        EXPECT_TRUE(O.is<long int>());
+    }
+}
+
+TEST(AnyMap, sharedYamlFile)
+{
+    auto first = AnyMap::sharedYamlFile("h2o2.yaml");
+    auto second = AnyMap::sharedYamlFile("h2o2.yaml");
+    EXPECT_EQ(first.get(), second.get());
+    EXPECT_TRUE(first->hasKey("reactions"));
+
+    // Conversions of values read from the shared tree do not affect copies
+    auto& OH = first->at("species").getMapWhere("name", "OH");
+    auto& O = OH.at("composition")["O"];
+    O.asDouble();
+    EXPECT_TRUE(O.is<double>());
+    AnyMap copy = AnyMap::fromYamlFile("h2o2.yaml");
+    EXPECT_TRUE(copy["species"].getMapWhere("name", "OH")["composition"]["O"]
+                .is<long int>());
+}
+
+TEST(AnyMap, fileCache)
+{
+    namespace fs = std::filesystem;
+    fs::path cacheDir = "yaml-cache-test";
+    fs::remove_all(cacheDir);
+    AnyMap reference = AnyMap::fromYamlFile("h2o2.yaml");
+    AnyMap::clearCachedFile("h2o2.yaml");
+    AnyMap::setFileCacheDirectory(cacheDir.string());
+
+    AnyMap parsed = AnyMap::fromYamlFile("h2o2.yaml");
+    ASSERT_EQ(std::distance(fs::directory_iterator(cacheDir),
+                            fs::directory_iterator()), 1);
+    fs::path cacheFile = fs::directory_iterator(cacheDir)->path();
+    {
+        // Sizes are stored as 64-bit little-endian integers on all platforms
+        std::ifstream in(cacheFile, std::ios::binary);
+        string header(16, '\0');
+        in.read(header.data(), header.size());
+        EXPECT_EQ(header.substr(0, 8), string("\x08\0\0\0\0\0\0\0", 8));
+        EXPECT_EQ(header.substr(8, 6), "CTYAML");
+    }
+    AnyMap::clearCachedFile("h2o2.yaml");
+    AnyMap loaded = AnyMap::fromYamlFile("h2o2.yaml");
+    EXPECT_EQ(loaded, reference);
+    EXPECT_EQ(loaded.toYamlString(), reference.toYamlString());
+    EXPECT_EQ(loaded["__file__"], reference["__file__"]);
+    auto& OH = loaded["species"].getMapWhere("name", "OH");
+    EXPECT_TRUE(OH["composition"]["O"].is<long int>());
+    try {
+        OH["thermo"]["data"].asVector<double>();
+        FAIL() << "Expected an exception";
+    } catch (std::exception& err) {
+        // Line numbers are retained for error messages
+        EXPECT_THAT(err.what(), ::testing::HasSubstr("|  Line |"));
+    }
+
+    // Invalid cache files are ignored and replaced
+    {
+        std::ofstream out(cacheFile, std::ios::binary);
+        out << "not a cache file";
+    }
+    AnyMap::clearCachedFile("h2o2.yaml");
+    AnyMap reparsed = AnyMap::fromYamlFile("h2o2.yaml");
+    EXPECT_EQ(reparsed, reference);
+    EXPECT_GT(fs::file_size(cacheFile), 1000u);
+
+    AnyMap::setFileCacheDirectory("");
+    AnyMap::clearCachedFile("h2o2.yaml");
+    fs::remove_all(cacheDir);
+}
+
 TEST(AnyMap, dumpYamlString)
 {
     AnyMap original = AnyMap::fromYamlFile("h2o2.yaml");
@@ -443,6 +538,40 @@ TEST(AnyMap, nestedVectorsToYaml)
     EXPECT_EQ(generated["integers"].asVector<vector<long int>>(), integers);
 }
 
+TEST(AnyMap, binaryBlocksToYaml)
+{
+    vector<double> floats;
+    vector<long int> integers;
+    vector<vector<double>> matrix(3);
+    for (size_t i = 0; i < 20; i++) {
+        floats.push_back(std::exp(0.37 * i) / 3.0 - 1e-300);
+        integers.push_back(static_cast<long int>(i * i) - 100);
+        matrix[i % 3].push_back(1.0 / (i + 1));
+    }
+    floats.push_back(-0.0);
+    floats.push_back(std::numeric_limits<double>::infinity());
+    integers.push_back(std::numeric_limits<int32_t>::min());
+    AnyMap original;
+    original["floats"] = floats;
+    original["integers"] = integers;
+    original["matrix"] = matrix;
+    original["short"] = vector<double>{1.0, 2.5};
+    original.setMetadata("binary-threshold", AnyValue(10));
+    string serialized = original.toYamlString();
+    EXPECT_NE(serialized.find("!binary-float64"), string::npos);
+    EXPECT_NE(serialized.find("!binary-int64"), string::npos);
+    EXPECT_NE(serialized.find("short: [1.0, 2.5]"), string::npos);
+
+    AnyMap generated = AnyMap::fromYamlString(serialized);
+    EXPECT_EQ(generated["floats"].asVector<double>(), floats);
+    EXPECT_TRUE(std::signbit(generated["floats"].asVector<double>()[20]));
+    EXPECT_EQ(generated["integers"].asVector<long int>(), integers);
+    EXPECT_EQ(generated["matrix"].asVector<vector<double>>(), matrix);
+    EXPECT_EQ(generated["short"].asVector<double>(), original["short"].asVector<double>());
+
+    EXPECT_THROW(AnyMap::fromYamlString("x: !binary-float64 AAAA"), CanteraError);
+}
+
 TEST(AnyMap, definedKeyOrdering)
 {
     AnyMap m = AnyMap::fromYamlString("{zero: 1, half: 2}");
@@ -3,9 +3,52 @@
 
 #include "gtest/gtest.h"
 #include "cantera/base/global.h"
+#include "cantera/base/Profiler.h"
+#include "cantera/base/AnyMap.h"
+#include <thread>
 
 using namespace Cantera;
 
 TEST(FatalError, stacktrace) {
     EXPECT_DEATH(std::abort(), "Stack trace");
 }
+
+TEST(Profiler, zones) {
+    size_t zone = Profiler::zoneIndex("test-zone");
+    EXPECT_EQ(Profiler::zoneIndex("test-zone"), zone);
+    Profiler::reset();
+    {
+        ProfileZone timer(zone); // not recorded while profiling is disabled
+    }
+    EXPECT_FALSE(Profiler::report().hasKey("test-zone"));
+
+    Profiler::enable();
+    for (size_t i = 0; i < 3; i++) {
+        ProfileZone timer(zone);
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    std::thread worker([zone]() { ProfileZone timer(zone); });
+    worker.join();
+    Profiler::enable(false);
+
+    AnyMap report = Profiler::report();
+    ASSERT_TRUE(report.hasKey("test-zone"));
+    EXPECT_EQ(report["test-zone"]["calls"].asInt(), 4);
+    EXPECT_EQ(report["test-zone"]["threads"].asInt(), 2);
+    EXPECT_GE(report["test-zone"]["time"].asDouble(), 3e-4);
+
+    Profiler::reset();
+    EXPECT_FALSE(Profiler::report().hasKey("test-zone"));
+}
+
+TEST(Profiler, unregisteredZone) {
+    // Zones that could not be registered are never recorded
+    Profiler::reset();
+    Profiler::enable();
+    {
+        ProfileZone timer(npos);
+    }
+    Profiler::record(npos, 1000);
+    Profiler::enable(false);
+    EXPECT_EQ(Profiler::report().size(), 0u);
+}
@@ -717,6 +717,57 @@ TEST(Storage, readCompressed)
     ASSERT_TRUE(data.isMatrix<string>());
 }
 
+TEST(Storage, appendData)
+{
+    // testing Storage class outside of SolutionArray
+    const string fname = "appendData.h5";
+    if (std::ifstream(fname).good()) {
+        std::remove(fname.c_str());
+    }
+    auto file = unique_ptr<Storage>(new Storage(fname, true));
+    file->checkGroup("test", true); // implicitly creates group
+    file->setCompressionLevel(5);
+    EXPECT_THROW(file->setChunkSize(0), CanteraError);
+    file->setChunkSize(2);
+
+    AnyValue any;
+    any = vector<double>({1.1, 2.2, 3.3});
+    file->appendData("test", "double-vector", any);
+    any = vector<double>({4.4, 5.5});
+    file->appendData("test", "double-vector", any);
+    any = vector<string>({"dog"});
+    file->appendData("test", "string-vector", any);
+    any = vector<string>({"cat", "mouse"});
+    file->appendData("test", "string-vector", any);
+    any = vector<vector<long int>>({{1, 2}, {3, 4}, {5, 6}});
+    file->appendData("test", "integer-matrix", any);
+    any = vector<vector<long int>>({{7, 8}});
+    file->appendData("test", "integer-matrix", any);
+    // overwrite the last two rows
+    any = vector<vector<long int>>({{9, 10}, {11, 12}});
+    file->appendData("test", "integer-matrix", any, 2);
+    EXPECT_THROW(file->appendData("test", "integer-matrix", any, 5), CanteraError);
+
+    // number of columns needs to match
+    any = vector<vector<long int>>({{1, 2, 3}});
+    EXPECT_THROW(file->appendData("test", "integer-matrix", any), CanteraError);
+    // irregular shapes and unsupported types
+    any = vector<vector<double>>({{1.1, 2.2}, {3.3}});
+    EXPECT_THROW(file->appendData("test", "invalid0", any), CanteraError);
+    any = vector<bool>({true, false});
+    EXPECT_THROW(file->appendData("test", "invalid1", any), NotImplementedError);
+
+    file = unique_ptr<Storage>(new Storage(fname, false));
+    auto data = file->readData("test", "double-vector", 5);
+    EXPECT_EQ(data.asVector<double>(), vector<double>({1.1, 2.2, 3.3, 4.4, 5.5}));
+    data = file->readData("test", "string-vector", 3);
+    EXPECT_EQ(data.asVector<string>(), vector<string>({"dog", "cat", "mouse"}));
+    data = file->readData("test", "integer-matrix", 4, 2);
+    auto& mat = data.asVector<vector<long int>>();
+    EXPECT_EQ(mat[2], vector<long int>({9, 10}));
+    EXPECT_EQ(mat[3], vector<long int>({11, 12}));
+}
+
 #else
 
 TEST(Storage, noSupport)
@@ -2,6 +2,7 @@
 #include "gmock/gmock.h"
 #include "cantera/base/Units.h"
 #include "cantera/base/AnyMap.h"
+#include <thread>
 
 using namespace Cantera;
 using namespace ::testing;
@@ -35,6 +36,38 @@ TEST(Units, from_string_fail) {
     EXPECT_THROW(Units("0.001 m^3", true), CanteraError);
 }
 
+TEST(Units, from_string_cached) {
+    // Repeated parsing of the same string uses the cached result
+    for (int i = 0; i < 2; i++) {
+        EXPECT_EQ(Units("0.001 m^3").str(), "0.001 m^3");
+        EXPECT_NO_THROW(Units("0.001 m^3"));
+        EXPECT_THROW(Units("0.001 m^3", true), CanteraError);
+        EXPECT_THROW(Units("kg / furlong"), CanteraError);
+    }
+
+    vector<string> names = {"cm^3/mol/s", "kJ/mol", "1/atm", "kmol/m^2", "mg/cm^3"};
+    vector<vector<Units>> parsed(4);
+    vector<std::thread> threads;
+    for (size_t i = 0; i < parsed.size(); i++) {
+        threads.emplace_back([&names, &parsed, i]() {
+            for (int j = 0; j < 100; j++) {
+                for (auto& name : names) {
+                    parsed[i].emplace_back(name);
+                }
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    for (auto& units : parsed) {
+        ASSERT_EQ(units.size(), 100 * names.size());
+        for (size_t k = 0; k < units.size(); k++) {
+            EXPECT_EQ(units[k].str(false), Units(names[k % names.size()]).str(false));
+        }
+    }
+}
+
 TEST(Units, convert_to_base_units) {
     UnitSystem U;
     EXPECT_DOUBLE_EQ(U.convert(1.0, "Pa", "kg/m/s^2"), 1.0);
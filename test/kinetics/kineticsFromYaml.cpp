@@ -782,6 +782,61 @@ TEST(KineticsFromYaml, InvalidExtension)
                  CanteraError);
 }
 
+TEST(KineticsFromYaml, ParallelReactionSetup)
+{
+    auto serial = newSolution("nDodecane_Reitz.yaml", "", "none");
+    setReactionSetupThreads(3);
+    auto parallel = newSolution("nDodecane_Reitz.yaml", "", "none");
+    setReactionSetupThreads(1);
+    auto kin1 = serial->kinetics();
+    auto kin2 = parallel->kinetics();
+    ASSERT_EQ(kin1->nReactions(), kin2->nReactions());
+    ASSERT_GT(kin1->nReactions(), 400u);
+    for (size_t i = 0; i < kin1->nReactions(); i++) {
+        EXPECT_EQ(kin1->reaction(i)->equation(), kin2->reaction(i)->equation());
+    }
+    vector<double> kf1(kin1->nReactions()), kf2(kin2->nReactions());
+    serial->thermo()->setState_TP(1200, 2e5);
+    parallel->thermo()->setState_TP(1200, 2e5);
+    kin1->getFwdRateConstants(kf1.data());
+    kin2->getFwdRateConstants(kf2.data());
+    for (size_t i = 0; i < kf1.size(); i++) {
+        EXPECT_DOUBLE_EQ(kf1[i], kf2[i]);
+    }
+}
+
+TEST(KineticsFromYaml, ParallelReactionSetupErrors)
+{
+    AnyMap input = AnyMap::fromYamlFile("h2o2.yaml");
+    auto& reactions = input["reactions"].asVector<AnyMap>();
+    vector<AnyMap> many;
+    for (size_t i = 0; i < 40; i++) {
+        many.insert(many.end(), reactions.begin(), reactions.end());
+    }
+    for (auto& R : many) {
+        R["duplicate"] = true;
+    }
+    many[50]["equation"] = "H + spam <=> H2";
+    many[700]["equation"] = "H + eggs <=> H2";
+    input["reactions"] = many;
+    setReactionSetupThreads(4);
+    try {
+        newSolution(input["phases"].asVector<AnyMap>()[0], input);
+        setReactionSetupThreads(1);
+        FAIL() << "Expected an exception";
+    } catch (CanteraError& err) {
+        setReactionSetupThreads(1);
+        string msg = err.what();
+        // Errors are reported in the order in which the reactions are defined
+        size_t spam = msg.find("spam");
+        ASSERT_NE(spam, npos);
+        size_t eggs = msg.find("eggs");
+        if (eggs != npos) {
+            EXPECT_LT(spam, eggs);
+        }
+    }
+}
+
 class ReactionToYaml : public testing::Test
 {
 public:
@@ -1,6 +1,7 @@
 #include "gtest/gtest.h"
 #include "cantera/thermo/PengRobinson.h"
 #include "cantera/thermo/ThermoFactory.h"
+#include "cantera/base/AnyMap.h"
 
 
 namespace Cantera
@@ -223,4 +224,115 @@ TEST(PengRobinson, localCritProperties)
     EXPECT_NEAR(test->critPressure(), 22.064e6, 1e-4);
 }
 
+TEST(PengRobinson, setSpeciesCoeffsAtFixedTemperature)
+{
+    // The alpha function and its temperature derivatives are cached, and need to be
+    // updated when the acentric factor (and thus kappa) is modified at the same
+    // temperature
+    auto modified = newThermo("thermo-models.yaml", "CO2-PR");
+    auto reference = newThermo("thermo-models.yaml", "CO2-PR");
+    modified->setState_TPX(320, 5e6, "CO2: 0.6, H2O: 0.4");
+    dynamic_cast<PengRobinson&>(*modified).setSpeciesCoeffs(
+        "CO2", 3.958134e5, 0.0266275, 0.3);
+    modified->setState_TPX(320, 5e6, "CO2: 0.6, H2O: 0.4");
+    dynamic_cast<PengRobinson&>(*reference).setSpeciesCoeffs(
+        "CO2", 3.958134e5, 0.0266275, 0.3);
+    reference->setState_TPX(320, 5e6, "CO2: 0.6, H2O: 0.4");
+
+    size_t K = reference->nSpecies();
+    vector<double> mu1(K), mu2(K), h1(K), h2(K);
+    modified->getChemPotentials(mu1.data());
+    reference->getChemPotentials(mu2.data());
+    modified->getPartialMolarEnthalpies(h1.data());
+    reference->getPartialMolarEnthalpies(h2.data());
+    for (size_t k = 0; k < K; k++) {
+        EXPECT_DOUBLE_EQ(mu1[k], mu2[k]);
+        EXPECT_DOUBLE_EQ(h1[k], h2[k]);
+    }
+    EXPECT_DOUBLE_EQ(modified->density(), reference->density());
+    EXPECT_DOUBLE_EQ(modified->cp_mole(), reference->cp_mole());
+}
+
+class PengRobinsonFlash : public testing::Test
+{
+public:
+    PengRobinsonFlash() : z{0.6, 0.3, 0.05, 0.05}, x(4), y(4) {
+        AnyMap phaseDef = AnyMap::fromYamlString(
+            "{name: test, thermo: Peng-Robinson,"
+            " species: [{gri30.yaml/species: [CH4, C3H8, N2, CO2]}]}");
+        phase = newThermo(phaseDef);
+        fluid = &dynamic_cast<MixtureFugacityTP&>(*phase);
+    }
+
+    //! Molar enthalpy of phase with mole fractions *X* on branch *branch*
+    double phaseEnthalpy(double T, double P, const vector<double>& X, int branch) {
+        phase->setMoleFractions(X.data());
+        phase->setState_TD(T, fluid->densityCalc(T, P, branch, 1.0));
+        return phase->enthalpy_mole();
+    }
+
+    shared_ptr<ThermoPhase> phase;
+    MixtureFugacityTP* fluid;
+    vector<double> z, x, y;
+};
+
+TEST_F(PengRobinsonFlash, two_phase)
+{
+    double T = 250, P = 3e6;
+    phase->setMoleFractions(z.data());
+    double beta = fluid->flashTP(T, P, x.data(), y.data());
+    ASSERT_GT(beta, 0.5);
+    ASSERT_LT(beta, 0.8);
+    EXPECT_GT(x[1], 0.6); // liquid is rich in propane
+    EXPECT_GT(y[0], 0.7); // vapor is rich in methane
+
+    // Phase is left at the feed state
+    EXPECT_DOUBLE_EQ(phase->temperature(), T);
+    EXPECT_NEAR(phase->pressure(), P, 1e-8 * P);
+    EXPECT_NEAR(phase->moleFraction(0), z[0], 1e-14);
+
+    // Material balance and equality of chemical potentials
+    size_t K = phase->nSpecies();
+    vector<double> muL(K), muV(K);
+    double hL = phaseEnthalpy(T, P, x, FLUID_LIQUID_0);
+    phase->getChemPotentials(muL.data());
+    double hV = phaseEnthalpy(T, P, y, FLUID_GAS);
+    phase->getChemPotentials(muV.data());
+    for (size_t k = 0; k < K; k++) {
+        EXPECT_NEAR(beta * y[k] + (1 - beta) * x[k], z[k], 1e-12);
+        EXPECT_NEAR(muL[k], muV[k], 1e-8 * GasConstant * T);
+    }
+
+    // Warm start from the previous solution
+    phase->setMoleFractions(z.data());
+    vector<double> x2(K), y2(K);
+    EXPECT_NEAR(fluid->flashTP(T, P, x2.data(), y2.data()), beta, 1e-10);
+    for (size_t k = 0; k < K; k++) {
+        EXPECT_NEAR(x2[k], x[k], 1e-10);
+        EXPECT_NEAR(y2[k], y[k], 1e-10);
+    }
+
+    // Recover the temperature from the enthalpy of the two-phase mixture
+    double h = beta * hV + (1 - beta) * hL;
+    phase->setMoleFractions(z.data());
+    phase->setState_TP(300, P);
+    fluid->resetFlash();
+    EXPECT_NEAR(fluid->flashHP(h, P, x2.data(), y2.data()), beta, 1e-8);
+    EXPECT_NEAR(phase->temperature(), T, 1e-8 * T);
+}
+
+TEST_F(PengRobinsonFlash, single_phase)
+{
+    phase->setMoleFractions(z.data());
+    // Vapor
+    EXPECT_DOUBLE_EQ(fluid->flashTP(300, 1e6, x.data(), y.data()), 1.0);
+    for (size_t k = 0; k < z.size(); k++) {
+        EXPECT_DOUBLE_EQ(x[k], z[k]);
+        EXPECT_DOUBLE_EQ(y[k], z[k]);
+    }
+    // Compressed liquid
+    EXPECT_DOUBLE_EQ(fluid->flashTP(200, 6e6, x.data(), y.data()), 0.0);
+    EXPECT_GT(phase->density(), 300);
+}
+
 };
@@ -0,0 +1,148 @@
+#include "gtest/gtest.h"
+#include "cantera/thermo/PureFluidPhase.h"
+#include "cantera/thermo/ThermoFactory.h"
+
+namespace Cantera
+{
+
+class TabulatedPureFluid : public testing::Test
+{
+public:
+    void setup(const string& name) {
+        exact = newThermo("liquidvapor.yaml", name);
+        tabulated = newThermo("liquidvapor.yaml", name);
+        auto& fluid = dynamic_cast<PureFluidPhase&>(*tabulated);
+        fluid.setTabulated(true);
+        EXPECT_TRUE(fluid.tabulated());
+    }
+
+    //! Compare properties of the current states of the two phases
+    void compareState(double rtol=1e-4) {
+        double T = exact->temperature();
+        double cpT = exact->cp_mass() * T;
+        EXPECT_NEAR(tabulated->temperature(), T, rtol * T);
+        EXPECT_NEAR(tabulated->density(), exact->density(), rtol * exact->density());
+        EXPECT_NEAR(tabulated->pressure(), exact->pressure(),
+                    rtol * exact->pressure());
+        EXPECT_NEAR(tabulated->enthalpy_mass(), exact->enthalpy_mass(), rtol * cpT);
+        EXPECT_NEAR(tabulated->intEnergy_mass(), exact->intEnergy_mass(), rtol * cpT);
+        EXPECT_NEAR(tabulated->entropy_mass(), exact->entropy_mass(),
+                    rtol * exact->cp_mass());
+        EXPECT_NEAR(tabulated->vaporFraction(), exact->vaporFraction(), rtol);
+    }
+
+    shared_ptr<ThermoPhase> exact;
+    shared_ptr<ThermoPhase> tabulated;
+};
+
+TEST_F(TabulatedPureFluid, water_properties)
+{
+    setup("water");
+    vector<std::pair<double, double>> states = {
+        {300, 1e5}, {300, 1e8}, {450, 2e5}, {600, 1e7}, {640, 2.1e7},
+        {700, 2.5e7}, {1200, 1e6}, {400, 1e3}};
+    for (auto& [T, P] : states) {
+        exact->setState_TP(T, P);
+        tabulated->setState_TP(T, P);
+        compareState();
+        double cp = exact->cp_mass();
+        EXPECT_NEAR(tabulated->cp_mass(), cp, 1e-3 * cp);
+        double cv = exact->cv_mass();
+        EXPECT_NEAR(tabulated->cv_mass(), cv, 1e-3 * cv);
+        double beta = exact->thermalExpansionCoeff();
+        EXPECT_NEAR(tabulated->thermalExpansionCoeff(), beta, 1e-3 * std::abs(beta));
+        double kappa = exact->isothermalCompressibility();
+        EXPECT_NEAR(tabulated->isothermalCompressibility(), kappa, 1e-3 * kappa);
+    }
+}
+
+TEST_F(TabulatedPureFluid, two_phase)
+{
+    setup("water");
+    for (double T : {280.0, 373.15, 500.0, 640.0}) {
+        exact->setState_Tsat(T, 0.3);
+        tabulated->setState_Tsat(T, 0.3);
+        compareState(1e-5);
+        EXPECT_NEAR(tabulated->satPressure(T), exact->satPressure(T),
+                    1e-5 * exact->pressure());
+        double P = exact->pressure();
+        EXPECT_NEAR(tabulated->satTemperature(P), T, 1e-5 * T);
+        tabulated->setState_Psat(P, 0.3);
+        compareState(1e-5);
+    }
+}
+
+TEST_F(TabulatedPureFluid, inverse_problems)
+{
+    for (string name : {"water", "carbon-dioxide", "HFC-134a"}) {
+        setup(name);
+        double Tc = exact->critTemperature();
+        double Pc = exact->critPressure();
+        vector<std::pair<double, double>> states = {
+            {0.8 * Tc, 0.01 * Pc}, {0.8 * Tc, 2 * Pc}, {1.15 * Tc, 0.5 * Pc},
+            {1.02 * Tc, 1.2 * Pc}, {0.95 * Tc, 0.7 * Pc}};
+        for (auto& [T, P] : states) {
+            exact->setState_TP(T, P);
+            double h = exact->enthalpy_mass();
+            double u = exact->intEnergy_mass();
+            double s = exact->entropy_mass();
+            double v = 1.0 / exact->density();
+            tabulated->setState_HP(h, P);
+            compareState();
+            tabulated->setState_SP(s, P);
+            compareState();
+            tabulated->setState_UV(u, v);
+            compareState();
+            tabulated->setState_SV(s, v);
+            compareState();
+            tabulated->setState_ST(s, T);
+            compareState();
+        }
+
+        // two-phase states
+        exact->setState_Tsat(0.9 * Tc, 0.4);
+        double h = exact->enthalpy_mass();
+        double s = exact->entropy_mass();
+        double v = 1.0 / exact->density();
+        double P = exact->pressure();
+        tabulated->setState_HP(h, P);
+        compareState();
+        tabulated->setState_SV(s, v);
+        compareState();
+    }
+}
+
+TEST_F(TabulatedPureFluid, fallback)
+{
+    // States outside of the table are evaluated by the tpx substance
+    setup("water");
+    exact->setState_TP(1e3, 1e-2);
+    tabulated->setState_TP(1e3, 1e-2);
+    compareState(1e-12);
+
+    // Property pairs which are not supported by the table
+    exact->setState_TP(500, 1e6);
+    tabulated->setState_TH(500, exact->enthalpy_mass());
+    EXPECT_NEAR(tabulated->density(), exact->density(), 1e-6 * exact->density());
+}
+
+TEST(PureFluidPhase, tabulated_from_yaml)
+{
+    AnyMap phaseDef = AnyMap::fromYamlString(
+        "name: water\n"
+        "thermo: pure-fluid\n"
+        "species: [{liquidvapor.yaml/species: [H2O]}]\n"
+        "pure-fluid-name: water\n"
+        "tabulated: true\n"
+        "state: {T: 300, P: 101325}");
+    auto phase = newThermo(phaseDef);
+    auto& fluid = dynamic_cast<PureFluidPhase&>(*phase);
+    EXPECT_TRUE(fluid.tabulated());
+    auto exact = newThermo("liquidvapor.yaml", "water");
+    exact->setState_TP(300, 101325);
+    EXPECT_NEAR(phase->density(), exact->density(), 1e-5 * exact->density());
+    AnyMap out = phase->parameters();
+    EXPECT_TRUE(out["tabulated"].asBool());
+}
+
+}
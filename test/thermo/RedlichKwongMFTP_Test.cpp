@@ -147,4 +147,32 @@ TEST_F(RedlichKwongMFTP_Test, localCritProperties)
     EXPECT_NEAR(test_phase->critPressure(), 22.064e6, 1e-4);
 }
 
+TEST_F(RedlichKwongMFTP_Test, setBinaryCoeffsAtFixedTemperature)
+{
+    // The temperature-dependent interaction parameters a_ij = a0 + a1 * T are
+    // cached, and need to be updated when a0 and a1 are modified at the same
+    // temperature. The a1 term also affects the temperature derivative of a.
+    auto reference = newThermo("co2_RK_example.yaml");
+    test_phase->setState_TPX(320, 5e6, "CO2: 0.6, H2O: 0.4");
+    dynamic_cast<RedlichKwongMFTP&>(*test_phase).setBinaryCoeffs(
+        "CO2", "H2O", 8e6, -1e3);
+    test_phase->setState_TPX(320, 5e6, "CO2: 0.6, H2O: 0.4");
+    dynamic_cast<RedlichKwongMFTP&>(*reference).setBinaryCoeffs(
+        "CO2", "H2O", 8e6, -1e3);
+    reference->setState_TPX(320, 5e6, "CO2: 0.6, H2O: 0.4");
+
+    size_t K = reference->nSpecies();
+    vector<double> mu1(K), mu2(K), s1(K), s2(K);
+    test_phase->getChemPotentials(mu1.data());
+    reference->getChemPotentials(mu2.data());
+    test_phase->getPartialMolarEntropies(s1.data());
+    reference->getPartialMolarEntropies(s2.data());
+    for (size_t k = 0; k < K; k++) {
+        EXPECT_DOUBLE_EQ(mu1[k], mu2[k]);
+        EXPECT_DOUBLE_EQ(s1[k], s2[k]);
+    }
+    EXPECT_DOUBLE_EQ(test_phase->density(), reference->density());
+    EXPECT_DOUBLE_EQ(test_phase->cp_mole(), reference->cp_mole());
+}
+
 };
@@ -1,7 +1,9 @@
 #include "gtest/gtest.h"
 #include "cantera/thermo/ThermoPhase.h"
+#include "cantera/thermo/IdealGasPhase.h"
 #include "cantera/thermo/ThermoFactory.h"
 #include "cantera/base/Solution.h"
+#include <numeric>
 
 namespace Cantera
 {
@@ -117,6 +119,102 @@ TEST_F(TestThermoMethods, setConcentrations)
     EXPECT_NEAR(thermo->moleFraction(2), -1e-8 / ctot, 1e-16);
 }
 
+TEST_F(TestThermoMethods, setState_NoNorm)
+{
+    size_t nsp = thermo->nSpecies();
+    vector<double> Y(nsp, 0.0);
+    Y[thermo->speciesIndex("O2")] = 0.2;
+    Y[thermo->speciesIndex("H2")] = 0.3;
+    Y[thermo->speciesIndex("AR")] = 0.5;
+    auto ref = newThermo("h2o2.yaml", "");
+    ref->setState_TPY(600, 2e5, Y.data());
+
+    int stateNum = thermo->stateMFNumber();
+    thermo->setState_TPY_NoNorm(600, 2e5, Y.data());
+    EXPECT_EQ(thermo->stateMFNumber(), stateNum + 1);
+    EXPECT_DOUBLE_EQ(thermo->density(), ref->density());
+    EXPECT_DOUBLE_EQ(thermo->meanMolecularWeight(), ref->meanMolecularWeight());
+    EXPECT_DOUBLE_EQ(thermo->enthalpy_mass(), ref->enthalpy_mass());
+
+    thermo->setState_TDY_NoNorm(700, 1.5 * ref->density(), Y.data());
+    EXPECT_EQ(thermo->stateMFNumber(), stateNum + 2);
+    EXPECT_DOUBLE_EQ(thermo->temperature(), 700);
+    EXPECT_DOUBLE_EQ(thermo->density(), 1.5 * ref->density());
+    EXPECT_DOUBLE_EQ(thermo->moleFraction("AR"), ref->moleFraction("AR"));
+
+    // Mass fractions are not normalized
+    Y[thermo->speciesIndex("AR")] = 0.6;
+    thermo->setState_TDY_NoNorm(700, 1.0, Y.data());
+    EXPECT_DOUBLE_EQ(thermo->massFraction("AR"), 0.6);
+
+    // Composition change at constant temperature for a phase where the mixing
+    // rules depend on both temperature and composition
+    auto pr = newThermo("thermo-models.yaml", "CO2-PR");
+    auto prRef = newThermo("thermo-models.yaml", "CO2-PR");
+    vector<double> Ypr{0.7, 0.3, 0.0};
+    pr->setState_TPX(320, 5e6, "CO2: 1.0");
+    pr->setState_TPY_NoNorm(320, 5e6, Ypr.data());
+    prRef->setState_TPY(320, 5e6, Ypr.data());
+    EXPECT_DOUBLE_EQ(pr->density(), prRef->density());
+    EXPECT_DOUBLE_EQ(pr->enthalpy_mass(), prRef->enthalpy_mass());
+    EXPECT_DOUBLE_EQ(pr->cp_mass(), prRef->cp_mass());
+}
+
+TEST(IdealGasPhase, solveTemperatures)
+{
+    for (string name : {"gri30.yaml", "airNASA9.yaml"}) {
+        auto gas = newThermo(name);
+        auto& ideal = dynamic_cast<IdealGasPhase&>(*gas);
+        size_t nsp = gas->nSpecies();
+        size_t N = 20;
+        vector<double> Y(N * nsp), h(N), u(N), Tref(N), T(N), T2(N);
+        vector<int> iter(N);
+        for (size_t i = 0; i < N; i++) {
+            for (size_t k = 0; k < nsp; k++) {
+                Y[i * nsp + k] = ((i + 3 * k) % 7) + 0.1;
+            }
+            Tref[i] = 300.0 + 150.0 * i;
+            gas->setState_TPY(Tref[i], OneAtm, &Y[i * nsp]);
+            gas->getMassFractions(&Y[i * nsp]);
+            h[i] = gas->enthalpy_mass();
+            u[i] = gas->intEnergy_mass();
+        }
+        gas->setState_TP(500, 2 * OneAtm);
+        int stateNum = gas->stateMFNumber();
+
+        T.assign(N, 1000.0);
+        size_t nIter = ideal.solveTemperatures_HY(N, h.data(), Y.data(), T.data(),
+                                                  iter.data());
+        for (size_t i = 0; i < N; i++) {
+            EXPECT_NEAR(T[i], Tref[i], 1e-9 * Tref[i]) << name << " " << i;
+            EXPECT_GT(iter[i], 0);
+        }
+        EXPECT_EQ(nIter, (size_t) std::accumulate(iter.begin(), iter.end(), 0));
+
+        T.assign(N, 1000.0);
+        ideal.solveTemperatures_UY(N, u.data(), Y.data(), T.data());
+        for (size_t i = 0; i < N; i++) {
+            EXPECT_NEAR(T[i], Tref[i], 1e-9 * Tref[i]) << name << " " << i;
+        }
+
+        // Results do not depend on the other states in the batch
+        T2.assign(N, 1000.0);
+        for (size_t i = 0; i < N; i++) {
+            ideal.solveTemperatures_UY(1, &u[i], &Y[i * nsp], &T2[i]);
+            EXPECT_EQ(T2[i], T[i]);
+        }
+
+        // The state of the phase is unchanged
+        EXPECT_DOUBLE_EQ(gas->temperature(), 500);
+        EXPECT_DOUBLE_EQ(gas->pressure(), 2 * OneAtm);
+        EXPECT_EQ(gas->stateMFNumber(), stateNum);
+
+        T[0] = -1.0;
+        EXPECT_THROW(ideal.solveTemperatures_HY(1, h.data(), Y.data(), T.data()),
+                     CanteraError);
+    }
+}
+
 class EquilRatio_MixFrac_Test : public testing::Test
 {
 public:
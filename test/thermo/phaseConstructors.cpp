@@ -496,6 +496,42 @@ TEST(HMWSoln, fromScratch)
     }
 }
 
+TEST(HMWSoln, partialMolarEnthalpies_beta2)
+{
+    // Check the temperature derivatives of the activity coefficients against
+    // finite differences of the chemical potentials, with all of the interaction
+    // parameters depending on temperature
+    auto phase = newThermo("HMW_NaCl.yaml");
+    auto& p = dynamic_cast<HMWSoln&>(*phase);
+    double beta0[] = {0.0765, 0.008946, -3.3158E-6, -777.03, -4.4706};
+    double beta1[] = {0.2664, 6.1608E-5, 1.0715E-6, 0.0, 0.0};
+    double beta2[] = {-0.05, 1.0E-4, 2.0E-7, 3.0, 0.01};
+    double cphi[] = {0.00127, -4.655E-5, 0.0, 33.317, 0.09421};
+    p.setBinarySalt("Na+", "Cl-", 5, beta0, beta1, beta2, cphi, 2.0, 12.0);
+    double theta[] = {-0.05, 1.0E-4, 0.0, 2.0, 0.0};
+    double psi[] = {-0.006, 2.0E-5, 0.0, 0.0, 0.001};
+    p.setTheta("Cl-", "OH-", 5, theta);
+    p.setPsi("Na+", "Cl-", "OH-", 5, psi);
+    p.setMolalitiesByName("Na+:3.0 Cl-:2.5 H+:1.0E-6 OH-:0.5");
+
+    double T = 310.0;
+    double P = 101325;
+    double dT = 1e-3;
+    size_t N = p.nSpecies();
+    vector<double> x(N), h(N), mu1(N), mu2(N);
+    p.setState_TP(T, P);
+    p.getMoleFractions(x.data());
+    p.getPartialMolarEnthalpies(h.data());
+    p.setState_TPX(T + dT, P, x.data());
+    p.getChemPotentials(mu1.data());
+    p.setState_TPX(T - dT, P, x.data());
+    p.getChemPotentials(mu2.data());
+    for (size_t k = 0; k < N; k++) {
+        double h_fd = - T * T * (mu1[k] / (T + dT) - mu2[k] / (T - dT)) / (2 * dT);
+        EXPECT_NEAR(h[k], h_fd, 1e-7 * std::max(std::abs(h[k]), 1e4)) << k;
+    }
+}
+
 TEST(HMWSoln, fromScratch_HKFT)
 {
     HMWSoln p;
@@ -280,6 +280,45 @@ TEST(ThermoFromYaml, HMWSoln_HKFT)
     }
 }
 
+TEST(ThermoFromYaml, HMWSoln_tabulated_water)
+{
+    AnyMap root = AnyMap::fromYamlFile("HMW_NaCl.yaml");
+    AnyMap phaseNode = root["phases"].getMapWhere(
+        "name", "NaCl_electrolyte_complex_shomate");
+    auto exact = newThermo(phaseNode, root);
+    auto& species = root["species_waterSolution"].asVector<AnyMap>();
+    ASSERT_EQ(species[0]["name"].asString(), "H2O(L)");
+    species[0]["equation-of-state"]["tabulated"] = true;
+    auto tabulated = newThermo(phaseNode, root);
+
+    size_t N = exact->nSpecies();
+    vector<double> mu1(N), mu2(N), ac1(N), ac2(N);
+    for (double T : {273.15, 298.15, 373.15, 473.15, 573.15}) {
+        for (double P : {OneAtm, 1e7}) {
+            exact->setState_TP(T, P);
+            tabulated->setState_TP(T, P);
+            exact->getChemPotentials(mu1.data());
+            tabulated->getChemPotentials(mu2.data());
+            exact->getActivityCoefficients(ac1.data());
+            tabulated->getActivityCoefficients(ac2.data());
+            for (size_t k = 0; k < N; k++) {
+                EXPECT_NEAR(mu2[k], mu1[k], 1e-8 * GasConstant * T);
+                EXPECT_NEAR(ac2[k], ac1[k], 1e-8 * ac1[k]);
+            }
+            EXPECT_NEAR(tabulated->density(), exact->density(),
+                        1e-10 * exact->density());
+            EXPECT_NEAR(tabulated->cp_mole(), exact->cp_mole(),
+                        1e-6 * std::abs(exact->cp_mole()));
+        }
+    }
+
+    AnyMap speciesData;
+    tabulated->getSpeciesParameters("H2O(L)", speciesData);
+    auto& eos = speciesData["equation-of-state"].getMapWhere(
+        "model", "liquid-water-IAPWS95");
+    EXPECT_TRUE(eos["tabulated"].asBool());
+}
+
 TEST(ThermoFromYaml, RedlichKwong_CO2)
 {
     auto thermo = newThermo("thermo-models.yaml", "CO2-RK");
@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 #include "cantera/base/ct_defs.h"
+#include "cantera/base/ctexceptions.h"
 #include "cantera/thermo/WaterPropsIAPWSphi.h"
 #include "cantera/thermo/WaterPropsIAPWS.h"
 
@@ -138,3 +139,43 @@ TEST_F(WaterPropsIAPWS_Test, expansion_coeffs)
                     beta_num[i], 4e-10 * beta_num[i]);
     }
 }
+
+TEST_F(WaterPropsIAPWS_Test, tabulated_density)
+{
+    WaterPropsIAPWS tabulated;
+    tabulated.setTabulated(true);
+    EXPECT_TRUE(tabulated.tabulated());
+    // Stable and metastable liquid, supercritical fluid, and states outside of the
+    // tables
+    vector<double> TT{273.16, 300.0, 450.0, 450.0, 640.0, 650.0, 700.0, 1000.0,
+                      1500.0, 300.0};
+    vector<double> PP{1e5, 5e8, 1e5, 1e7, 2.1e7, 2.2e7, 1e4, 1e8, 1e6, 1e2};
+    for (size_t i = 0; i < TT.size(); i++) {
+        double rho = water.density(TT[i], PP[i], WATER_LIQUID);
+        double rhoTab = tabulated.density(TT[i], PP[i], WATER_LIQUID);
+        EXPECT_NEAR(rhoTab, rho, 1e-10 * rho) << TT[i] << " " << PP[i];
+        EXPECT_NEAR(tabulated.enthalpy_mass(), water.enthalpy_mass(), 1e-4);
+        EXPECT_EQ(tabulated.phaseState(true), water.phaseState(true));
+    }
+
+    // Gas phase below the critical temperature is not tabulated
+    double rho = water.density(400.0, 1e5, WATER_GAS);
+    EXPECT_NEAR(tabulated.density(400.0, 1e5, WATER_GAS), rho, 1e-12 * rho);
+}
+
+TEST_F(WaterPropsIAPWS_Test, tabulated_saturation)
+{
+    WaterPropsIAPWS tabulated;
+    tabulated.setTabulated(true, 1e-12);
+    EXPECT_DOUBLE_EQ(tabulated.tabulationTolerance(), 1e-12);
+    for (double T : {273.16, 300.0, 373.124, 500.0, 600.0, 640.0}) {
+        double P = water.psat(T, WATER_LIQUID);
+        double rhoLiq = water.density();
+        double rhoGas = water.density(T, P, WATER_GAS);
+        EXPECT_NEAR(tabulated.psat(T, WATER_LIQUID), P, 5e-8 * P);
+        EXPECT_NEAR(tabulated.density(), rhoLiq, 1e-8 * rhoLiq);
+        EXPECT_NEAR(tabulated.psat(T, WATER_GAS), P, 5e-8 * P);
+        EXPECT_NEAR(tabulated.density(), rhoGas, 1e-7 * rhoGas);
+    }
+    EXPECT_THROW(tabulated.setTabulated(true, 0.0), CanteraError);
+}
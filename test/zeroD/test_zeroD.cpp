@@ -7,6 +7,8 @@
 #include "cantera/numerics/PreconditionerFactory.h"
 #include "cantera/numerics/AdaptivePreconditioner.h"
 
+#include <numeric>
+
 using namespace Cantera;
 
 // This test is an (almost) exact equivalent of a clib test
@@ -101,6 +103,292 @@ TEST(zerodim, test_individual_reactor_initialization)
     }
 }
 
+// Compare the lightweight extrapolation integrator with the equilibrium state,
+// using both the analytic Jacobian of a mole reactor and a finite difference
+// Jacobian.
+TEST(zerodim, extrapolation_integrator)
+{
+    double T0 = 1100.0;
+    double P0 = 10 * OneAtm;
+    string X0 = "H2:1.0, O2:0.5, AR:8.0";
+    auto sol_eq = newSolution("h2o2.yaml");
+    sol_eq->thermo()->setState_TPX(T0, P0, X0);
+    sol_eq->thermo()->equilibrate("HP");
+
+    auto sol1 = newSolution("h2o2.yaml");
+    sol1->thermo()->setState_TPX(T0, P0, X0);
+    IdealGasConstPressureMoleReactor reactor1(sol1);
+    ReactorNet network1;
+    network1.addReactor(reactor1);
+    network1.setIntegratorType("Extrapolation");
+    EXPECT_TRUE(network1.hasJacobian());
+    network1.advance(0.1);
+    EXPECT_NEAR(reactor1.temperature(), sol_eq->thermo()->temperature(), 1e-3);
+
+    auto sol2 = newSolution("h2o2.yaml");
+    sol2->thermo()->setState_TPX(T0, P0, X0);
+    IdealGasConstPressureReactor reactor2(sol2);
+    ReactorNet network2;
+    network2.setIntegratorType("Extrapolation");
+    network2.addReactor(reactor2);
+    EXPECT_FALSE(network2.hasJacobian());
+    network2.advance(0.1);
+    EXPECT_NEAR(reactor2.temperature(), sol_eq->thermo()->temperature(), 1e-3);
+    EXPECT_NEAR(reactor2.massFraction(sol2->thermo()->speciesIndex("H2O")),
+                sol_eq->thermo()->massFraction("H2O"), 1e-7);
+
+    AnyMap stats = network2.solverStats();
+    EXPECT_GT(stats["steps"].asInt(), 0);
+    EXPECT_GE(stats["err_test_fails"].asInt(), 0);
+    EXPECT_THROW(network2.setIntegratorType("unknown"), CanteraError);
+
+    // Settings are carried over when the integrator is replaced
+    network2.setMaxSteps(1234);
+    network2.setMaxTimeStep(1e-3);
+    network2.setIntegratorType("Extrapolation");
+    EXPECT_EQ(network2.maxSteps(), 1234);
+    EXPECT_DOUBLE_EQ(network2.maxTimeStep(), 1e-3);
+}
+
+TEST(zerodim, events)
+{
+    double T0 = 1100.0;
+    string X0 = "H2:1.0, O2:0.5, AR:8.0";
+
+    // Reference solution from individual steps, with the temperature rise located
+    // by linear interpolation and the maximum rate of temperature rise taken at the
+    // end of the step with the largest rate
+    auto sol_ref = newSolution("h2o2.yaml");
+    sol_ref->thermo()->setState_TPX(T0, OneAtm, X0);
+    IdealGasConstPressureReactor reactor_ref(sol_ref);
+    ReactorNet net_ref;
+    net_ref.addReactor(reactor_ref);
+    net_ref.setMaxTimeStep(1e-6);
+    size_t kT = net_ref.globalComponentIndex("temperature");
+    double tRise = -1.0;
+    double tMax = 0.0;
+    double rateMax = 0.0;
+    double tPrev = 0.0;
+    double TPrev = T0;
+    vector<double> ydot(net_ref.neq());
+    while (net_ref.time() < 2e-3) {
+        double t = net_ref.step();
+        double T = reactor_ref.temperature();
+        if (tRise < 0 && T > T0 + 400) {
+            tRise = tPrev + (t - tPrev) * (T0 + 400 - TPrev) / (T - TPrev);
+        }
+        net_ref.getDerivative(1, ydot.data());
+        if (ydot[kT] > rateMax) {
+            rateMax = ydot[kT];
+            tMax = t;
+        }
+        tPrev = t;
+        TPrev = T;
+    }
+    ASSERT_GT(tRise, 0.0);
+
+    auto sol = newSolution("h2o2.yaml");
+    sol->thermo()->setState_TPX(T0, OneAtm, X0);
+    IdealGasConstPressureReactor reactor(sol);
+    ReactorNet net;
+    net.addReactor(reactor);
+    size_t kOH = net.globalComponentIndex("OH");
+    size_t iRise = net.addEvent("T-rise",
+        [&](double t, const double* y, const double* ydot) {
+            return reactor.temperature() - T0 - 400;
+        });
+    size_t iOH = net.addEvent("OH",
+        [&](double t, const double* y, const double* ydot) {
+            return y[kOH] - 1e-3;
+        }, 1);
+    size_t iMax = net.addRateMaximumEvent("max-dTdt",
+                                          net.globalComponentIndex("temperature"));
+    EXPECT_EQ(net.nEvents(), 3u);
+    EXPECT_EQ(net.eventName(iOH), "OH");
+    net.advance(2e-3);
+    EXPECT_DOUBLE_EQ(net.time(), 2e-3);
+    EXPECT_EQ(net.lastEvent(), npos);
+    ASSERT_EQ(net.eventTimes(iRise).size(), 1u);
+    EXPECT_NEAR(net.eventTimes(iRise)[0], tRise, 1e-4 * tRise);
+    ASSERT_EQ(net.eventTimes(iOH).size(), 1u);
+    EXPECT_LT(net.eventTimes(iOH)[0], net.eventTimes(iRise)[0]);
+    ASSERT_EQ(net.eventTimes(iMax).size(), 1u);
+    EXPECT_NEAR(net.eventTimes(iMax)[0], tMax, 1e-6);
+
+    // Stop the integration at a terminal event
+    sol->thermo()->setState_TPX(T0, OneAtm, X0);
+    reactor.syncState();
+    net.clearEvents();
+    net.addEvent("T-rise",
+        [&](double t, const double* y, const double* ydot) {
+            return reactor.temperature() - T0 - 400;
+        }, 0, true);
+    net.setInitialTime(0.0);
+    EXPECT_NEAR(net.advance(1.0, false), tRise, 1e-4 * tRise);
+    EXPECT_EQ(net.lastEvent(), 0u);
+    EXPECT_NEAR(reactor.temperature(), T0 + 400, 1e-3);
+    net.advance(2e-3);
+    EXPECT_DOUBLE_EQ(net.time(), 2e-3);
+    EXPECT_EQ(net.lastEvent(), npos);
+    EXPECT_EQ(net.eventTimes(0).size(), 1u);
+}
+
+TEST(zerodim, adjoint_sensitivities)
+{
+    double T0 = 1100.0;
+    string X0 = "H2:1.0, O2:0.5, AR:8.0";
+    double tf = 2e-4; // shortly before ignition
+
+    // Temperature at tf with the multiplier of reaction i scaled by (1 + delta)
+    auto finalTemperature = [&](size_t i, double delta) {
+        auto sol = newSolution("h2o2.yaml");
+        sol->thermo()->setState_TPX(T0, OneAtm, X0);
+        sol->kinetics()->setMultiplier(i, 1.0 + delta);
+        IdealGasConstPressureMoleReactor reactor(sol);
+        ReactorNet net;
+        net.addReactor(reactor);
+        net.setTolerances(1e-12, 1e-20);
+        net.advance(tf);
+        return reactor.temperature();
+    };
+
+    auto sol = newSolution("h2o2.yaml");
+    sol->thermo()->setState_TPX(T0, OneAtm, X0);
+    IdealGasConstPressureMoleReactor reactor(sol);
+    ReactorNet net;
+    net.addReactor(reactor);
+    net.setSensitivityTolerances(1e-6, 1e-8);
+    size_t kT = net.globalComponentIndex("temperature");
+    vector<double> sens = net.adjointSensitivities(tf,
+        [&](const double* y, double* dgdy) {
+            std::fill(dgdy, dgdy + net.neq(), 0.0);
+            dgdy[kT] = 1.0;
+        }, 100, true);
+    ASSERT_EQ(sens.size(), sol->kinetics()->nReactions());
+    EXPECT_DOUBLE_EQ(net.time(), tf);
+    EXPECT_NEAR(reactor.temperature(), finalTemperature(0, 0.0), 1e-2);
+
+    // Compare the largest sensitivities with finite differences
+    vector<size_t> order(sens.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return std::abs(sens[a]) > std::abs(sens[b]);
+    });
+    double delta = 1e-4;
+    for (size_t n = 0; n < 4; n++) {
+        size_t i = order[n];
+        double fd = (finalTemperature(i, delta) - finalTemperature(i, -delta))
+                    / (2 * delta);
+        EXPECT_NEAR(sens[i], fd, 1e-3 * std::abs(sens[order[0]])) << i;
+    }
+
+    // Same result for a reactor using mass fractions as state variables, which
+    // does not provide an analytic Jacobian, using more frequent checkpoints
+    auto sol2 = newSolution("h2o2.yaml");
+    sol2->thermo()->setState_TPX(T0, OneAtm, X0);
+    IdealGasConstPressureReactor reactor2(sol2);
+    ReactorNet net2;
+    net2.addReactor(reactor2);
+    net2.setSensitivityTolerances(1e-6, 1e-8);
+    size_t kT2 = net2.globalComponentIndex("temperature");
+    vector<double> sens2 = net2.adjointSensitivities(tf,
+        [&](const double* y, double* dgdy) {
+            std::fill(dgdy, dgdy + net2.neq(), 0.0);
+            dgdy[kT2] = 1.0;
+        }, 5);
+    for (size_t i = 0; i < sens.size(); i++) {
+        EXPECT_NEAR(sens2[i], sens[i], 1e-3 * std::abs(sens[order[0]])) << i;
+    }
+
+    // Similar result using the analytic Jacobian, which neglects some minor terms
+    auto sol3 = newSolution("h2o2.yaml");
+    sol3->thermo()->setState_TPX(T0, OneAtm, X0);
+    IdealGasConstPressureMoleReactor reactor3(sol3);
+    ReactorNet net3;
+    net3.addReactor(reactor3);
+    net3.setSensitivityTolerances(1e-6, 1e-8);
+    vector<double> sens3 = net3.adjointSensitivities(tf,
+        [&](const double* y, double* dgdy) {
+            std::fill(dgdy, dgdy + net3.neq(), 0.0);
+            dgdy[kT] = 1.0;
+        });
+    for (size_t i = 0; i < sens.size(); i++) {
+        EXPECT_NEAR(sens3[i], sens[i], 5e-3 * std::abs(sens[order[0]])) << i;
+    }
+    EXPECT_THROW(net3.adjointSensitivities(2 * tf,
+        [&](const double* y, double* dgdy) {}, 0), CanteraError);
+}
+
+TEST(zerodim, steady_state_psr)
+{
+    // Perfectly stirred reactor fed with a stoichiometric hydrogen/air mixture
+    string X0 = "H2:2.0, O2:1.0, N2:3.76";
+    auto gas = newSolution("h2o2.yaml");
+    gas->thermo()->setState_TPX(300.0, OneAtm, X0);
+    Reservoir inlet(gas);
+    Reservoir exhaust(gas);
+    auto contents = newSolution("h2o2.yaml");
+    contents->thermo()->setState_TPX(300.0, OneAtm, X0);
+    contents->thermo()->equilibrate("HP");
+    IdealGasReactor psr(contents);
+    psr.setInitialVolume(1e-6);
+    MassFlowController mfc;
+    mfc.install(inlet, psr);
+    PressureController pc;
+    pc.install(psr, exhaust);
+    pc.setPrimary(&mfc);
+    pc.setPressureCoeff(1e-8);
+    ReactorNet net;
+    net.addReactor(psr);
+
+    // Mass flow rate corresponding to the residence time at the initial density
+    double mass = psr.mass();
+    auto setResidenceTime = [&](double tau) {
+        mfc.setMassFlowRate(mass / tau);
+    };
+
+    setResidenceTime(1e-3);
+    net.solveSteady();
+    double Tsteady = psr.temperature();
+    EXPECT_GT(Tsteady, 2000.0);
+
+    // Compare with the result of integrating to a large time
+    net.advance(0.5);
+    EXPECT_NEAR(psr.temperature(), Tsteady, 1e-4 * Tsteady);
+    auto Y = psr.contents().massFractions();
+    net.solveSteady();
+    EXPECT_NEAR(psr.temperature(), Tsteady, 1e-5 * Tsteady);
+    for (size_t k = 0; k < gas->thermo()->nSpecies(); k++) {
+        EXPECT_NEAR(psr.contents().massFraction(k), Y[k], 1e-6);
+    }
+
+    // Trace the burning branch of the S-curve through the extinction point
+    vector<double> tau, T;
+    size_t npoints = net.solveSteadyContinuation(setResidenceTime, 1e-3, 8e-4,
+        1e-8, 2e-3, [&](double p) {
+            tau.push_back(p);
+            T.push_back(psr.temperature());
+            return true;
+        }, 200);
+    ASSERT_EQ(npoints, tau.size());
+    size_t iext = std::min_element(tau.begin(), tau.end()) - tau.begin();
+    ASSERT_GT(iext, 0);
+    ASSERT_LT(iext, tau.size() - 1);
+    for (size_t i = 1; i <= iext; i++) {
+        EXPECT_LT(T[i], T[i-1]);
+    }
+    EXPECT_LT(T.back(), T[iext] - 100.0);
+
+    // Below the extinction residence time, the steady-state solver started from
+    // the burning state needs to follow the transient extinction
+    contents->thermo()->setState_TPX(300.0, OneAtm, X0);
+    contents->thermo()->equilibrate("HP");
+    psr.syncState();
+    setResidenceTime(0.5 * tau[iext]);
+    net.solveSteady();
+    EXPECT_LT(psr.temperature(), 400.0);
+}
+
 TEST(MoleReactorTestSet, test_mole_reactor_get_state)
 {
     // setting up solution object and thermo/kinetics pointers
@@ -129,6 +417,61 @@ TEST(MoleReactorTestSet, test_mole_reactor_get_state)
     EXPECT_NEAR(reactor.pressure(), OneAtm, tol);
 }
 
+TEST(ReactorISAT, retrieve_grow_add)
+{
+    double T0 = 1100.0;
+    double dt = 2e-5;
+    string X0 = "H2:2.0, O2:1.0, AR:8.0";
+    auto sol = newSolution("h2o2.yaml");
+    auto gas = sol->thermo();
+    gas->setState_TPX(T0, OneAtm, X0);
+    IdealGasConstPressureReactor reactor(sol);
+    ReactorNet network;
+    network.addReactor(reactor);
+    ReactorISAT isat(network);
+    isat.setTolerance(1e-4);
+
+    // Reference solution obtained by direct integration
+    auto directT = [&](double T) {
+        gas->setState_TPX(T, OneAtm, X0);
+        reactor.syncState();
+        network.setInitialTime(0.0);
+        network.advance(dt);
+        return gas->temperature();
+    };
+
+    // First query creates the table
+    gas->setState_TPX(T0, OneAtm, X0);
+    reactor.syncState();
+    isat.advance(dt);
+    EXPECT_EQ(isat.nEntries(), 1u);
+
+    // A nearby query is retrieved from the table
+    gas->setState_TPX(T0 + 0.01, OneAtm, X0);
+    reactor.syncState();
+    isat.advance(dt);
+    double Tisat = gas->temperature();
+    AnyMap stats = isat.stats();
+    EXPECT_EQ(stats["retrieves"].asInt(), 1);
+    EXPECT_NEAR(Tisat, directT(T0 + 0.01), 1e-4 / 1e-3);
+
+    // A distant query requires an additional entry or growth of the EOA
+    gas->setState_TPX(T0 + 100.0, OneAtm, X0);
+    reactor.syncState();
+    isat.advance(dt);
+    stats = isat.stats();
+    EXPECT_EQ(stats["retrieves"].asInt() + stats["grows"].asInt()
+              + stats["adds"].asInt(), 3);
+    EXPECT_NEAR(gas->temperature(), directT(T0 + 100.0), 1e-6);
+
+    // Changing the interval clears the table
+    gas->setState_TPX(T0, OneAtm, X0);
+    reactor.syncState();
+    isat.advance(2 * dt);
+    EXPECT_EQ(isat.nEntries(), 1u);
+    EXPECT_EQ(isat.stats()["retrieves"].asInt(), 0);
+}
+
 TEST(AdaptivePreconditionerTests, test_adaptive_precon_utils)
 {
     // setting the tolerance